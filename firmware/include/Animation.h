@@ -2,24 +2,24 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "AnimationDecoder.h"
+#include "drivers/BufferedSSD1306.h"
 
-#define DEFAULT_FRAME_WIDTH 48
-#define DEFAULT_FRAME_HEIGHT 48
 #define DEFAULT_FRAME_DELAY 42
 
 class Animation
 {
 public:
-    Animation(Adafruit_SSD1306 *display);
-    void start(const byte *frames, int frameCount, bool loop, bool reverse, unsigned long durationMs, int width, int height); // Moved reverse parameter
+    Animation(BufferedSSD1306 *display);
+    void start(const PackedAnimation &frames, bool loop, bool reverse, unsigned long durationMs);
     void update();
     bool isRunning();
+    unsigned long nextFrameTime() const; // Next frame or the end of the animation, whichever is first
 
 private:
-    Adafruit_SSD1306 *oled;
-    const byte *animationFrames;
+    BufferedSSD1306 *oled;
+    AnimationDecoder decoder;
     int totalFrames;
-    int currentFrame;
     int frameWidth;
     int frameHeight;
     int frameX;
@@ -31,4 +31,8 @@ private:
     unsigned long lastFrameTime;
     unsigned long animationDuration;
     unsigned long frameDelay;
+
+    void drawChangedRows();
+    void flush();                         // The whole panel, after start() clears it
+    void flushWindow(int y, int height); // Just the frame's columns of these rows' pages
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define ANIMATION_MAX_WIDTH 64 // Must match firmware/tools/pack_animation.py
+#define ANIMATION_MAX_HEIGHT 64
+
+// An animation as firmware/tools/pack_animation.py packs it (animations.h).
+//
+// There are frameCount + 1 deltas. Delta 0 is frame 0 (against a blank
+// frame), delta i is frame i-1 XOR frame i and delta frameCount is the last
+// frame XOR frame 0. XOR undoes itself, so the same deltas play forward, in
+// reverse and across the loop, and the last frame is delta 0 then the last
+// delta.
+//
+// A delta is a mask of the rows it changes, (height + 7) / 8 bytes with row
+// y at bit y % 8 of byte y / 8, then the XOR bytes of those rows alone,
+// PackBits-coded across the rows: a control byte c < 0x80 is followed by
+// c + 1 literal bytes, c >= 0x80 by one byte to repeat c - 0x80 + 2 times.
+// Rows are width / 8 bytes, MSB the leftmost pixel, as drawBitmap() takes.
+struct PackedAnimation
+{
+  uint8_t width; // Multiple of 8
+  uint8_t height;
+  uint8_t frameCount;
+  const uint16_t *deltas; // frameCount + 2 offsets into data; the last is its length
+  const uint8_t *data;
+};
+
+// Keeps the current frame of a PackedAnimation and steps it one delta at a
+// time, noting which rows each step changed so only those get redrawn.
+class AnimationDecoder
+{
+public:
+  AnimationDecoder();
+
+  // False if the animation is larger than ANIMATION_MAX_WIDTH x ANIMATION_MAX_HEIGHT
+  bool begin(const PackedAnimation *animation);
+
+  // Each moves to a frame and sets changedRows() to the rows that differ
+  // from before: from a blank frame for first() and last()
+  void first();
+  void last();
+  void next();     // Wraps from the last frame to the first
+  void previous(); // Wraps from the first frame to the last
+
+  int frame() const { return current; }
+  uint64_t changedRows() const { return changed; } // Bit y for row y
+  const uint8_t *row(int y) const { return pixels + y * rowBytes; }
+
+private:
+  const PackedAnimation *animation;
+  uint8_t pixels[ANIMATION_MAX_WIDTH / 8 * ANIMATION_MAX_HEIGHT];
+  int rowBytes;
+  int current;
+  uint64_t changed;
+
+  void apply(int delta);
+};
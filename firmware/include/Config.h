@@ -6,6 +6,9 @@
 #define OLED_WIDTH 128
 #define OLED_HEIGHT 64
 #define OLED_ADDR 0x3C
+// Panel transfers, sent by the flush task (drivers/BufferedSSD1306.h). Many
+// SSD1306 modules also run at 1000000 (fast-mode plus), about 10 ms a frame.
+#define OLED_I2C_CLOCK 400000UL
 
 #define LED_PIN 15
 #define NUM_LEDS 16
@@ -1,18 +1,18 @@
 #pragma once
 
 #include "controllers/DisplayController.h"
-#include "controllers/LEDController.h"
+#include "controllers/LedController.h"
 #include "controllers/InputController.h"
 #include "controllers/NetworkController.h"
 #include "managers/ProjectManager.h"
-#include <Preferences.h>
+#include "managers/SettingsStore.h"
+#include "Scheduler.h"
 
 // Declare global controller instances
 extern DisplayController displayController;
 extern LEDController ledController;
 extern InputController inputController;
 extern NetworkController networkController;
-extern Preferences preferences;
 extern ProjectManager projectManager;
 
 // Declare global instance getter for ProjectManager
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <LittleFS.h>
+
+// The "data" partition of partitions.csv, mounted as its own LittleFS. It
+// holds what the device saves at runtime (the project catalog and journal,
+// the webhook outbox); the web UI stays on "spiffs" (LittleFS), which
+// `pio run -t uploadfs` rewrites, so uploading the UI leaves this intact.
+#define DATA_FS_PARTITION_LABEL "data"
+#define DATA_FS_BASE_PATH "/data"
+#define DATA_FS_BLOCK_SIZE 4096 // LittleFS allocates whole blocks, at least one a file
+
+extern fs::LittleFSFS DataFS;
+
+// Mounts DataFS, formatting the partition if it won't mount (first boot on a
+// blank partition). Safe to call again once mounted.
+bool mountDataFS();
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Writes JSON into a caller-owned buffer without allocating; sticks at failed
+// once anything overflows
+class JsonWriter
+{
+public:
+  JsonWriter(char *out, size_t size) : out(out), size(size), length(0), failed(false) {}
+
+  void raw(const char *text)
+  {
+    while (*text)
+    {
+      put(*text++);
+    }
+  }
+
+  void string(const char *text)
+  {
+    put('"');
+    for (; *text; text++)
+    {
+      uint8_t c = *text;
+      if (c == '"' || c == '\\')
+      {
+        put('\\');
+        put(c);
+      }
+      else if (c < 0x20)
+      {
+        static const char hex[] = "0123456789abcdef";
+        raw("\\u00");
+        put(hex[c >> 4]);
+        put(hex[c & 0x0F]);
+      }
+      else
+      {
+        put(c);
+      }
+    }
+    put('"');
+  }
+
+  void number(uint32_t value)
+  {
+    char digits[11];
+    snprintf(digits, sizeof(digits), "%lu", (unsigned long)value);
+    raw(digits);
+  }
+
+  size_t finish() const { return failed ? 0 : length; }
+
+private:
+  char *out;
+  size_t size;
+  size_t length;
+  bool failed;
+
+  void put(char c)
+  {
+    if (length + 1 >= size) // Keep room for the terminator
+    {
+      failed = true;
+      return;
+    }
+    out[length++] = c;
+    out[length] = '\0';
+  }
+};
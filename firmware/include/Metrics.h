@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Histogram buckets: exact below 4 us, then four per power of two up to
+// 2^21 us (~2 s); anything slower lands in the last bucket
+#define METRICS_BUCKETS 80
+#define METRICS_MAX_STATES 12
+
+// Instrumented code paths. Display includes OledFlush, so the pair shows
+// how much of each draw is spent handing frames to the panel.
+enum class Metric : uint8_t
+{
+  Input,     // InputController::update()
+  Leds,      // LEDController::update()
+  LedShow,   // LEDController::flush() encoding and starting a frame
+  Display,   // DisplayController draw calls and animation frames
+  OledFlush, // oled.present(): the hand-over, or the whole transfer when synchronous
+  Network,   // NetworkController::update()
+  Count
+};
+
+class LatencyHistogram
+{
+public:
+  LatencyHistogram();
+
+  void record(uint32_t micros);
+  void reset();
+
+  uint32_t getCount() const { return count; }
+  uint32_t getMax() const { return max; }
+  uint32_t getPercentile(float fraction) const; // Upper bound of the bucket holding that sample
+
+private:
+  uint32_t buckets[METRICS_BUCKETS];
+  uint32_t count;
+  uint32_t max;
+
+  static uint8_t bucketFor(uint32_t micros);
+  static uint32_t bucketUpperBound(uint8_t bucket);
+};
+
+// Loop latency metrics, timed with the CPU cycle counter. Recording happens
+// on the loop task only; readers on other tasks (the web server) may see a
+// histogram mid-update, which is fine for diagnostics.
+class Metrics
+{
+public:
+  Metrics();
+
+  void begin();
+
+  static inline uint32_t cycles() { return ESP.getCycleCount(); }
+
+  void record(Metric metric, uint32_t startCycles);
+  void recordState(const char *stateName, uint32_t startCycles);
+  void reset();
+
+  void writeJson(JsonObject root) const;
+  void printReport() const;
+
+  static const char *metricName(Metric metric);
+
+private:
+  uint32_t cyclesPerMicro;
+  LatencyHistogram controllers[(size_t)Metric::Count];
+  LatencyHistogram states[METRICS_MAX_STATES];
+  const char *stateNames[METRICS_MAX_STATES];
+  uint8_t stateCount;
+
+  uint32_t elapsedMicros(uint32_t startCycles) const;
+  static void writeHistogram(JsonObject object, const char *name, const LatencyHistogram &histogram);
+  static void printHistogram(const char *kind, const char *name, const LatencyHistogram &histogram);
+};
+
+extern Metrics metrics;
+
+// Heap allocations since boot (malloc, calloc, realloc; operator new and
+// String go through malloc), counted by the linker wraps in HeapCounter.cpp.
+// 0 unless built with FOCUS_DIAL_HEAP_COUNTER (the _diag env).
+// Every task adds to it, so no change across a code path proves that path
+// allocation-free; a change is an upper bound.
+uint32_t heapAllocationCount();
+
+// Times the enclosing scope into one metric
+class MetricScope
+{
+public:
+  explicit MetricScope(Metric metric) : metric(metric), start(Metrics::cycles()) {}
+  ~MetricScope() { metrics.record(metric, start); }
+
+private:
+  Metric metric;
+  uint32_t start;
+};
@@ -4,17 +4,16 @@
 #include <Arduino.h>
 #include <vector>
 
-// Maximum number of projects that can be stored
-const int MAX_PROJECTS = 20;
+// Most projects the NVS JSON list held. The catalog that replaced it has no
+// fixed limit; it stops when the data partition is full (about 50 bytes of
+// flash a project, see ProjectManager::addProject).
+const int MAX_NVS_PROJECTS = 20;
 
-// NVS key for storing the JSON string representing the list of projects
-extern const char *NVS_PROJECTS_KEY;
-
-// NVS key for storing the index of the last selected project
-extern const char *NVS_LAST_PROJECT_KEY;
+// Longest project name in bytes (stored with a one-byte length)
+const int MAX_PROJECT_NAME_BYTES = 255;
 
-// NVS key for storing the next project ID counter
-extern const char *NVS_PROJECT_ID_COUNTER_KEY;
+// NVS key of the JSON project list used before the catalog; migrated at boot
+extern const char *NVS_PROJECTS_KEY;
 
 // Represents a single project with a name and associated color (hex string)
 struct Project
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define SCHEDULER_MAX_SLEEP_MS 1000          // Longest single block, bounds anything that forgets to report
+#define SCHEDULER_REPORT_INTERVAL_MS 300000  // Serial stats every 5 minutes
+
+// Cumulative since boot; take differences for a window
+struct SchedulerStats
+{
+  uint32_t passes;        // loop() passes
+  uint32_t timedWakeups;  // Woke because the earliest deadline was reached
+  uint32_t eventWakeups;  // Woken early by an ISR or another task
+  uint64_t idleMicros;    // Time blocked in sleep()
+  uint64_t busyMicros;    // Time spent running loop() passes
+  uint64_t jitterTotalUs; // Sum of |actual - deadline| over timed wake-ups
+  uint32_t jitterMaxUs;   // Worst timed wake-up
+};
+
+// Deadline-driven pacing for the main loop. Every pass, the controllers and
+// the active state call wakeAt() with the next time they have work to do;
+// sleep() then blocks the loop task on a task notification until the earliest
+// of those deadlines. Inputs and state changes call wake()/wakeFromISR() so
+// they are handled immediately instead of waiting for the deadline.
+class Scheduler
+{
+public:
+  Scheduler();
+
+  void begin(); // Must be called from the loop task
+
+  // Deadlines, in millis(); the earliest one reported during a pass wins
+  void wakeAt(unsigned long deadlineMs);
+  void wakeIn(unsigned long delayMs);
+
+  // Run the next pass as soon as possible
+  void wake();
+  static void IRAM_ATTR wakeFromISR();
+
+  // Block until the earliest deadline or a wake-up; call at the end of loop()
+  void sleep();
+
+  SchedulerStats getStats() const;
+  float getIdlePercent() const;
+  void printStats();
+
+private:
+  static TaskHandle_t loopTask;
+
+  unsigned long nextDeadline;
+  bool hasDeadline;
+  unsigned long passStartMicros;
+  unsigned long lastReportTime;
+  SchedulerStats stats;
+};
+
+extern Scheduler scheduler;
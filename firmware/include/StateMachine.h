@@ -27,6 +27,7 @@ public:
   void update();
   void changeState(State *newState);
   State *getCurrentState() const;
+  static const char *getStateName(const State *state);
 
   // Static states
   static AdjustState adjustState;
@@ -48,9 +49,13 @@ public:
 
   // Methods to pass selected project info
   void setPendingProjectId(const String &projectId);
-  String getPendingProjectId() const;
+  const String &getPendingProjectId() const;
   void clearPendingProject();
 
+  // The timer being run, paused or just finished: its length (0 when it
+  // counts up) and how far it got, in seconds. false in any other state.
+  bool getTimerProgress(uint32_t &durationSeconds, uint32_t &elapsedSeconds) const;
+
   // New methods for LED color preview
   bool isInIdleState() const;
   void resetLEDColor();
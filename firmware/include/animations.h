@@ -0,0 +1,769 @@
+#pragma once
+
+// Generated by firmware/tools/pack_animation.py from firmware/animations; don't edit.
+// Delta + PackBits frames, as AnimationDecoder.h describes.
+
+#include "AnimationDecoder.h"
+
+// 48x48, 18 frames: 5184 bytes raw, 905 packed
+static const uint8_t PROGMEM animation_cancel_data[] = {
+    0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x01, 0x82, 0x00, 0x3B, 0x80, 0x03, 0x80, 0x00, 0x00,
+    0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x80, 0x01,
+    0xC0, 0x00, 0x00, 0x01, 0xC0, 0x03, 0x80, 0x81, 0x00, 0x01, 0xE0, 0x07, 0x82, 0x00, 0x01, 0x70,
+    0x0E, 0x82, 0x00, 0x01, 0x38, 0x1C, 0x82, 0x00, 0x01, 0x1C, 0x38, 0x82, 0x00, 0x01, 0x0E, 0x70,
+    0x82, 0x00, 0x01, 0x07, 0xE0, 0x82, 0x00, 0x01, 0x03, 0xC0, 0x82, 0x00, 0x01, 0x03, 0xC0, 0x82,
+    0x00, 0x01, 0x07, 0xE0, 0x82, 0x00, 0x01, 0x0E, 0x70, 0x82, 0x00, 0x01, 0x1C, 0x38, 0x82, 0x00,
+    0x01, 0x38, 0x1C, 0x82, 0x00, 0x01, 0x70, 0x0E, 0x82, 0x00, 0x01, 0xE0, 0x07, 0x81, 0x00, 0x3B,
+    0x01, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00,
+    0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00, 0x01,
+    0xC0, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x01, 0x82, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x03, 0x80, 0x82,
+    0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x00, 0xE0, 0x83, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0xFC,
+    0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x30, 0x83, 0x00, 0x00, 0x38, 0x83, 0x00, 0x00, 0x1C, 0x83,
+    0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x01, 0x01,
+    0xC0, 0x83, 0x00, 0x00, 0xE0, 0x83, 0x00, 0x00, 0x70, 0x81, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x38, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x00,
+    0x07, 0x83, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0xE0, 0x83, 0x00, 0x00,
+    0x70, 0x83, 0x00, 0x00, 0x38, 0x83, 0x00, 0x02, 0x1C, 0x00, 0x00, 0xC0, 0x07, 0x00, 0xE0, 0x3F,
+    0x00, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00, 0x01, 0x01, 0xC0, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82,
+    0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x02, 0x82, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x07, 0x83,
+    0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x01, 0x01, 0xC0, 0x83, 0x00, 0x00, 0xE0, 0x83, 0x00, 0x00,
+    0x70, 0x83, 0x00, 0x00, 0x38, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x01, 0x0C, 0x00, 0x00, 0xFC,
+    0x0F, 0x00, 0xE0, 0x03, 0x82, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x38,
+    0x83, 0x00, 0x00, 0x70, 0x83, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x01, 0x01, 0xC0, 0x82, 0x00, 0x01,
+    0x03, 0x80, 0x82, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x04, 0x84, 0x00,
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x01, 0x01, 0xC0,
+    0x83, 0x00, 0x00, 0x80, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x08, 0x83, 0x00,
+    0x00, 0x18, 0x83, 0x00, 0x00, 0x38, 0x83, 0x00, 0x00, 0x70, 0x83, 0x00, 0x00, 0xE0, 0x82, 0x00,
+    0x01, 0x01, 0xC0, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0E,
+    0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x3F, 0x00, 0x80, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0xE0,
+    0x82, 0x00, 0x01, 0x01, 0xC0, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x00, 0x07, 0x83, 0x00,
+    0x00, 0x0E, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x38, 0x83, 0x00, 0x00, 0x30, 0x82, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x01, 0x00, 0x40, 0x83, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x01,
+    0x01, 0xC0, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x01, 0x82, 0x00, 0x3B, 0x80, 0x03, 0x80, 0x00,
+    0x00, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0x80,
+    0x01, 0xC0, 0x00, 0x00, 0x01, 0xC0, 0x03, 0x80, 0x81, 0x00, 0x01, 0xE0, 0x07, 0x82, 0x00, 0x01,
+    0x70, 0x0E, 0x82, 0x00, 0x01, 0x38, 0x1C, 0x82, 0x00, 0x01, 0x1C, 0x38, 0x82, 0x00, 0x01, 0x0E,
+    0x70, 0x82, 0x00, 0x01, 0x07, 0xE0, 0x82, 0x00, 0x01, 0x03, 0xC0, 0x82, 0x00, 0x01, 0x03, 0xC0,
+    0x82, 0x00, 0x01, 0x07, 0xE0, 0x82, 0x00, 0x01, 0x0E, 0x70, 0x82, 0x00, 0x01, 0x1C, 0x38, 0x82,
+    0x00, 0x01, 0x38, 0x1C, 0x82, 0x00, 0x01, 0x70, 0x0E, 0x82, 0x00, 0x01, 0xE0, 0x07, 0x81, 0x00,
+    0x3B, 0x01, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38,
+    0x00, 0x00, 0x1C, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00,
+    0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x01, 0x82, 0x00, 0x00,
+    0x80,
+};
+static const uint16_t PROGMEM animation_cancel_deltas[] = {
+    0, 208, 214, 220, 226, 254, 299, 347, 414, 484, 542, 592,
+    621, 627, 633, 639, 645, 651, 657, 865,
+};
+static const PackedAnimation animation_cancel = {48, 48, 18, animation_cancel_deltas, animation_cancel_data};
+
+// 48x48, 28 frames: 8064 bytes raw, 3417 packed
+static const uint8_t PROGMEM animation_reset_data[] = {
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x1F, 0xFC, 0x82, 0x00, 0x80, 0xFF, 0x81,
+    0x00, 0x09, 0x03, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x83, 0x00, 0x27, 0x78,
+    0x00, 0x07, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0x07, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x03, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x01, 0x80, 0x03,
+    0xB0, 0x00, 0x00, 0x01, 0xCC, 0x03, 0x38, 0x81, 0x00, 0x07, 0xDC, 0x07, 0x18, 0x00, 0x00, 0x0E,
+    0xFC, 0x06, 0x81, 0x00, 0x02, 0x0F, 0xF8, 0x0E, 0x81, 0x00, 0x02, 0x07, 0xF8, 0x0E, 0x81, 0x00,
+    0x02, 0x01, 0xF0, 0x0C, 0x82, 0x00, 0x01, 0x70, 0x0C, 0x83, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x00,
+    0x0C, 0x82, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x30, 0x0C,
+    0x82, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x70, 0x06, 0x82,
+    0x00, 0x01, 0x70, 0x06, 0x82, 0x00, 0x01, 0x60, 0x07, 0x82, 0x00, 0x01, 0xE0, 0x03, 0x82, 0x00,
+    0x2F, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x03, 0x80, 0x01, 0xC0,
+    0x00, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x3C, 0x03, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x0F, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x1E, 0x01,
+    0xF0, 0x81, 0x00, 0x02, 0x78, 0x07, 0xC0, 0x81, 0x00, 0x01, 0x7F, 0xFF, 0x82, 0x00, 0x01, 0x3F,
+    0xF8, 0x82, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x00,
+    0x04, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x5D, 0x00, 0x80, 0xF6, 0x01, 0x00, 0x04, 0x82, 0x00,
+    0x00, 0x07, 0x83, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x04, 0x83, 0x00, 0x02, 0x10, 0x00, 0x08,
+    0x83, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x01,
+    0x84, 0x00, 0x00, 0x50, 0x83, 0x00, 0x03, 0x10, 0x00, 0x00, 0x08, 0x82, 0x00, 0x01, 0x02, 0x44,
+    0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x02,
+    0x83, 0x00, 0x00, 0x02, 0x81, 0x00, 0xC0, 0xEF, 0x5F, 0x20, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x10,
+    0x82, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0xF0, 0x83, 0x00, 0x00, 0x10,
+    0x83, 0x00, 0x00, 0x10, 0x87, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x05, 0x24,
+    0x00, 0x20, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00,
+    0x90, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x04, 0x10, 0x00, 0x00, 0x02,
+    0x80, 0x83, 0x00, 0x00, 0x80, 0x81, 0x00, 0x01, 0x01, 0x11, 0x82, 0x00, 0x01, 0x01, 0x20, 0x83,
+    0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x02, 0x83,
+    0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x04, 0x81, 0x00, 0x10, 0xF5, 0x2F, 0x10, 0x81, 0xE3, 0x81,
+    0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x01, 0x0E, 0x10,
+    0x83, 0x00, 0x00, 0x10, 0x87, 0x00, 0x01, 0x20, 0x04, 0x88, 0x00, 0x02, 0x08, 0x00, 0x20, 0x82,
+    0x00, 0x00, 0x08, 0x81, 0x00, 0x01, 0x02, 0x10, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x01, 0x10,
+    0x02, 0x88, 0x00, 0x03, 0x20, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x88, 0x83, 0x00, 0x01, 0x82,
+    0x08, 0x82, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x81, 0x00, 0x10,
+    0xF5, 0x2E, 0x10, 0x01, 0x21, 0x81, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00,
+    0x04, 0x83, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00, 0x10, 0x87, 0x00, 0x01, 0x20, 0x04, 0x84, 0x00,
+    0x00, 0x20, 0x82, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00,
+    0x01, 0x10, 0x02, 0x88, 0x00, 0x03, 0x20, 0x00, 0x00, 0x88, 0x83, 0x00, 0x00, 0x08, 0x81, 0x00,
+    0xC0, 0xFF, 0x5F, 0x20, 0xC0, 0xDF, 0x80, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x08, 0x83, 0x00,
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x70, 0x83, 0x00, 0x00, 0x10, 0x82, 0x00, 0x01, 0x08, 0x10, 0x82,
+    0x00, 0x01, 0x0C, 0x10, 0x87, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x20,
+    0x82, 0x00, 0x01, 0x01, 0x08, 0x82, 0x00, 0x80, 0x08, 0x82, 0x00, 0x00, 0x02, 0x84, 0x00, 0x00,
+    0x90, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00,
+    0x80, 0x82, 0x00, 0x00, 0x04, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0xA2, 0x08, 0x82,
+    0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x00, 0x03, 0x81, 0x00, 0x90, 0xFF, 0xBF, 0xA0, 0xCC, 0x7F, 0x81, 0x00, 0x00, 0x04, 0x81,
+    0x00, 0x01, 0x06, 0x80, 0x82, 0x00, 0x00, 0x1C, 0x82, 0x00, 0x07, 0x03, 0x88, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x08, 0x82, 0x00, 0x01, 0x07, 0x08, 0x83, 0x00, 0x00, 0x08, 0x81, 0x00, 0x02, 0x80,
+    0x00, 0x48, 0x87, 0x00, 0x02, 0x1C, 0x00, 0x20, 0x81, 0x00, 0x06, 0x14, 0x00, 0x30, 0x00, 0x00,
+    0x0C, 0x84, 0x83, 0x00, 0x01, 0x84, 0x08, 0x81, 0x00, 0x01, 0x04, 0x08, 0x82, 0x00, 0x01, 0x01,
+    0x08, 0x83, 0x00, 0x00, 0xD0, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x01,
+    0x10, 0x01, 0x87, 0x00, 0x02, 0x02, 0x00, 0x01, 0x84, 0x00, 0x01, 0x04, 0x01, 0x82, 0x00, 0x02,
+    0x02, 0x00, 0x80, 0x81, 0x00, 0x07, 0x02, 0x31, 0x01, 0x10, 0x00, 0x00, 0x02, 0xC4, 0x83, 0x00,
+    0x00, 0x80, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x24, 0x83, 0x00, 0x00, 0x12, 0x83, 0x00,
+    0x00, 0x0A, 0x81, 0x00, 0xE0, 0xFF, 0xFF, 0x93, 0x8D, 0x7F, 0x82, 0x00, 0x04, 0x80, 0x00, 0x00,
+    0x03, 0x10, 0x82, 0x00, 0x00, 0x7F, 0x82, 0x00, 0x01, 0x01, 0xE6, 0x82, 0x00, 0x07, 0x02, 0x04,
+    0x00, 0x00, 0x20, 0x00, 0x07, 0x84, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x24, 0x81, 0x00,
+    0x02, 0x80, 0x00, 0x60, 0x83, 0x00, 0x00, 0x30, 0x82, 0x00, 0x01, 0x04, 0x10, 0x81, 0x00, 0x00,
+    0x0C, 0x82, 0x00, 0x01, 0x02, 0x9C, 0x82, 0x00, 0x01, 0x07, 0x18, 0x82, 0x00, 0x01, 0x04, 0x96,
+    0x82, 0x00, 0x01, 0x02, 0x04, 0x82, 0x00, 0x01, 0x01, 0x0C, 0x83, 0x00, 0x00, 0xC8, 0x83, 0x00,
+    0x00, 0x78, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x01, 0x30, 0x02, 0x83,
+    0x00, 0x00, 0x01, 0x88, 0x00, 0x00, 0x20, 0x82, 0x00, 0x02, 0x02, 0x00, 0x01, 0x84, 0x00, 0x01,
+    0x04, 0x3B, 0x82, 0x00, 0x08, 0x0F, 0xC2, 0x01, 0x10, 0x00, 0x00, 0x03, 0x08, 0x08, 0x81, 0x00,
+    0x00, 0x01, 0x84, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x48, 0x83, 0x00, 0x00, 0x2C, 0x83, 0x00,
+    0x00, 0x1C, 0x81, 0x00, 0xF0, 0xBF, 0xFE, 0x1F, 0xE1, 0x7F, 0x81, 0x00, 0x00, 0x04, 0x82, 0x00,
+    0x06, 0xE0, 0x00, 0x80, 0x00, 0x00, 0x7F, 0x70, 0x82, 0x00, 0x01, 0x01, 0x80, 0x81, 0x00, 0x01,
+    0x01, 0xE1, 0x82, 0x00, 0x07, 0x01, 0xC3, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0B, 0x83, 0x00, 0x00,
+    0x1A, 0x83, 0x00, 0x00, 0x1A, 0x81, 0x00, 0x02, 0x80, 0x00, 0x58, 0x82, 0x00, 0x00, 0x04, 0x88,
+    0x00, 0x01, 0x04, 0x08, 0x81, 0x00, 0x01, 0x03, 0x0E, 0x82, 0x00, 0x01, 0x03, 0xCC, 0x82, 0x00,
+    0x01, 0x02, 0xCA, 0x82, 0x00, 0x01, 0x03, 0x46, 0x82, 0x00, 0x01, 0x01, 0x84, 0x83, 0x00, 0x00,
+    0xCC, 0x83, 0x00, 0x00, 0x78, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x01,
+    0x30, 0x02, 0x82, 0x00, 0x00, 0x70, 0x83, 0x00, 0x02, 0x20, 0x00, 0x10, 0x83, 0x00, 0x01, 0x38,
+    0xF0, 0x82, 0x00, 0x01, 0x17, 0xC4, 0x82, 0x00, 0x08, 0x04, 0x7C, 0x00, 0x10, 0x00, 0x00, 0x04,
+    0x00, 0x08, 0x81, 0x00, 0x00, 0x02, 0x83, 0x00, 0x01, 0x01, 0x40, 0x82, 0x00, 0x01, 0x01, 0xB0,
+    0x83, 0x00, 0x00, 0xF0, 0x83, 0x00, 0x00, 0x10, 0x81, 0x00, 0xF0, 0xBF, 0xFC, 0xFF, 0xF8, 0x3F,
+    0x03, 0x00, 0x1F, 0x18, 0x04, 0x81, 0x00, 0x07, 0x1F, 0xF8, 0x00, 0x80, 0x00, 0x00, 0x7C, 0x60,
+    0x82, 0x00, 0x01, 0x70, 0x60, 0x83, 0x00, 0x00, 0xC0, 0x82, 0x00, 0x07, 0x06, 0x80, 0x00, 0x20,
+    0x00, 0x00, 0x04, 0x80, 0x82, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x06, 0x81, 0x00, 0x02, 0x80,
+    0x00, 0x40, 0x82, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x08, 0x88, 0x00, 0x00, 0x40, 0x82, 0x00,
+    0x01, 0x03, 0x06, 0x82, 0x00, 0x01, 0x03, 0x8E, 0x82, 0x00, 0x01, 0x02, 0x4C, 0x82, 0x00, 0x01,
+    0x01, 0x4A, 0x82, 0x00, 0x01, 0x01, 0x86, 0x83, 0x00, 0x00, 0xCE, 0x83, 0x00, 0x00, 0x6C, 0x83,
+    0x00, 0x01, 0x78, 0x02, 0x82, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x60,
+    0x83, 0x00, 0x02, 0x20, 0x00, 0x40, 0x83, 0x00, 0x00, 0xE0, 0x83, 0x00, 0x01, 0x5F, 0xC0, 0x82,
+    0x00, 0x01, 0x3F, 0x30, 0x82, 0x00, 0x01, 0x11, 0x78, 0x82, 0x00, 0x08, 0x18, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x08, 0x00, 0x08, 0x81, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x01, 0x07, 0xA0, 0x82, 0x00,
+    0x01, 0x05, 0xC0, 0x83, 0x00, 0x00, 0xC0, 0x81, 0x00, 0xFC, 0xBF, 0xC9, 0xFF, 0xFF, 0x1F, 0x02,
+    0x00, 0x01, 0x80, 0x82, 0x00, 0x01, 0x03, 0xE0, 0x82, 0x00, 0x01, 0x1E, 0xFB, 0x82, 0x00, 0x03,
+    0x1F, 0x1B, 0x00, 0x80, 0x81, 0x00, 0x00, 0x18, 0x82, 0x00, 0x01, 0x08, 0x98, 0x82, 0x00, 0x01,
+    0x01, 0xB0, 0x82, 0x00, 0x07, 0x01, 0x60, 0x00, 0x20, 0x00, 0x00, 0x03, 0xC0, 0x82, 0x00, 0x00,
+    0x01, 0x87, 0x00, 0x02, 0x80, 0x00, 0x40, 0x82, 0x00, 0x00, 0x04, 0x88, 0x00, 0x00, 0x80, 0x83,
+    0x00, 0x00, 0x40, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x01, 0x01, 0x86, 0x83, 0x00, 0x00,
+    0xCE, 0x82, 0x00, 0x01, 0x01, 0x4E, 0x82, 0x00, 0x01, 0x01, 0xCE, 0x82, 0x00, 0x02, 0x01, 0x86,
+    0x02, 0x82, 0x00, 0x00, 0xCE, 0x83, 0x00, 0x00, 0xF8, 0x83, 0x00, 0x01, 0x70, 0x01, 0x82, 0x00,
+    0x00, 0xA0, 0x83, 0x00, 0x0E, 0xC0, 0x01, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x01, 0x80, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x70, 0x83, 0x00, 0x00, 0xFF, 0x83, 0x00, 0x01, 0x40, 0xC0, 0x82, 0x00, 0x01,
+    0x47, 0xC0, 0x82, 0x00, 0x01, 0x60, 0x80, 0x82, 0x00, 0x08, 0x20, 0x00, 0x01, 0x10, 0x00, 0x00,
+    0x3C, 0x00, 0x08, 0x81, 0x00, 0x00, 0x3D, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x04, 0x82,
+    0x00, 0xFE, 0x37, 0x05, 0xFF, 0xFF, 0x0F, 0x80, 0x00, 0x00, 0x30, 0x82, 0x00, 0x01, 0x01, 0xBC,
+    0x82, 0x00, 0x01, 0x03, 0xFF, 0x82, 0x00, 0x02, 0x01, 0xE3, 0x74, 0x82, 0x00, 0x01, 0x03, 0x60,
+    0x82, 0x00, 0x00, 0x17, 0x82, 0x00, 0x01, 0x08, 0xF6, 0x83, 0x00, 0x00, 0x6C, 0x83, 0x00, 0x02,
+    0xF8, 0x00, 0x20, 0x81, 0x00, 0x00, 0x40, 0x86, 0x00, 0x02, 0x80, 0x00, 0x40, 0x87, 0x00, 0x01,
+    0x80, 0x08, 0x87, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x01, 0x01, 0x82,
+    0x82, 0x00, 0x01, 0x02, 0xCE, 0x82, 0x00, 0x01, 0x03, 0x8E, 0x82, 0x00, 0x02, 0x03, 0x08, 0x02,
+    0x81, 0x00, 0x02, 0x01, 0x9C, 0x06, 0x81, 0x00, 0x01, 0x01, 0x9C, 0x82, 0x00, 0x1B, 0x01, 0xF8,
+    0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xF8, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0C, 0x00, 0x00,
+    0x03, 0x80, 0x01, 0x17, 0x00, 0x00, 0x01, 0x00, 0x01, 0x8F, 0x82, 0x00, 0x01, 0x01, 0xC4, 0x82,
+    0x00, 0x01, 0x01, 0xE0, 0x83, 0x00, 0x06, 0x30, 0x00, 0x01, 0x10, 0x00, 0x00, 0x30, 0x83, 0x00,
+    0x00, 0x30, 0x84, 0x00, 0x00, 0x20, 0x81, 0x00, 0xFE, 0x03, 0x0C, 0xF8, 0xFF, 0x0E, 0x80, 0x00,
+    0x00, 0x33, 0x83, 0x00, 0x01, 0x3F, 0xC0, 0x82, 0x00, 0x01, 0x1E, 0xE0, 0x83, 0x00, 0x00, 0x7C,
+    0x83, 0x00, 0x00, 0x66, 0x82, 0x00, 0x01, 0x1E, 0xEC, 0x82, 0x00, 0x01, 0x0D, 0xC0, 0x82, 0x00,
+    0x00, 0x1F, 0x83, 0x00, 0x04, 0x18, 0x00, 0x20, 0x00, 0x08, 0x88, 0x00, 0x01, 0x40, 0x0C, 0x81,
+    0x00, 0x02, 0x03, 0x00, 0x0C, 0x81, 0x00, 0x00, 0x03, 0x83, 0x00, 0x02, 0x05, 0x90, 0x03, 0x81,
+    0x00, 0x33, 0x07, 0x8C, 0x07, 0xC0, 0x00, 0x00, 0x07, 0x1C, 0x04, 0xF0, 0x00, 0x00, 0x07, 0x38,
+    0x04, 0x10, 0x00, 0x00, 0x06, 0x28, 0x06, 0x58, 0x00, 0x00, 0x07, 0x78, 0x06, 0x3C, 0x00, 0x00,
+    0x07, 0xF0, 0x07, 0x08, 0x00, 0x00, 0x05, 0x80, 0x05, 0x80, 0x00, 0x00, 0x0E, 0x00, 0x01, 0x84,
+    0x00, 0x00, 0x0C, 0x00, 0x01, 0x80, 0x85, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+    0x00, 0x20, 0x81, 0x00, 0xFE, 0x31, 0x0C, 0xFB, 0xFF, 0x0F, 0x80, 0x00, 0x01, 0x03, 0x70, 0x82,
+    0x00, 0x01, 0x03, 0xF8, 0x82, 0x00, 0x01, 0x01, 0xFC, 0x83, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x00,
+    0x07, 0x82, 0x00, 0x08, 0x11, 0xFC, 0xC0, 0x00, 0x00, 0x08, 0x83, 0x3D, 0x80, 0x81, 0x00, 0x02,
+    0x03, 0x60, 0x40, 0x84, 0x00, 0x02, 0x80, 0x00, 0x40, 0x82, 0x00, 0x00, 0x08, 0x88, 0x00, 0x01,
+    0x40, 0x0C, 0x83, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x0F, 0x83, 0x00,
+    0x24, 0x09, 0xC0, 0x00, 0x00, 0x06, 0x10, 0x18, 0xE0, 0x00, 0x00, 0x06, 0x00, 0x19, 0x20, 0x00,
+    0x00, 0x02, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x0A, 0x00, 0x1C, 0x70, 0x00, 0x00, 0x0A, 0x08, 0x06,
+    0x20, 0x00, 0x00, 0x0A, 0x78, 0x07, 0x81, 0x00, 0x02, 0x18, 0x70, 0x06, 0x81, 0x00, 0x02, 0x1C,
+    0x80, 0x04, 0x81, 0x00, 0x01, 0x1F, 0xE0, 0x82, 0x00, 0x01, 0x0F, 0xC0, 0x82, 0x00, 0x00, 0x60,
+    0x83, 0x00, 0x00, 0x30, 0x82, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x20,
+    0x81, 0x00, 0xFE, 0x33, 0x68, 0xFF, 0xFF, 0x07, 0x81, 0x00, 0x00, 0x72, 0x83, 0x00, 0x00, 0x3E,
+    0x83, 0x00, 0x00, 0x1F, 0x83, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00,
+    0x07, 0x10, 0xC0, 0x00, 0x00, 0x08, 0x80, 0xFB, 0x90, 0x82, 0x00, 0x01, 0x7F, 0xB8, 0x82, 0x00,
+    0x01, 0x18, 0x10, 0x84, 0x00, 0x02, 0x80, 0x00, 0x40, 0x87, 0x00, 0x01, 0x40, 0x0C, 0x83, 0x00,
+    0x00, 0x0C, 0x83, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x1F, 0x83, 0x00, 0x00, 0x13, 0x83, 0x00,
+    0x01, 0x31, 0x80, 0x82, 0x00, 0x01, 0x32, 0xC0, 0x82, 0x00, 0x00, 0x39, 0x83, 0x00, 0x01, 0x39,
+    0xE0, 0x82, 0x00, 0x06, 0x19, 0xE0, 0x00, 0x00, 0x04, 0x00, 0x18, 0x81, 0x00, 0x02, 0x0C, 0x00,
+    0x18, 0x81, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x02, 0x3E, 0x00, 0x01, 0x81, 0x00, 0x00, 0x2C, 0x83,
+    0x00, 0x00, 0x28, 0x83, 0x00, 0x07, 0x61, 0xE0, 0x00, 0x04, 0x00, 0x00, 0x63, 0xC0, 0x82, 0x00,
+    0x00, 0x67, 0x82, 0x00, 0x01, 0x01, 0x3F, 0x82, 0x00, 0x01, 0x09, 0xDE, 0x82, 0x00, 0x02, 0x01,
+    0x00, 0x00, 0xFE, 0x2F, 0xEC, 0x7F, 0xFC, 0x0F, 0x81, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x06,
+    0x83, 0x00, 0x01, 0x03, 0x60, 0x82, 0x00, 0x01, 0x07, 0xE0, 0x83, 0x00, 0x00, 0xE0, 0x81, 0x00,
+    0x02, 0x10, 0x00, 0x30, 0x82, 0x00, 0x01, 0x06, 0x10, 0x82, 0x00, 0x01, 0x1E, 0x78, 0x82, 0x00,
+    0x01, 0x1F, 0xF4, 0x82, 0x00, 0x01, 0x03, 0x0E, 0x83, 0x00, 0x03, 0x04, 0x00, 0x00, 0x40, 0x82,
+    0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x0A, 0x83, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x1E, 0x83,
+    0x00, 0x00, 0x33, 0x83, 0x00, 0x00, 0x31, 0x83, 0x00, 0x01, 0x62, 0x80, 0x82, 0x00, 0x01, 0x72,
+    0x80, 0x82, 0x00, 0x01, 0x33, 0x80, 0x82, 0x00, 0x01, 0x31, 0xC0, 0x82, 0x00, 0x01, 0x30, 0xC0,
+    0x81, 0x00, 0x01, 0x10, 0x20, 0x87, 0x00, 0x00, 0x32, 0x83, 0x00, 0x00, 0x70, 0x83, 0x00, 0x00,
+    0xD0, 0x83, 0x00, 0x06, 0xB0, 0x00, 0x00, 0x04, 0x00, 0x01, 0xA0, 0x82, 0x00, 0x01, 0x01, 0x87,
+    0x82, 0x00, 0x01, 0x03, 0x0F, 0x82, 0x00, 0x01, 0x0D, 0xEE, 0x82, 0x00, 0x01, 0x0D, 0xF8, 0x81,
+    0x00, 0x03, 0x20, 0x08, 0x38, 0x00, 0xF8, 0xFF, 0xFD, 0x27, 0xFC, 0x1F, 0x82, 0x00, 0x00, 0x60,
+    0x82, 0x00, 0x01, 0x04, 0x68, 0x83, 0x00, 0x00, 0x6C, 0x81, 0x00, 0x02, 0x10, 0x00, 0x3C, 0x83,
+    0x00, 0x00, 0x0C, 0x82, 0x00, 0x01, 0x01, 0x84, 0x82, 0x00, 0x01, 0x07, 0xC6, 0x82, 0x00, 0x01,
+    0x02, 0xFE, 0x83, 0x00, 0x00, 0xFD, 0x83, 0x00, 0x08, 0x03, 0x80, 0x00, 0x40, 0x00, 0x00, 0x01,
+    0x80, 0x02, 0x81, 0x00, 0x02, 0x01, 0x00, 0x03, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0E,
+    0x83, 0x00, 0x00, 0x1A, 0x82, 0x00, 0x01, 0x40, 0x33, 0x83, 0x00, 0x00, 0x71, 0x83, 0x00, 0x01,
+    0x63, 0x80, 0x82, 0x00, 0x01, 0x72, 0x80, 0x82, 0x00, 0x01, 0x32, 0x80, 0x82, 0x00, 0x01, 0x71,
+    0x80, 0x82, 0x00, 0x01, 0x61, 0x80, 0x87, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x02, 0x83, 0x00,
+    0x00, 0x40, 0x83, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x07, 0x03, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x06,
+    0xC0, 0x82, 0x00, 0x01, 0x06, 0x80, 0x82, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x01, 0x1C, 0x30, 0x82,
+    0x00, 0x01, 0x6C, 0xF8, 0x81, 0x00, 0x02, 0x20, 0x6F, 0xF8, 0x82, 0x00, 0x02, 0x03, 0xC0, 0x00,
+    0xF0, 0xFF, 0xFF, 0x31, 0xE1, 0x7F, 0x80, 0x00, 0x02, 0x10, 0x04, 0x08, 0x83, 0x00, 0x00, 0x8C,
+    0x81, 0x00, 0x02, 0x10, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x0F, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00,
+    0x00, 0x01, 0x82, 0x00, 0x01, 0x01, 0xF1, 0x83, 0x00, 0x02, 0x81, 0x80, 0x01, 0x81, 0x00, 0x09,
+    0x3F, 0x80, 0x01, 0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x80, 0x81, 0x00, 0x01, 0xC0, 0x07, 0x82,
+    0x00, 0x01, 0xC0, 0x0F, 0x82, 0x00, 0x01, 0x80, 0x19, 0x83, 0x00, 0x01, 0x31, 0x80, 0x82, 0x00,
+    0x01, 0x61, 0x80, 0x81, 0x00, 0x02, 0x40, 0x32, 0x80, 0x82, 0x00, 0x01, 0x72, 0x80, 0x82, 0x00,
+    0x01, 0x71, 0x80, 0x82, 0x00, 0x01, 0x41, 0x80, 0x82, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x00,
+    0x02, 0x88, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00,
+    0x0B, 0x83, 0x00, 0x00, 0x1B, 0x83, 0x00, 0x00, 0x36, 0x83, 0x00, 0x00, 0x60, 0x82, 0x00, 0x01,
+    0x03, 0x60, 0x82, 0x00, 0x02, 0x23, 0x67, 0xC0, 0x82, 0x00, 0x01, 0x3D, 0xC0, 0x82, 0x00, 0x00,
+    0x0E, 0x83, 0x00, 0x02, 0x06, 0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x30, 0xE9, 0x7F, 0x80, 0x00, 0x01,
+    0x10, 0x04, 0x84, 0x00, 0x00, 0x80, 0x81, 0x00, 0x02, 0x10, 0x00, 0x01, 0x83, 0x00, 0x00, 0x03,
+    0x83, 0x00, 0x01, 0x03, 0x40, 0x82, 0x00, 0x15, 0x03, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x01, 0xC0,
+    0x00, 0xE0, 0x00, 0x00, 0x78, 0x40, 0x00, 0x40, 0x00, 0x00, 0x34, 0x40, 0x03, 0x80, 0x81, 0x00,
+    0x0E, 0x40, 0x06, 0x80, 0x00, 0x00, 0x1F, 0xC0, 0x18, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x30, 0x80,
+    0x81, 0x00, 0x02, 0xE0, 0x28, 0xC0, 0x81, 0x00, 0x02, 0x60, 0x31, 0x40, 0x81, 0x00, 0x02, 0x40,
+    0x71, 0x40, 0x81, 0x00, 0x01, 0x40, 0x01, 0x83, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x00, 0x02,
+    0x88, 0x00, 0x00, 0x10, 0x83, 0x00, 0x01, 0x20, 0x01, 0x86, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00,
+    0x1C, 0x83, 0x00, 0x00, 0x64, 0x83, 0x00, 0x00, 0xC8, 0x82, 0x00, 0x01, 0x11, 0xB8, 0x82, 0x00,
+    0x00, 0x0F, 0x83, 0x00, 0x00, 0x1F, 0x83, 0x00, 0x01, 0x01, 0xDE, 0x83, 0x00, 0x00, 0x7E, 0x83,
+    0x00, 0x02, 0x3E, 0x00, 0x00, 0x50, 0xFF, 0x1F, 0x30, 0xCC, 0x7F, 0x81, 0x00, 0x00, 0x04, 0x82,
+    0x00, 0x00, 0x10, 0x86, 0x00, 0x08, 0x40, 0x00, 0x20, 0x00, 0x00, 0x20, 0xC0, 0x00, 0x30, 0x81,
+    0x00, 0x02, 0xE0, 0x00, 0xC0, 0x81, 0x00, 0x1F, 0xB0, 0x03, 0x40, 0x00, 0x00, 0x08, 0x30, 0x0C,
+    0x40, 0x00, 0x00, 0x1E, 0x20, 0x18, 0x40, 0x00, 0x00, 0x10, 0x20, 0x0C, 0x40, 0x00, 0x00, 0x0C,
+    0x20, 0x38, 0x40, 0x00, 0x00, 0x07, 0x60, 0x31, 0x82, 0x00, 0x02, 0xE0, 0x08, 0x80, 0x81, 0x00,
+    0x02, 0x20, 0x00, 0xC0, 0x81, 0x00, 0x02, 0x30, 0x00, 0x80, 0x82, 0x00, 0x00, 0x02, 0x88, 0x00,
+    0x00, 0x10, 0x82, 0x00, 0x02, 0x02, 0x00, 0x01, 0x84, 0x00, 0x02, 0x04, 0x00, 0x70, 0x83, 0x00,
+    0x00, 0x98, 0x82, 0x00, 0x01, 0x03, 0x30, 0x82, 0x00, 0x01, 0x26, 0x40, 0x82, 0x00, 0x00, 0x3C,
+    0x83, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x01, 0x06, 0x60, 0x82, 0x00, 0x01, 0x03, 0xB0, 0x82, 0x00,
+    0x03, 0x01, 0xF8, 0x00, 0x00, 0x10, 0xFF, 0x3F, 0x10, 0xC4, 0xFF, 0x81, 0x00, 0x00, 0x04, 0x81,
+    0x00, 0x00, 0x18, 0x83, 0x00, 0x06, 0x18, 0x00, 0x00, 0x20, 0x00, 0x00, 0xE0, 0x81, 0x00, 0x02,
+    0x20, 0x07, 0x20, 0x81, 0x00, 0x02, 0x70, 0x0C, 0x20, 0x81, 0x00, 0x02, 0x68, 0x06, 0x20, 0x81,
+    0x00, 0x1E, 0x58, 0x1C, 0x20, 0x00, 0x00, 0x0E, 0x18, 0x10, 0xA0, 0x00, 0x00, 0x01, 0x10, 0x00,
+    0xA0, 0x00, 0x00, 0x08, 0x10, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x10, 0x08, 0x40, 0x00, 0x00, 0x01,
+    0xE0, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x01, 0x30, 0x02, 0x87, 0x00,
+    0x05, 0x02, 0x00, 0x00, 0x04, 0x00, 0xE0, 0x82, 0x00, 0x01, 0x03, 0x20, 0x82, 0x00, 0x01, 0x84,
+    0xC0, 0x82, 0x00, 0x01, 0x59, 0x80, 0x82, 0x00, 0x00, 0xD0, 0x83, 0x00, 0x00, 0x10, 0x83, 0x00,
+    0x01, 0x09, 0x80, 0x82, 0x00, 0x01, 0x04, 0xC0, 0x82, 0x00, 0x01, 0x02, 0xC0, 0x82, 0x00, 0x00,
+    0x03, 0x81, 0x00, 0xC0, 0xFF, 0x5F, 0x20, 0xC0, 0xFF, 0x80, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00,
+    0x08, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x70, 0x82, 0x00, 0x01, 0x0F, 0x10, 0x82, 0x00,
+    0x01, 0x08, 0x10, 0x82, 0x00, 0x01, 0x0E, 0x10, 0x81, 0x00, 0x02, 0x18, 0x08, 0x10, 0x81, 0x00,
+    0x02, 0x30, 0x00, 0x50, 0x81, 0x00, 0x12, 0x24, 0x00, 0x50, 0x00, 0x00, 0x0E, 0x2C, 0x00, 0x50,
+    0x00, 0x00, 0x01, 0x08, 0x00, 0x20, 0x00, 0x00, 0x08, 0x08, 0x82, 0x00, 0x01, 0x02, 0x10, 0x83,
+    0x00, 0x00, 0x90, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x03, 0x10, 0x00,
+    0x00, 0x03, 0x83, 0x00, 0x01, 0x04, 0x40, 0x81, 0x00, 0x01, 0x01, 0x19, 0x82, 0x00, 0x01, 0x01,
+    0xA2, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x12, 0x83, 0x00, 0x00,
+    0x0B, 0x83, 0x00, 0x00, 0x0D, 0x83, 0x00, 0x00, 0x05, 0x81, 0x00, 0x00, 0xEA, 0x1D, 0x00, 0xC0,
+    0xF6, 0x01, 0x07, 0x80, 0x82, 0x00, 0x00, 0x0F, 0x88, 0x00, 0x00, 0x08, 0x83, 0x00, 0x02, 0x10,
+    0x00, 0x08, 0x83, 0x00, 0x00, 0x28, 0x81, 0x00, 0x00, 0x04, 0x82, 0x00, 0x01, 0x04, 0x08, 0x82,
+    0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x50, 0x81, 0x00, 0x00, 0x80, 0x82, 0x00, 0x01, 0x08, 0x80,
+    0x81, 0x00, 0x01, 0x02, 0x44, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00,
+    0x10, 0x83, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint16_t PROGMEM animation_reset_deltas[] = {
+    0, 243, 249, 255, 261, 342, 457, 543, 608, 725, 868, 1028,
+    1194, 1369, 1553, 1720, 1860, 2018, 2178, 2342, 2512, 2679, 2837, 2981,
+    3123, 3259, 3339, 3345, 3351, 3357,
+};
+static const PackedAnimation animation_reset = {48, 48, 28, animation_reset_deltas, animation_reset_data};
+
+// 48x48, 18 frames: 5184 bytes raw, 1668 packed
+static const uint8_t PROGMEM animation_resume_data[] = {
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x1F, 0xF8,
+    0x1F, 0xF8, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00,
+    0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38,
+    0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18,
+    0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00,
+    0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38,
+    0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18,
+    0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00,
+    0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x80, 0x18, 0x3D, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18,
+    0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C,
+    0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00,
+    0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1C, 0x18, 0x18, 0x38, 0x00, 0x00, 0x1F, 0xF8, 0x1F,
+    0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0x01, 0x00, 0x0C, 0x85, 0x00, 0x01, 0x1F, 0xF8, 0x82, 0x00, 0x7F, 0x21, 0xF8, 0x00, 0x00, 0x04,
+    0x00, 0x27, 0xD8, 0x00, 0x00, 0x04, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x28, 0x44, 0x00,
+    0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28,
+    0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04,
+    0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00,
+    0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28,
+    0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04,
+    0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00,
+    0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x80, 0x00, 0x27, 0x04, 0x00,
+    0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x24, 0x00, 0x00,
+    0x04, 0x00, 0x28, 0x24, 0x00, 0x00, 0x04, 0x00, 0x28, 0x04, 0x00, 0x00, 0x04, 0x00, 0x2B, 0xC4,
+    0x00, 0x00, 0x04, 0x00, 0x27, 0xF8, 0x82, 0x00, 0x01, 0x23, 0xF8, 0x82, 0x00, 0x04, 0x1F, 0xF8,
+    0x00, 0x00, 0x1C, 0x82, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x00, 0x12, 0x84, 0x00,
+    0x00, 0x38, 0x83, 0x00, 0x01, 0x04, 0x3E, 0x82, 0x00, 0x02, 0x64, 0xFF, 0xE0, 0x81, 0x00, 0x02,
+    0x14, 0xC7, 0xF8, 0x81, 0x00, 0x02, 0x14, 0xCC, 0x7C, 0x81, 0x00, 0x02, 0x14, 0xCF, 0x1C, 0x81,
+    0x00, 0x02, 0x14, 0xF7, 0xFC, 0x81, 0x00, 0x02, 0x14, 0xF1, 0xE4, 0x81, 0x00, 0x02, 0x14, 0xF0,
+    0x62, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x02, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02,
+    0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81,
+    0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0,
+    0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02,
+    0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x1A, 0x81,
+    0x00, 0x02, 0x14, 0xF0, 0x12, 0x81, 0x00, 0x02, 0x14, 0xF0, 0x22, 0x81, 0x00, 0x02, 0x14, 0xF1,
+    0xEC, 0x81, 0x00, 0x02, 0x14, 0xF7, 0xDC, 0x81, 0x00, 0x02, 0x14, 0xEF, 0x1C, 0x81, 0x00, 0x02,
+    0x14, 0xCC, 0x3C, 0x81, 0x00, 0x02, 0x14, 0xD3, 0xFC, 0x81, 0x00, 0x07, 0x24, 0xBF, 0xC0, 0x00,
+    0x00, 0x04, 0x00, 0x3C, 0x82, 0x00, 0x00, 0x38, 0x81, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x01, 0x00, 0x30, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x01, 0x20, 0x40, 0x82, 0x00, 0x01, 0x28,
+    0x1C, 0x82, 0x00, 0x02, 0x29, 0x84, 0xC0, 0x81, 0x00, 0x02, 0x28, 0x33, 0xF0, 0x81, 0x00, 0x02,
+    0x28, 0x03, 0x7C, 0x81, 0x00, 0x02, 0x28, 0x0B, 0x1F, 0x81, 0x00, 0x7A, 0x28, 0x0B, 0x3F, 0xE0,
+    0x00, 0x00, 0x28, 0x0B, 0x7F, 0xF8, 0x00, 0x00, 0x28, 0x0B, 0x4F, 0xFE, 0x00, 0x00, 0x28, 0x0B,
+    0x43, 0xFE, 0x00, 0x00, 0x28, 0x0B, 0xC1, 0xFE, 0x00, 0x00, 0x28, 0x0B, 0xC0, 0x7A, 0x00, 0x00,
+    0x28, 0x0B, 0xC0, 0x19, 0x00, 0x00, 0x28, 0x0B, 0xC0, 0x01, 0x00, 0x00, 0x28, 0x0B, 0xC0, 0x05,
+    0x00, 0x00, 0x28, 0x0B, 0xC0, 0x05, 0x00, 0x00, 0x28, 0x0B, 0xC0, 0x05, 0x00, 0x00, 0x28, 0x0B,
+    0xC0, 0x05, 0x00, 0x00, 0x28, 0x0B, 0xC0, 0x05, 0x00, 0x00, 0x28, 0x0B, 0xC0, 0x09, 0x00, 0x00,
+    0x28, 0x0B, 0xC0, 0x3A, 0x00, 0x00, 0x28, 0x03, 0xC0, 0xF6, 0x00, 0x00, 0x28, 0x03, 0xC3, 0xCE,
+    0x00, 0x00, 0x28, 0x03, 0xCF, 0xBE, 0x00, 0x00, 0x28, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x28, 0x03,
+    0x3F, 0xC0, 0x00, 0x00, 0x28, 0x03, 0x3F, 0x81, 0x00, 0x02, 0x28, 0x03, 0x7C, 0x81, 0x00, 0x02,
+    0x28, 0x32, 0xE0, 0x81, 0x00, 0x02, 0x28, 0xC4, 0x80, 0x81, 0x00, 0x01, 0x28, 0x18, 0x82, 0x00,
+    0x01, 0x20, 0xC0, 0x82, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x30, 0x82, 0x00, 0xE0, 0xFF, 0xFF,
+    0xFF, 0x7F, 0x00, 0x01, 0x00, 0x20, 0x83, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x02, 0x84, 0x00,
+    0x00, 0x80, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x43, 0x83, 0x00,
+    0x01, 0x31, 0x80, 0x82, 0x00, 0x01, 0x08, 0x60, 0x83, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00, 0x46,
+    0x83, 0x00, 0x01, 0xF3, 0x80, 0x82, 0x00, 0x01, 0x9C, 0xE0, 0x82, 0x00, 0x01, 0x06, 0x38, 0x82,
+    0x00, 0x01, 0x01, 0x9C, 0x83, 0x00, 0x00, 0xE7, 0x83, 0x00, 0x00, 0x39, 0x83, 0x00, 0x01, 0x0C,
+    0x80, 0x82, 0x00, 0x01, 0x04, 0x80, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00, 0x00, 0x0C, 0x83, 0x00,
+    0x00, 0x1D, 0x83, 0x00, 0x00, 0x77, 0x82, 0x00, 0x01, 0x01, 0xDC, 0x81, 0x00, 0x02, 0x08, 0x07,
+    0x70, 0x81, 0x00, 0x02, 0x08, 0x0C, 0xC0, 0x81, 0x00, 0x02, 0x08, 0x33, 0x80, 0x81, 0x00, 0x01,
+    0x08, 0xCE, 0x82, 0x00, 0x01, 0x08, 0x18, 0x82, 0x00, 0x01, 0x08, 0x60, 0x82, 0x00, 0x01, 0x11,
+    0x80, 0x82, 0x00, 0x00, 0x46, 0x82, 0x00, 0x01, 0x01, 0x08, 0x82, 0x00, 0x01, 0x04, 0x20, 0x81,
+    0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x01, 0x00, 0x40, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00,
+    0x00, 0x40, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x01, 0x40, 0x10, 0x82,
+    0x00, 0x01, 0x40, 0x84, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x02, 0x40,
+    0x00, 0x20, 0x81, 0x00, 0x02, 0x40, 0x00, 0x08, 0x81, 0x00, 0x00, 0x40, 0x83, 0x00, 0x02, 0x40,
+    0x00, 0x21, 0x81, 0x00, 0x08, 0x40, 0x00, 0x08, 0x40, 0x00, 0x00, 0x40, 0x00, 0x02, 0x81, 0x00,
+    0x13, 0x40, 0x00, 0x00, 0x08, 0x00, 0x00, 0x40, 0x00, 0x00, 0x42, 0x00, 0x00, 0x40, 0x01, 0x00,
+    0x10, 0x80, 0x00, 0x40, 0x05, 0x82, 0x00, 0x1F, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x40, 0x01,
+    0x00, 0x10, 0x00, 0x00, 0x40, 0x01, 0x00, 0x22, 0x00, 0x00, 0x40, 0x01, 0x00, 0x88, 0x00, 0x00,
+    0x40, 0x01, 0x02, 0x20, 0x00, 0x00, 0x40, 0x01, 0x82, 0x00, 0x02, 0x40, 0x01, 0x11, 0x81, 0x00,
+    0x02, 0x40, 0x01, 0x44, 0x81, 0x00, 0x00, 0x40, 0x83, 0x00, 0x02, 0x40, 0x00, 0x20, 0x81, 0x00,
+    0x02, 0x40, 0x08, 0x80, 0x81, 0x00, 0x01, 0x40, 0x20, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x01,
+    0x40, 0x10, 0x82, 0x00, 0x80, 0x40, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00,
+    0x00, 0x40, 0x83, 0x00, 0x00, 0x60, 0x82, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x80, 0x00,
+    0x00, 0x07, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00,
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00,
+    0x00, 0x06, 0x83, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00, 0xC0, 0x27, 0xF0, 0x0B, 0x00, 0x80, 0x00,
+    0x00, 0x04, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x07, 0x83, 0x00, 0x01, 0x07, 0x20, 0x82,
+    0x00, 0x00, 0x07, 0x85, 0x00, 0x00, 0x40, 0x81, 0x00, 0x80, 0x02, 0x82, 0x00, 0x00, 0x06, 0x83,
+    0x00, 0x00, 0x06, 0x83, 0x00, 0x01, 0x06, 0x40, 0x82, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x04,
+    0x83, 0x00, 0x00, 0x20, 0x81, 0x00, 0x00, 0x40, 0x22, 0x92, 0x08, 0x00, 0x80, 0x00, 0x00, 0x04,
+    0x84, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x02,
+    0x83, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x22, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x22, 0x92, 0x08, 0x00, 0x80, 0x00,
+    0x00, 0x04, 0x84, 0x00, 0x00, 0x20, 0x84, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00,
+    0x00, 0x02, 0x83, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x22, 0x81, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x07, 0x01, 0x00, 0x60, 0x83, 0x00, 0x00, 0x78, 0x83, 0x00, 0x00, 0x7C, 0x83, 0x00, 0x7F,
+    0x60, 0xF8, 0x1F, 0xF8, 0x00, 0x00, 0x68, 0x38, 0x1F, 0xF8, 0x00, 0x00, 0x6D, 0xF8, 0x18, 0x38,
+    0x00, 0x00, 0x6C, 0xE0, 0x18, 0x38, 0x00, 0x00, 0x6C, 0x26, 0x18, 0x38, 0x00, 0x00, 0x6C, 0x17,
+    0x98, 0x38, 0x00, 0x00, 0x6C, 0x1B, 0xD8, 0x38, 0x00, 0x00, 0x6C, 0x19, 0xE8, 0x38, 0x00, 0x00,
+    0x6C, 0x18, 0x64, 0x38, 0x00, 0x00, 0x6C, 0x18, 0x06, 0x38, 0x00, 0x00, 0x6C, 0x18, 0x17, 0xB8,
+    0x00, 0x00, 0x6C, 0x18, 0x1B, 0xD8, 0x00, 0x00, 0x6C, 0x18, 0x18, 0xC8, 0x00, 0x00, 0x6C, 0x18,
+    0x18, 0x04, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x27, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x3F, 0x80, 0x00,
+    0x6C, 0x18, 0x18, 0x3F, 0x80, 0x00, 0x6C, 0x18, 0x18, 0x27, 0x00, 0x00, 0x6C, 0x18, 0x18, 0x04,
+    0x00, 0x00, 0x6C, 0x18, 0x18, 0xC8, 0x00, 0x00, 0x6C, 0x18, 0x19, 0xF8, 0x00, 0x00, 0x6C, 0x18,
+    0x40, 0x1F, 0xB8, 0x00, 0x00, 0x6C, 0x18, 0x06, 0x38, 0x00, 0x00, 0x6C, 0x18, 0x20, 0x38, 0x00,
+    0x00, 0x6C, 0x19, 0xE8, 0x38, 0x00, 0x00, 0x6C, 0x1B, 0xD8, 0x38, 0x00, 0x00, 0x6C, 0x17, 0x18,
+    0x38, 0x00, 0x00, 0x6C, 0x06, 0x18, 0x38, 0x00, 0x00, 0x6C, 0x60, 0x18, 0x38, 0x00, 0x00, 0x6D,
+    0xF8, 0x18, 0x38, 0x00, 0x00, 0x68, 0x78, 0x1F, 0xF8, 0x00, 0x00, 0x60, 0xF8, 0x1F, 0xF8, 0x00,
+    0x00, 0x7C, 0x83, 0x00, 0x00, 0x70, 0x83, 0x00, 0x00, 0x60, 0x82, 0x00,
+};
+static const uint16_t PROGMEM animation_resume_deltas[] = {
+    0, 200, 206, 212, 218, 421, 618, 829, 993, 1192, 1240, 1302,
+    1338, 1344, 1350, 1356, 1362, 1368, 1404, 1628,
+};
+static const PackedAnimation animation_resume = {48, 48, 18, animation_resume_deltas, animation_resume_data};
+
+// 48x48, 20 frames: 5760 bytes raw, 820 packed
+static const uint8_t PROGMEM animation_tick_data[] = {
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x80, 0x00, 0x01, 0x1F, 0xFC, 0x82, 0x00, 0x80, 0xFF, 0x81,
+    0x00, 0x2F, 0x03, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0E, 0x00, 0x00,
+    0xE0, 0x00, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x01,
+    0xC0, 0x07, 0x82, 0x00, 0x01, 0xC0, 0x07, 0x82, 0x00, 0x01, 0x60, 0x06, 0x82, 0x00, 0x01, 0x60,
+    0x0E, 0x82, 0x00, 0x01, 0x70, 0x0C, 0x82, 0x00, 0x01, 0x30, 0x1C, 0x82, 0x00, 0x01, 0x30, 0x1C,
+    0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x80, 0x18,
+    0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x80, 0x18,
+    0x82, 0x00, 0x80, 0x18, 0x82, 0x00, 0x01, 0x38, 0x0C, 0x82, 0x00, 0x01, 0x38, 0x0C, 0x82, 0x00,
+    0x01, 0x30, 0x0E, 0x82, 0x00, 0x01, 0x70, 0x06, 0x82, 0x00, 0x01, 0x60, 0x06, 0x82, 0x00, 0x01,
+    0xE0, 0x03, 0x82, 0x00, 0x2F, 0xE0, 0x03, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00,
+    0x00, 0x07, 0xF0, 0x07, 0xC0, 0x81, 0x00, 0x80, 0xFF, 0x82, 0x00, 0x03, 0x3F, 0xF8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x83, 0x00, 0x00, 0x06, 0x83,
+    0x00, 0x00, 0x06, 0x82, 0x00, 0x00, 0x00, 0xF2, 0x03, 0x00, 0x00, 0x01, 0x00, 0x04, 0x83, 0x00,
+    0x00, 0x07, 0x83, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x01, 0x01,
+    0xC0, 0x83, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x00, 0x40, 0x81, 0x00, 0x00, 0x00, 0x74, 0x3F, 0x00,
+    0x00, 0x01, 0x00, 0x06, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x04, 0x80, 0x82, 0x00, 0x00,
+    0x02, 0x84, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x23, 0x83, 0x00, 0x00, 0x77, 0x83, 0x00, 0x00,
+    0x3E, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x08, 0x81, 0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00,
+    0x00, 0x01, 0x00, 0x06, 0x83, 0x00, 0x00, 0x04, 0x85, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x70,
+    0x83, 0x00, 0x00, 0x70, 0x83, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x01, 0x82, 0xC0, 0x82, 0x00, 0x01,
+    0x04, 0x80, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00, 0x06, 0x81, 0x00,
+    0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0E, 0x81, 0x00,
+    0x02, 0x02, 0x00, 0x0C, 0x81, 0x00, 0x02, 0x05, 0x00, 0x2C, 0x82, 0x00, 0x01, 0x80, 0x48, 0x81,
+    0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x02, 0x01, 0x20, 0x90, 0x82, 0x00, 0x01, 0x01, 0x20, 0x82,
+    0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x01, 0x04, 0x80, 0x82, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x06, 0x81, 0x00, 0x00, 0x00, 0xFB, 0xEE, 0x00, 0x00, 0x81, 0x00,
+    0x01, 0x01, 0x80, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x00, 0x09, 0x83, 0x00, 0x00, 0x02,
+    0x81, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x24, 0x83, 0x00, 0x00, 0x48, 0x83, 0x00, 0x00, 0x80,
+    0x82, 0x00, 0x01, 0x01, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x02, 0x81, 0x00, 0x00, 0x80, 0x67, 0xDB, 0x00, 0x00, 0x82, 0x00,
+    0x00, 0xC0, 0x83, 0x00, 0x00, 0x40, 0x82, 0x00, 0x00, 0x02, 0x83, 0x00, 0x01, 0x04, 0x80, 0x82,
+    0x00, 0x00, 0x12, 0x81, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x48, 0x83, 0x00, 0x00, 0x10, 0x82,
+    0x00, 0x01, 0x01, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00, 0x00,
+    0x01, 0x81, 0x00, 0x00, 0x80, 0xD2, 0x04, 0x00, 0x00, 0x82, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00,
+    0x40, 0x82, 0x00, 0x00, 0x09, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x24, 0x83, 0x00, 0x02,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0x82, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x80, 0x82, 0x00, 0x00, 0x01,
+    0x82, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x82, 0x00, 0x00, 0xE0, 0x82, 0x00, 0x01, 0x01,
+    0xC0, 0x82, 0x00, 0x01, 0x01, 0xC0, 0x82, 0x00, 0x01, 0x03, 0x80, 0x82, 0x00, 0x00, 0x07, 0x83,
+    0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x0E, 0x83, 0x00, 0x00, 0x1C, 0x83, 0x00, 0x00, 0x1C, 0x82,
+    0x00, 0x01, 0xC0, 0x38, 0x82, 0x00, 0x01, 0xE0, 0x70, 0x82, 0x00, 0x01, 0x70, 0x60, 0x82, 0x00,
+    0x01, 0x38, 0xE0, 0x82, 0x00, 0x01, 0x1D, 0xC0, 0x82, 0x00, 0x01, 0x0F, 0x80, 0x82, 0x00, 0x01,
+    0x07, 0x80, 0x82, 0x00, 0x00, 0x03, 0x81, 0x00,
+};
+static const uint16_t PROGMEM animation_tick_deltas[] = {
+    0, 224, 230, 236, 242, 261, 299, 347, 400, 472, 536, 595,
+    627, 633, 639, 645, 651, 657, 663, 674, 690, 776,
+};
+static const PackedAnimation animation_tick = {48, 48, 20, animation_tick_deltas, animation_tick_data};
+
+// 48x48, 20 frames: 5760 bytes raw, 1710 packed
+static const uint8_t PROGMEM animation_timer_start_data[] = {
+    0x00, 0xFC, 0xFF, 0xFF, 0x3F, 0x00, 0x07, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0x81,
+    0xFF, 0x01, 0x00, 0x01, 0x82, 0xFF, 0x2A, 0xC0, 0x07, 0xFF, 0xFF, 0xFC, 0x03, 0xE0, 0x0F, 0xFF,
+    0xFF, 0xF0, 0x00, 0xF0, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x38, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1C,
+    0x3F, 0xFF, 0xFF, 0x80, 0x00, 0x0C, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0E, 0x7F, 0xFF, 0xFF, 0x00,
+    0x00, 0x06, 0x81, 0xFF, 0x80, 0x00, 0x00, 0x07, 0x81, 0xFF, 0x80, 0x00, 0x18, 0x03, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0x81, 0xFF, 0x80, 0x00, 0x31, 0x07, 0x7F, 0xFF, 0xFF, 0x00,
+    0x00, 0x07, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x06, 0x7F, 0xFF, 0xFF, 0x80, 0x00, 0x0E, 0x3F, 0xFF,
+    0xFF, 0x80, 0x00, 0x0C, 0x3F, 0xFF, 0xFF, 0xC0, 0x00, 0x1C, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x38,
+    0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x70, 0x07, 0xFF, 0xFF, 0xFE, 0x01, 0xE0, 0x03, 0x82, 0xFF, 0x01,
+    0x80, 0x00, 0x81, 0xFF, 0x07, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE4, 0xFF, 0xFF, 0x1F, 0x00, 0x82, 0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00,
+    0x08, 0x83, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00,
+    0x40, 0x83, 0x00, 0x00, 0xC0, 0x83, 0x00, 0x02, 0x80, 0x00, 0x01, 0x81, 0x00, 0x00, 0x80, 0x82,
+    0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00, 0x01, 0x01, 0x80, 0x82, 0x00,
+    0x01, 0x01, 0x80, 0x83, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0xC0, 0x83,
+    0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x10, 0x83,
+    0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x00, 0x40, 0x82, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0xEC, 0xFF, 0xFF, 0x27, 0x00, 0x82, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x80, 0x81, 0x00,
+    0x00, 0x01, 0x83, 0x00, 0x00, 0x06, 0x83, 0x00, 0x00, 0x0C, 0x83, 0x00, 0x00, 0x18, 0x83, 0x00,
+    0x00, 0x10, 0x83, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00,
+    0x00, 0x60, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0x40, 0x83, 0x00,
+    0x00, 0x40, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x60, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00,
+    0x00, 0x30, 0x83, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00, 0x18, 0x83, 0x00, 0x00, 0x0C, 0x83, 0x00,
+    0x00, 0x02, 0x84, 0x00, 0x00, 0x80, 0x83, 0x00, 0x01, 0x10, 0x00, 0x00, 0xCC, 0xFF, 0xFF, 0x2F,
+    0x00, 0x82, 0x00, 0x00, 0x18, 0x84, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00,
+    0x04, 0x83, 0x00, 0x00, 0x08, 0x85, 0x00, 0x00, 0x10, 0x81, 0x00, 0x00, 0x10, 0x85, 0x00, 0x00,
+    0x08, 0x81, 0x00, 0x00, 0x20, 0x83, 0x00, 0x02, 0x20, 0x00, 0x04, 0x81, 0x00, 0x02, 0x20, 0x00,
+    0x04, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00, 0x04, 0x81, 0x00, 0x00,
+    0x20, 0x83, 0x00, 0x00, 0x20, 0x83, 0x00, 0x02, 0x20, 0x00, 0x08, 0x81, 0x00, 0x00, 0x10, 0x83,
+    0x00, 0x02, 0x10, 0x00, 0x10, 0x81, 0x00, 0x00, 0x08, 0x83, 0x00, 0x00, 0x04, 0x83, 0x00, 0x00,
+    0x02, 0x84, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x40, 0x82, 0x00, 0x01, 0x10, 0x00, 0x00, 0xE4,
+    0xFF, 0xFF, 0x17, 0x00, 0x82, 0x00, 0x00, 0x10, 0x82, 0x00, 0x01, 0x07, 0x0C, 0x82, 0x00, 0x01,
+    0x1C, 0x07, 0x82, 0x00, 0x02, 0x38, 0x01, 0x80, 0x81, 0x00, 0x02, 0x70, 0x00, 0xC0, 0x81, 0x00,
+    0x02, 0xF0, 0x00, 0xD0, 0x81, 0x00, 0x3E, 0xE0, 0x00, 0x60, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x68,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x20, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x01, 0xC0,
+    0x00, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x34, 0x00, 0x00,
+    0x01, 0xC0, 0x00, 0x34, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x60,
+    0x00, 0x00, 0x01, 0xC0, 0x00, 0x68, 0x81, 0x00, 0x02, 0xE0, 0x00, 0x60, 0x81, 0x00, 0x02, 0xE0,
+    0x00, 0xD0, 0x81, 0x00, 0x02, 0x70, 0x01, 0xC0, 0x81, 0x00, 0x02, 0x38, 0x01, 0x80, 0x81, 0x00,
+    0x02, 0x1C, 0x03, 0x80, 0x81, 0x00, 0x01, 0x07, 0x0E, 0x83, 0x00, 0x01, 0x01, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0x07, 0x00, 0x7F, 0x00, 0x01, 0xFC, 0x38, 0x0C, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x07,
+    0x00, 0x00, 0x07, 0xFF, 0xB0, 0x01, 0x80, 0x00, 0x0F, 0xFF, 0xB8, 0x00, 0xC0, 0x00, 0x1F, 0xFF,
+    0x18, 0x00, 0xC0, 0x00, 0x1F, 0xFF, 0x18, 0x00, 0x60, 0x00, 0x3F, 0xFE, 0x0C, 0x00, 0x60, 0x00,
+    0x3F, 0xFE, 0x0C, 0x00, 0x20, 0x00, 0x3F, 0xFE, 0x0C, 0x00, 0x30, 0x00, 0x7F, 0xFE, 0x04, 0x00,
+    0x30, 0x00, 0x7F, 0xFE, 0x06, 0x00, 0x30, 0x00, 0x7F, 0xFC, 0x06, 0x00, 0x30, 0x00, 0x7F, 0xFE,
+    0x0C, 0x00, 0x30, 0x00, 0x7F, 0xFE, 0x0C, 0x00, 0x30, 0x00, 0x3F, 0xFE, 0x0C, 0x00, 0x60, 0x00,
+    0x3F, 0xFE, 0x0C, 0x00, 0x60, 0x00, 0x3F, 0xFF, 0x1C, 0x00, 0x60, 0x00, 0x1F, 0xFF, 0x18, 0x00,
+    0xC0, 0x00, 0x0F, 0xFF, 0xB8, 0x01, 0xC0, 0x00, 0x07, 0xFF, 0xB0, 0x01, 0x80, 0x00, 0x03, 0xFF,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x03, 0xFE, 0x38, 0x0E, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00,
+    0x03, 0x00, 0x3E, 0x3F, 0xC0, 0x81, 0x00, 0x02, 0x7C, 0x1E, 0xE0, 0x81, 0x00, 0x62, 0xF8, 0x06,
+    0x70, 0x00, 0x00, 0x01, 0xF0, 0x03, 0x38, 0x00, 0x00, 0x03, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x03,
+    0xE0, 0x01, 0x98, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x8C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x8C, 0x00,
+    0x00, 0x07, 0xC0, 0x00, 0x8C, 0x00, 0x00, 0x07, 0x80, 0x00, 0xC4, 0x00, 0x00, 0x07, 0x80, 0x00,
+    0xC6, 0x00, 0x00, 0x0F, 0x80, 0x00, 0xC6, 0x00, 0x00, 0x07, 0x80, 0x00, 0xCC, 0x00, 0x00, 0x07,
+    0x80, 0x00, 0xCC, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x8C, 0x00, 0x00, 0x07, 0xC0, 0x01, 0x8C, 0x00,
+    0x00, 0x03, 0xC0, 0x03, 0x9C, 0x00, 0x00, 0x03, 0xE0, 0x03, 0x18, 0x00, 0x00, 0x01, 0xF0, 0x07,
+    0x38, 0x81, 0x00, 0x02, 0xF8, 0x06, 0x70, 0x81, 0x00, 0x02, 0x7C, 0x0E, 0xE0, 0x81, 0x00, 0x04,
+    0x1F, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x27, 0x00, 0x01, 0x00, 0x80, 0x82, 0x00,
+    0x00, 0x02, 0x84, 0x00, 0x01, 0x40, 0xC4, 0x81, 0x00, 0x02, 0x01, 0x80, 0x22, 0x81, 0x00, 0x02,
+    0x03, 0x00, 0x0A, 0x81, 0x00, 0x02, 0x06, 0x00, 0x05, 0x81, 0x00, 0x02, 0x0C, 0x00, 0x05, 0x81,
+    0x00, 0x0E, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x18, 0x00, 0x02, 0x80, 0x00, 0x00, 0x18, 0x00,
+    0x01, 0x81, 0x00, 0x02, 0x18, 0x00, 0x01, 0x81, 0x00, 0x1E, 0x38, 0x00, 0x01, 0x40, 0x00, 0x00,
+    0x38, 0x00, 0x01, 0x40, 0x00, 0x00, 0x30, 0x00, 0x01, 0x40, 0x00, 0x00, 0x38, 0x00, 0x01, 0x40,
+    0x00, 0x00, 0x38, 0x00, 0x01, 0x40, 0x00, 0x00, 0x18, 0x83, 0x00, 0x02, 0x18, 0x00, 0x02, 0x81,
+    0x00, 0x08, 0x0C, 0x00, 0x00, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x04, 0x81, 0x00, 0x02, 0x06, 0x00,
+    0x09, 0x81, 0x00, 0x02, 0x03, 0x00, 0x08, 0x82, 0x00, 0x01, 0x80, 0x32, 0x82, 0x00, 0x01, 0x20,
+    0x44, 0x82, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x27, 0x00, 0x01, 0x00, 0x80,
+    0x82, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x84, 0x83, 0x00, 0x00, 0x22, 0x83, 0x00, 0x00, 0x0B,
+    0x83, 0x00, 0x01, 0x05, 0x80, 0x82, 0x00, 0x01, 0x07, 0x80, 0x82, 0x00, 0x01, 0x02, 0xC0, 0x82,
+    0x00, 0x01, 0x03, 0xC0, 0x82, 0x00, 0x01, 0x01, 0x40, 0x82, 0x00, 0x01, 0x01, 0x60, 0x82, 0x00,
+    0x01, 0x01, 0xE0, 0x82, 0x00, 0x01, 0x01, 0xE0, 0x82, 0x00, 0x01, 0x01, 0xE0, 0x82, 0x00, 0x01,
+    0x01, 0xE0, 0x82, 0x00, 0x07, 0x01, 0x60, 0x00, 0x00, 0x80, 0x00, 0x01, 0x60, 0x82, 0x00, 0x01,
+    0x03, 0x40, 0x82, 0x00, 0x01, 0x02, 0xC0, 0x82, 0x00, 0x01, 0x06, 0x80, 0x82, 0x00, 0x01, 0x0D,
+    0x80, 0x82, 0x00, 0x00, 0x09, 0x83, 0x00, 0x00, 0x32, 0x83, 0x00, 0x00, 0x44, 0x82, 0x00, 0x00,
+    0x08, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x27, 0x00, 0x01, 0x00, 0x80,
+    0x82, 0x00, 0x00, 0x02, 0x85, 0x00, 0x00, 0x84, 0x83, 0x00, 0x00, 0x22, 0x83, 0x00, 0x00, 0x0B,
+    0x83, 0x00, 0x01, 0x05, 0x80, 0x82, 0x00, 0x01, 0x07, 0x80, 0x82, 0x00, 0x01, 0x02, 0xC0, 0x82,
+    0x00, 0x01, 0x03, 0xC0, 0x82, 0x00, 0x01, 0x01, 0x40, 0x82, 0x00, 0x01, 0x01, 0x60, 0x82, 0x00,
+    0x01, 0x01, 0xE0, 0x82, 0x00, 0x01, 0x01, 0xE0, 0x82, 0x00, 0x01, 0x01, 0xE0, 0x82, 0x00, 0x01,
+    0x01, 0xE0, 0x82, 0x00, 0x07, 0x01, 0x60, 0x00, 0x00, 0x80, 0x00, 0x01, 0x60, 0x82, 0x00, 0x01,
+    0x03, 0x40, 0x82, 0x00, 0x01, 0x02, 0xC0, 0x82, 0x00, 0x01, 0x06, 0x80, 0x82, 0x00, 0x01, 0x0D,
+    0x80, 0x82, 0x00, 0x00, 0x09, 0x83, 0x00, 0x00, 0x32, 0x83, 0x00, 0x00, 0x44, 0x82, 0x00, 0x00,
+    0x08, 0x82, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x27, 0x00, 0x01, 0x00, 0x80, 0x82, 0x00, 0x00, 0x02,
+    0x84, 0x00, 0x01, 0x60, 0xC4, 0x81, 0x00, 0x02, 0x01, 0x80, 0x22, 0x81, 0x00, 0x02, 0x03, 0x00,
+    0x0A, 0x81, 0x00, 0x02, 0x06, 0x00, 0x05, 0x81, 0x00, 0x02, 0x0C, 0x00, 0x05, 0x81, 0x00, 0x0E,
+    0x0C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x1C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x18, 0x00, 0x01, 0x81,
+    0x00, 0x2C, 0x18, 0x00, 0x01, 0x40, 0x00, 0x00, 0x38, 0x00, 0x01, 0x40, 0x00, 0x00, 0x38, 0x00,
+    0x01, 0x40, 0x00, 0x00, 0x38, 0x00, 0x01, 0x40, 0x00, 0x00, 0x38, 0x00, 0x01, 0x40, 0x00, 0x00,
+    0x38, 0x00, 0x01, 0x40, 0x00, 0x00, 0x18, 0x00, 0x00, 0x40, 0x00, 0x00, 0x18, 0x00, 0x02, 0x81,
+    0x00, 0x0E, 0x0C, 0x00, 0x02, 0x80, 0x00, 0x00, 0x0C, 0x00, 0x04, 0x80, 0x00, 0x00, 0x06, 0x00,
+    0x09, 0x81, 0x00, 0x02, 0x03, 0x00, 0x08, 0x82, 0x00, 0x01, 0x80, 0x32, 0x82, 0x00, 0x01, 0x20,
+    0x44, 0x82, 0x00, 0x00, 0x08, 0x82, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x03, 0x00, 0x1F,
+    0xC3, 0xFC, 0x81, 0x00, 0x02, 0x7F, 0xE1, 0xF0, 0x81, 0x00, 0x13, 0xFF, 0xF9, 0xE0, 0x00, 0x00,
+    0x01, 0xFF, 0xFC, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x80, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x81,
+    0x00, 0x3E, 0x03, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0x07, 0xFF,
+    0xFF, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xC0, 0x00, 0x00,
+    0x07, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0,
+    0x00, 0x00, 0x07, 0xFF, 0xFE, 0xC0, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x80, 0x00, 0x00, 0x03, 0xFF,
+    0xFE, 0x81, 0x00, 0x02, 0x03, 0xFF, 0xFC, 0x81, 0x00, 0x03, 0x01, 0xFF, 0xF8, 0xC0, 0x81, 0x00,
+    0x02, 0xFF, 0xF9, 0xE0, 0x81, 0x00, 0x02, 0x7F, 0xF1, 0xF8, 0x81, 0x00, 0x04, 0x1F, 0xC3, 0xFE,
+    0x00, 0x00,
+};
+static const uint16_t PROGMEM animation_timer_start_deltas[] = {
+    0, 173, 179, 185, 191, 304, 411, 526, 670, 810, 949, 1095,
+    1219, 1225, 1231, 1237, 1243, 1249, 1255, 1379, 1527, 1666,
+};
+static const PackedAnimation animation_timer_start = {48, 48, 20, animation_timer_start_deltas, animation_timer_start_data};
+
+// 48x48, 28 frames: 8064 bytes raw, 3034 packed
+static const uint8_t PROGMEM animation_wifi_data[] = {
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x01, 0x7F, 0xFF, 0x81, 0x00, 0x7F, 0x03, 0xFF,
+    0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3F, 0x00, 0x01,
+    0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0x80, 0x01, 0x80, 0x03, 0xE0, 0x0E, 0x00, 0x7F, 0xFF, 0x00,
+    0xF0, 0x1C, 0x03, 0xFF, 0xFF, 0xC0, 0x3C, 0x78, 0x0F, 0x80, 0x01, 0xF8, 0x1E, 0xF0, 0x3C, 0x00,
+    0x00, 0x7E, 0x0F, 0x70, 0xF0, 0x00, 0x00, 0x1F, 0x0E, 0x79, 0xC0, 0x01, 0x80, 0x07, 0x9E, 0x3F,
+    0x80, 0x7F, 0xFF, 0x01, 0xFC, 0x1F, 0x01, 0xFC, 0x7F, 0xC0, 0xF8, 0x0C, 0x0F, 0x80, 0x03, 0xF0,
+    0x70, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xF0, 0x0F,
+    0xF8, 0x0F, 0x00, 0x00, 0xE0, 0x7F, 0xFE, 0x07, 0x00, 0x00, 0x71, 0xF0, 0x1F, 0x8E, 0x00, 0x00,
+    0x3B, 0xC0, 0x03, 0xDC, 0x00, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0E, 0x00, 0x01, 0x00,
+    0x70, 0x81, 0x00, 0x01, 0x0F, 0xF0, 0x82, 0x00, 0x01, 0x3F, 0xFC, 0x82, 0x00, 0x01, 0x78, 0x1E,
+    0x82, 0x00, 0x01, 0xE0, 0x07, 0x82, 0x00, 0x01, 0x70, 0x0E, 0x82, 0x00, 0x01, 0x38, 0x1C, 0x82,
+    0x00, 0x01, 0x1C, 0x38, 0x82, 0x00, 0x01, 0x0E, 0x70, 0x82, 0x00, 0x01, 0x07, 0xE0, 0x82, 0x00,
+    0x01, 0x03, 0xC0, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    0xFF, 0x01, 0x80, 0x00, 0x01, 0x3E, 0x7E, 0x81, 0x00, 0x3F, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00,
+    0x06, 0x3C, 0x78, 0x20, 0x00, 0x00, 0x10, 0x80, 0x03, 0x08, 0x00, 0x00, 0x22, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x48, 0x03, 0xE0, 0x02, 0x00, 0x00, 0x10, 0x30, 0x04, 0x08, 0x00, 0x00, 0x90, 0x81,
+    0x81, 0x09, 0x00, 0x00, 0x4A, 0x10, 0x18, 0x52, 0x00, 0x00, 0x24, 0x40, 0x02, 0x24, 0x00, 0x00,
+    0x11, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0E, 0x0F, 0xF0, 0x70, 0x81, 0x00, 0x01, 0x30, 0x0C, 0x82,
+    0x00, 0x01, 0x47, 0xE2, 0x82, 0x00, 0x01, 0x98, 0x19, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00,
+    0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09,
+    0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0x00, 0x01, 0x7F, 0xFE, 0x81, 0x00, 0x7F,
+    0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x3F, 0xF8, 0x1C, 0x00, 0x00, 0x63, 0x80, 0x03, 0x82,
+    0x00, 0x01, 0x8C, 0x00, 0x00, 0x30, 0x80, 0x06, 0x20, 0x00, 0x00, 0x0C, 0x20, 0x08, 0x80, 0x7E,
+    0x7F, 0x03, 0x10, 0x12, 0x01, 0x80, 0x00, 0xC0, 0xC8, 0x64, 0x0C, 0x7F, 0xFC, 0x38, 0x22, 0x88,
+    0x31, 0x80, 0x01, 0x84, 0x11, 0x00, 0xCC, 0x07, 0xC0, 0x61, 0x00, 0x01, 0x10, 0x7F, 0xFF, 0x18,
+    0x80, 0x46, 0x43, 0xC7, 0xC1, 0xE4, 0x62, 0x20, 0x8E, 0x7F, 0xFE, 0x71, 0x04, 0x11, 0x1B, 0xC0,
+    0x07, 0x98, 0x88, 0x0C, 0x67, 0x00, 0x00, 0xE6, 0x70, 0x00, 0xCC, 0x0F, 0xF8, 0x33, 0x00, 0x00,
+    0x90, 0x7C, 0x1E, 0x19, 0x00, 0x00, 0x91, 0xCF, 0xF3, 0x89, 0x00, 0x00, 0x4B, 0x7E, 0x7C, 0xD2,
+    0x00, 0x00, 0x24, 0xE0, 0x07, 0x24, 0x00, 0x00, 0x11, 0x80, 0x01, 0x88, 0x00, 0x00, 0x0E, 0x0F,
+    0x01, 0xF0, 0x70, 0x81, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x47, 0xE2, 0x82, 0x00, 0x01,
+    0x98, 0x11, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24,
+    0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82,
+    0x00, 0x03, 0x02, 0x40, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0x00, 0x01, 0x3F,
+    0xFE, 0x81, 0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x9F, 0xF1, 0xF8, 0x00, 0x00,
+    0x7D, 0xFF, 0xFF, 0x9E, 0x00, 0x01, 0xEF, 0xC0, 0x07, 0xF3, 0x80, 0x07, 0xBC, 0x00, 0x00, 0x7D,
+    0xE0, 0x0E, 0xF0, 0x3F, 0xFE, 0x0F, 0x70, 0x1B, 0xC1, 0xFF, 0xFF, 0xC3, 0xD8, 0x37, 0x0F, 0x9F,
+    0xF0, 0xF0, 0xEE, 0xEC, 0x3F, 0xFF, 0xFF, 0x3C, 0x37, 0x98, 0x77, 0x80, 0x03, 0xE7, 0x19, 0x81,
+    0xDE, 0x03, 0x80, 0x7B, 0x81, 0xCB, 0x30, 0x78, 0x3F, 0x1C, 0xD3, 0x6E, 0xE3, 0x83, 0xC0, 0xC7,
+    0x76, 0x31, 0x8C, 0x78, 0x3C, 0x13, 0x8C, 0x1F, 0x11, 0x80, 0x01, 0x88, 0xF8, 0x0E, 0x64, 0x00,
+    0x00, 0x66, 0x70, 0x00, 0x88, 0x0F, 0xF8, 0x11, 0x00, 0x00, 0x10, 0x70, 0x06, 0x08, 0x00, 0x00,
+    0x91, 0x87, 0xE1, 0x89, 0x00, 0x00, 0x4A, 0x30, 0x0C, 0x52, 0x00, 0x00, 0x24, 0x80, 0x03, 0x24,
+    0x00, 0x00, 0x11, 0x00, 0x07, 0x00, 0x88, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x81, 0x00, 0x01,
+    0x0E, 0x30, 0x82, 0x00, 0x01, 0x20, 0x04, 0x82, 0x00, 0x01, 0x46, 0xE0, 0x82, 0x00, 0x00, 0x10,
+    0x83, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00,
+    0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x03,
+    0x02, 0x40, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x01, 0x7F, 0xFF, 0x81,
+    0x00, 0x7F, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x1C, 0x7F, 0xFC, 0x3C, 0x00, 0x00, 0x63, 0xE0,
+    0x0F, 0x87, 0x00, 0x01, 0x9E, 0x00, 0x00, 0x71, 0xC0, 0x06, 0x70, 0x00, 0x00, 0x0C, 0x60, 0x09,
+    0xC0, 0x7F, 0xFF, 0x03, 0x10, 0x33, 0x01, 0xC0, 0x01, 0xC0, 0xCC, 0x64, 0x0E, 0x3F, 0xF8, 0x38,
+    0x26, 0xD8, 0x31, 0xE0, 0x0F, 0x0E, 0x11, 0x10, 0xCE, 0x00, 0x00, 0xE3, 0x08, 0x91, 0x98, 0x00,
+    0x00, 0x18, 0x89, 0x4A, 0x60, 0x03, 0x80, 0x06, 0x72, 0x24, 0xC0, 0x7F, 0xFF, 0x03, 0x24, 0x11,
+    0x03, 0xFC, 0x3F, 0xC0, 0x88, 0x0E, 0x0F, 0x80, 0x03, 0xF0, 0x70, 0x00, 0x1E, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x78, 0x0F, 0xE0, 0x1E, 0x00, 0x00, 0xF0, 0x70, 0x07, 0x0F, 0x00, 0x00, 0xE1, 0x9F,
+    0xF1, 0xC7, 0x00, 0x00, 0x76, 0x78, 0x1C, 0x6E, 0x00, 0x00, 0x35, 0xC0, 0x03, 0xAC, 0x00, 0x00,
+    0x03, 0x0F, 0x19, 0xF8, 0xC0, 0x00, 0x00, 0x12, 0x7F, 0xFE, 0x48, 0x00, 0x00, 0x0E, 0xF0, 0x0F,
+    0x70, 0x00, 0x00, 0x07, 0xC1, 0xC3, 0xE0, 0x00, 0x00, 0x03, 0x9F, 0x79, 0xC0, 0x81, 0x00, 0x01,
+    0x31, 0x06, 0x82, 0x00, 0x01, 0xCF, 0xF3, 0x82, 0x00, 0x01, 0x10, 0x18, 0x82, 0x00, 0x01, 0x90,
+    0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82,
+    0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00,
+    0x03, 0x01, 0x80, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x01, 0x7F, 0xFF,
+    0x81, 0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x7C,
+    0x00, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x03, 0xE0,
+    0x0E, 0x00, 0x7F, 0xFF, 0x00, 0xF0, 0x3C, 0x01, 0xFF, 0xFF, 0xC0, 0x3C, 0x78, 0x0F, 0xC0, 0x07,
+    0xF8, 0x1E, 0xE0, 0x3E, 0x00, 0x00, 0xFE, 0x0F, 0xE0, 0xF0, 0x3F, 0xFE, 0x1F, 0x07, 0x71, 0xE1,
+    0xFE, 0xFF, 0xC7, 0x8E, 0x3B, 0x87, 0x80, 0x03, 0xF1, 0xFC, 0x1F, 0x1E, 0x00, 0x00, 0x7C, 0xF8,
+    0x0E, 0x70, 0x0F, 0xF8, 0x1E, 0x70, 0x00, 0xE0, 0x7F, 0xFF, 0x07, 0x00, 0x01, 0xC3, 0xE0, 0x07,
+    0xC3, 0xC0, 0x03, 0x8F, 0x0F, 0xE1, 0xF1, 0xC0, 0x01, 0x9C, 0x7F, 0xFF, 0x79, 0x80, 0x00, 0xF9,
+    0xE0, 0x0F, 0xDF, 0x00, 0x00, 0x77, 0x80, 0x03, 0xEE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x1C, 0x0F, 0x19, 0xF8, 0x38, 0x00, 0x00, 0x1C, 0x7F, 0xFE, 0x38, 0x00, 0x00, 0x0E, 0xF0,
+    0x0F, 0x70, 0x00, 0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x03, 0x8F, 0x71, 0xC0, 0x81, 0x00,
+    0x01, 0x31, 0x84, 0x82, 0x00, 0x01, 0x40, 0x02, 0x82, 0x00, 0x01, 0x0F, 0xE0, 0x82, 0x00, 0x01,
+    0x98, 0x19, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24,
+    0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82,
+    0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xF8, 0xFF,
+    0x07, 0x80, 0x00, 0x01, 0x3F, 0xFE, 0x81, 0x00, 0x39, 0x01, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x07,
+    0x80, 0x03, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x70, 0x0F, 0xF8, 0x1E, 0x00,
+    0x00, 0xE0, 0x7F, 0xFF, 0x07, 0x00, 0x01, 0xC3, 0xE0, 0x07, 0xC3, 0xC0, 0x03, 0x8F, 0x00, 0x01,
+    0xF1, 0xC0, 0x01, 0x9C, 0x00, 0x00, 0x79, 0x80, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x0E, 0x81, 0x00, 0x00, 0x01, 0x83, 0x00, 0x01, 0x1E, 0xFC, 0x82, 0x00, 0x01, 0x6E,
+    0x3E, 0x82, 0x00, 0x08, 0xE1, 0x87, 0x80, 0x00, 0x00, 0x01, 0xCC, 0x11, 0x80, 0x81, 0x00, 0x00,
+    0x20, 0x83, 0x00, 0x01, 0x44, 0x60, 0x82, 0x00, 0x01, 0x10, 0x08, 0x82, 0x00, 0x01, 0x80, 0x01,
+    0x82, 0x00, 0x01, 0x40, 0x02, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00,
+    0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03,
+    0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x07, 0x80, 0x00, 0x00, 0x01, 0x83, 0x00,
+    0x01, 0x1E, 0xFC, 0x82, 0x00, 0x01, 0x61, 0xCE, 0x82, 0x00, 0x08, 0xDF, 0x7B, 0x80, 0x00, 0x00,
+    0x01, 0xAC, 0x17, 0x80, 0x81, 0x00, 0x01, 0xE0, 0x03, 0x82, 0x00, 0x01, 0xCC, 0x71, 0x82, 0x00,
+    0x01, 0x10, 0x08, 0x82, 0x00, 0x01, 0x80, 0x01, 0x82, 0x00, 0x01, 0x40, 0x02, 0x82, 0x00, 0x80,
+    0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20,
+    0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0xFF, 0x03, 0x80, 0x00, 0x01, 0x0F, 0x70, 0x82, 0x00, 0x01, 0x20, 0x04, 0x82, 0x00, 0x01, 0x47,
+    0xE2, 0x82, 0x00, 0x01, 0x10, 0x08, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12,
+    0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00,
+    0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x80, 0x00, 0x01, 0x1F, 0xF8, 0x82, 0x00,
+    0x01, 0x3E, 0x6C, 0x82, 0x00, 0x01, 0xC0, 0x03, 0x82, 0x00, 0x01, 0x87, 0xE1, 0x82, 0x00, 0x01,
+    0x10, 0x08, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24,
+    0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82,
+    0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xEF, 0xFF,
+    0x07, 0x80, 0x00, 0x01, 0x1F, 0xFC, 0x82, 0x00, 0x80, 0xFF, 0x81, 0x00, 0x2D, 0x03, 0xE0, 0x07,
+    0xC0, 0x00, 0x00, 0x0F, 0x01, 0xC1, 0xF0, 0x00, 0x00, 0x1C, 0x3F, 0xFC, 0x78, 0x00, 0x00, 0x38,
+    0xFC, 0x7F, 0x9C, 0x00, 0x00, 0x73, 0xC0, 0x07, 0xCE, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00,
+    0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x08, 0x00, 0x00, 0x10, 0x81, 0x00, 0x01, 0x1F, 0xF8,
+    0x82, 0x00, 0x01, 0x31, 0x9C, 0x82, 0x00, 0x01, 0xF0, 0x07, 0x82, 0x00, 0x01, 0xC0, 0x03, 0x82,
+    0x00, 0x01, 0x8C, 0x71, 0x82, 0x00, 0x01, 0x10, 0x08, 0x82, 0x00, 0x01, 0x80, 0x01, 0x82, 0x00,
+    0x01, 0x40, 0x02, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09,
+    0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0x80, 0x00, 0x01, 0x7F, 0xFF, 0x81, 0x00, 0x7F,
+    0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0x80, 0x03, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3E,
+    0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x03, 0xC0, 0x3F, 0xFE, 0x03, 0xC0, 0x07, 0x01, 0xFF,
+    0xFF, 0xC0, 0xE0, 0x1E, 0x07, 0xC0, 0x07, 0xF0, 0x78, 0x1C, 0x1E, 0x00, 0x00, 0xFC, 0x38, 0x1C,
+    0x78, 0x00, 0x00, 0x3E, 0x38, 0x0E, 0xF0, 0x1F, 0xFC, 0x0F, 0x70, 0x07, 0xC0, 0xFF, 0xFF, 0x07,
+    0xE0, 0x03, 0x83, 0xE0, 0x07, 0xC1, 0xC0, 0x00, 0x0F, 0x01, 0xC1, 0xF0, 0x00, 0x00, 0x1C, 0x3F,
+    0xFC, 0x78, 0x00, 0x00, 0x38, 0xFC, 0x7F, 0x9C, 0x00, 0x00, 0x73, 0xC0, 0x07, 0xCE, 0x00, 0x00,
+    0x3F, 0x3F, 0xFE, 0xFC, 0x00, 0x00, 0x1E, 0xF8, 0x3F, 0x78, 0x00, 0x00, 0x09, 0xC0, 0x07, 0xD0,
+    0x00, 0x00, 0x07, 0x87, 0xF1, 0xE0, 0x00, 0x00, 0x07, 0x3F, 0xFC, 0xE0, 0x00, 0x00, 0x03, 0xF8,
+    0x07, 0x3F, 0xC0, 0x00, 0x00, 0x01, 0xE0, 0x07, 0x80, 0x81, 0x00, 0x01, 0x04, 0x60, 0x82, 0x00,
+    0x01, 0x10, 0x08, 0x82, 0x00, 0x01, 0x80, 0x01, 0x82, 0x00, 0x01, 0x40, 0x02, 0x82, 0x00, 0x80,
+    0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20,
+    0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x03, 0x80, 0x00, 0x01, 0x7F, 0xFF, 0x81, 0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x1F, 0x80, 0x03, 0xFC, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x0F,
+    0xC0, 0x07, 0x80, 0x7F, 0xFF, 0x03, 0xE0, 0x0E, 0x07, 0x80, 0x00, 0xE0, 0xF0, 0x3C, 0x1E, 0x7F,
+    0xFC, 0x38, 0x3C, 0x78, 0x73, 0xC0, 0x07, 0xC6, 0x1E, 0xE1, 0xCE, 0x00, 0x00, 0xF1, 0x8F, 0xE3,
+    0x30, 0x3F, 0xFE, 0x1C, 0xC7, 0x76, 0xE1, 0xFF, 0xFF, 0xC7, 0x6E, 0x25, 0x87, 0xC0, 0x07, 0xF1,
+    0x84, 0x03, 0x1E, 0x00, 0x00, 0xFC, 0xC0, 0x12, 0x78, 0x00, 0x00, 0x3E, 0x48, 0x0E, 0xF0, 0x0F,
+    0xE0, 0x0F, 0x70, 0x07, 0xC0, 0x7F, 0xFF, 0x07, 0xE0, 0x03, 0x83, 0xF0, 0x1F, 0xC1, 0xC0, 0x00,
+    0x07, 0x80, 0x03, 0xF0, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3C, 0x07, 0xF0, 0x3C,
+    0x00, 0x00, 0x38, 0x3F, 0xFE, 0x1E, 0x00, 0x00, 0x3C, 0xC3, 0x25, 0x81, 0x3C, 0x00, 0x00, 0x1F,
+    0x18, 0x38, 0xF8, 0x00, 0x00, 0x0E, 0x40, 0x06, 0x30, 0x00, 0x00, 0x05, 0x87, 0xF1, 0xA0, 0x00,
+    0x00, 0x07, 0x3F, 0x7C, 0xE0, 0x00, 0x00, 0x03, 0xF7, 0xC7, 0xC0, 0x00, 0x00, 0x01, 0xD0, 0x03,
+    0x80, 0x81, 0x00, 0x01, 0xCF, 0xE3, 0x82, 0x00, 0x01, 0x98, 0x19, 0x82, 0x00, 0x01, 0x90, 0x09,
+    0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00,
+    0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03,
+    0x01, 0x80, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x01, 0x7F, 0xFF, 0x81,
+    0x00, 0x7F, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0x00, 0x1C, 0x7F, 0xFC, 0x3C, 0x00, 0x00, 0x63, 0xE0,
+    0x0F, 0x87, 0x00, 0x01, 0x9E, 0x00, 0x00, 0x71, 0xC0, 0x06, 0x70, 0x00, 0x00, 0x0C, 0x60, 0x09,
+    0xC0, 0x7F, 0xFF, 0x03, 0x10, 0x33, 0x01, 0xC0, 0x01, 0xC0, 0xCC, 0x64, 0x0E, 0x3F, 0xF8, 0x38,
+    0x26, 0xD8, 0x31, 0xE0, 0x0F, 0x0E, 0x11, 0x10, 0xCE, 0x00, 0x00, 0xE3, 0x08, 0x91, 0x98, 0x00,
+    0x00, 0x18, 0x89, 0x4A, 0x60, 0x03, 0x80, 0x06, 0x72, 0x24, 0xC0, 0x7F, 0xFF, 0x03, 0x24, 0x11,
+    0x03, 0xFC, 0x3F, 0xC0, 0x88, 0x0E, 0x0F, 0x8F, 0xE3, 0xF0, 0x70, 0x00, 0x1E, 0x7F, 0xFF, 0x78,
+    0x00, 0x00, 0x7B, 0xF0, 0x1F, 0xDE, 0x00, 0x00, 0xF7, 0x8F, 0xFB, 0xFF, 0x00, 0x00, 0xFE, 0x7F,
+    0xFE, 0x7F, 0x00, 0x00, 0x4D, 0xFF, 0xEF, 0xB2, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0xC2, 0x00, 0x00,
+    0x23, 0xFC, 0x13, 0x7F, 0xC4, 0x00, 0x00, 0x11, 0xE0, 0x07, 0x88, 0x00, 0x00, 0x0F, 0x80, 0x01,
+    0xF0, 0x00, 0x00, 0x02, 0x01, 0xC0, 0x40, 0x81, 0x00, 0x01, 0x1F, 0x78, 0x82, 0x00, 0x01, 0x31,
+    0x06, 0x82, 0x00, 0x01, 0xCF, 0xF3, 0x82, 0x00, 0x01, 0x10, 0x18, 0x82, 0x00, 0x01, 0x90, 0x09,
+    0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00,
+    0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03,
+    0x01, 0x80, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0x00, 0x01, 0x3F, 0xFE, 0x81,
+    0x00, 0x7F, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0x9F, 0xF1, 0xF8, 0x00, 0x00, 0x7D, 0xFF,
+    0xFF, 0x9E, 0x00, 0x01, 0xEF, 0xC0, 0x07, 0xF3, 0x80, 0x07, 0xBC, 0x00, 0x00, 0x7D, 0xE0, 0x0E,
+    0xF0, 0x3F, 0xFE, 0x0F, 0x70, 0x1B, 0xC1, 0xFF, 0xFF, 0xC3, 0xD8, 0x37, 0x0F, 0x9F, 0xF0, 0xF0,
+    0xEE, 0xEC, 0x3F, 0xFF, 0xFF, 0x3C, 0x37, 0x98, 0x77, 0x80, 0x03, 0xE7, 0x19, 0x81, 0xDE, 0x03,
+    0x80, 0x7B, 0x81, 0xCB, 0x30, 0x78, 0x3F, 0x1C, 0xD3, 0x6E, 0xE3, 0x83, 0xC0, 0xC7, 0x76, 0x31,
+    0x8C, 0x78, 0x3C, 0x13, 0x8C, 0x1F, 0x11, 0x80, 0x01, 0x88, 0xF8, 0x0E, 0x64, 0x00, 0x00, 0x66,
+    0x70, 0x00, 0x88, 0x0F, 0xF8, 0x11, 0x00, 0x00, 0x10, 0x70, 0x06, 0x08, 0x00, 0x00, 0x91, 0x87,
+    0xE1, 0x89, 0x00, 0x00, 0x4A, 0x30, 0x0C, 0x52, 0x00, 0x00, 0x24, 0x80, 0x03, 0x24, 0x00, 0x00,
+    0x11, 0x00, 0x07, 0x00, 0x88, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x81, 0x00, 0x01, 0x0E, 0x30,
+    0x82, 0x00, 0x01, 0x20, 0x04, 0x82, 0x00, 0x01, 0x46, 0xE0, 0x82, 0x00, 0x00, 0x10, 0x83, 0x00,
+    0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24, 0x82, 0x00, 0x01, 0x12,
+    0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82, 0x00, 0x03, 0x02, 0x40,
+    0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 0x00, 0x01, 0x7F, 0xFE, 0x81, 0x00, 0x7F,
+    0x03, 0x80, 0x00, 0xE0, 0x00, 0x00, 0x1C, 0x3F, 0xF8, 0x1C, 0x00, 0x00, 0x63, 0x80, 0x03, 0x82,
+    0x00, 0x01, 0x8C, 0x00, 0x00, 0x30, 0x80, 0x06, 0x20, 0x00, 0x00, 0x0C, 0x20, 0x08, 0x80, 0x7E,
+    0x7F, 0x03, 0x10, 0x12, 0x01, 0x80, 0x00, 0xC0, 0xC8, 0x64, 0x0C, 0x7F, 0xFC, 0x38, 0x22, 0x88,
+    0x31, 0x80, 0x01, 0x84, 0x11, 0x00, 0xCC, 0x07, 0xC0, 0x61, 0x00, 0x01, 0x10, 0x7F, 0xFF, 0x18,
+    0x80, 0x46, 0x43, 0xC7, 0xC1, 0xE4, 0x62, 0x20, 0x8E, 0x7F, 0xFE, 0x71, 0x04, 0x11, 0x1B, 0xC0,
+    0x07, 0x98, 0x88, 0x0C, 0x67, 0x00, 0x00, 0xE6, 0x70, 0x00, 0xCC, 0x0F, 0xF8, 0x33, 0x00, 0x00,
+    0x90, 0x7C, 0x1E, 0x19, 0x00, 0x00, 0x91, 0xCF, 0xF3, 0x89, 0x00, 0x00, 0x4B, 0x7E, 0x7C, 0xD2,
+    0x00, 0x00, 0x24, 0xE0, 0x07, 0x24, 0x00, 0x00, 0x11, 0x80, 0x01, 0x88, 0x00, 0x00, 0x0E, 0x0F,
+    0x01, 0xF0, 0x70, 0x81, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x47, 0xE2, 0x82, 0x00, 0x01,
+    0x98, 0x11, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80, 0x24,
+    0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20, 0x82,
+    0x00, 0x03, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x80, 0x00, 0x01, 0x3E,
+    0x7E, 0x81, 0x00, 0x3F, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x06, 0x3C, 0x78, 0x20, 0x00, 0x00,
+    0x10, 0x80, 0x03, 0x08, 0x00, 0x00, 0x22, 0x00, 0x00, 0x44, 0x00, 0x00, 0x48, 0x03, 0xE0, 0x02,
+    0x00, 0x00, 0x10, 0x30, 0x04, 0x08, 0x00, 0x00, 0x90, 0x81, 0x81, 0x09, 0x00, 0x00, 0x4A, 0x10,
+    0x18, 0x52, 0x00, 0x00, 0x24, 0x40, 0x02, 0x24, 0x00, 0x00, 0x11, 0x00, 0x00, 0x88, 0x00, 0x00,
+    0x0E, 0x0F, 0xF0, 0x70, 0x81, 0x00, 0x01, 0x30, 0x0C, 0x82, 0x00, 0x01, 0x47, 0xE2, 0x82, 0x00,
+    0x01, 0x98, 0x19, 0x82, 0x00, 0x01, 0x90, 0x09, 0x82, 0x00, 0x01, 0x48, 0x12, 0x82, 0x00, 0x80,
+    0x24, 0x82, 0x00, 0x01, 0x12, 0x48, 0x82, 0x00, 0x01, 0x09, 0x90, 0x82, 0x00, 0x01, 0x04, 0x20,
+    0x82, 0x00, 0x01, 0x02, 0x40, 0x82, 0x00, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const uint16_t PROGMEM animation_wifi_deltas[] = {
+    0, 202, 208, 214, 220, 354, 550, 756, 981, 1211, 1364, 1452,
+    1519, 1525, 1531, 1537, 1543, 1549, 1555, 1627, 1762, 1964, 2196, 2420,
+    2626, 2822, 2956, 2962, 2968, 2974,
+};
+static const PackedAnimation animation_wifi = {48, 48, 28, animation_wifi_deltas, animation_wifi_data};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+enum class ColorPreviewAction : uint8_t
+{
+  None,
+  Preview, // Show color on the ring
+  Reset    // Back to what the ring showed before
+};
+
+struct ColorPreviewRequest
+{
+  ColorPreviewAction action;
+  uint32_t color; // 0x00RRGGBB, for Preview
+};
+
+// Single-slot, latest-wins hand-off of color previews from the web server's
+// task to the loop task. Dragging the color picker sends previews faster than
+// the ring shows frames and only the newest one matters, so post() replaces
+// whatever is still waiting (counting it as dropped) and the loop take()s
+// the slot once per frame. A request packs into one word, so each side is a
+// single atomic exchange and neither ever blocks.
+//
+// One producer (the AsyncTCP task) and one consumer (the loop task).
+class ColorPreviewMailbox
+{
+public:
+  // Producer side
+  inline void post(ColorPreviewAction action, uint32_t color)
+  {
+    uint32_t word = (uint32_t)action << 24 | (color & 0xFFFFFF);
+    if (_slot.exchange(word, std::memory_order_acq_rel) != 0)
+    {
+      _dropped++;
+    }
+    _posted++;
+  }
+
+  // Consumer side; false if nothing arrived since the last take
+  inline bool take(ColorPreviewRequest &request)
+  {
+    uint32_t word = _slot.exchange(0, std::memory_order_acq_rel);
+    if (word == 0)
+    {
+      return false;
+    }
+    request.action = (ColorPreviewAction)(word >> 24);
+    request.color = word & 0xFFFFFF;
+    return true;
+  }
+
+  uint32_t getPosted() const { return _posted; }
+  uint32_t getDropped() const { return _dropped; } // Superseded before the loop took them
+
+private:
+  std::atomic<uint32_t> _slot{0}; // action << 24 | color; 0 when empty
+  volatile uint32_t _posted = 0;
+  volatile uint32_t _dropped = 0;
+};
@@ -3,6 +3,7 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 #include "Animation.h"
+#include "drivers/BufferedSSD1306.h"
 #include "managers/ProjectManager.h"
 
 class DisplayController
@@ -20,11 +21,11 @@ public:
   void drawDoneScreen(unsigned long finalElapsedTime);
   void drawAdjustScreen(int duration, bool wifi);
   void drawProvisionScreen();
-  void drawProjectSelectionScreen(const ProjectList &projects, int selectedIndex, int topIndex, int numToShow);
+  void drawProjectSelectionScreen(const String &projectName, int selectedIndex, int count);
   void clear();
 
-  void showAnimation(const byte frames[][288], int frameCount, bool loop = false, bool reverse = false, unsigned long durationMs = 0, int width = 48, int height = 48);
-  void updateAnimation();
+  void showAnimation(const PackedAnimation &frames, bool loop = false, bool reverse = false, unsigned long durationMs = 0);
+  void updateAnimation(); // Also hands the flush task a frame that was waiting for the bus
   bool isAnimationRunning();
 
   void showConfirmation();
@@ -36,7 +37,53 @@ public:
   void showTimerPause();
   void showTimerResume();
 
+  // Render-state cache: draw*Screen() only rasterizes and flushes when its inputs changed
+  void invalidate(); // Force the next draw*Screen() call to render
+  uint32_t getFramesRendered() const { return framesRendered; }
+  uint32_t getFramesSkipped() const { return framesSkipped; }
+  OledFlushStats getFlushStats() const { return oled.getFlushStats(); }
+  void printFlushStats();
+
+  // Draws digits as print() would in Org_01 at text size 5 with the cursor at
+  // (x, baseline), by copying prerendered columns (fonts/Org_01_digits.h)
+  // into the framebuffer. The pages the glyphs cover are overwritten, not
+  // ORed, so draw them first on a cleared screen. false, drawing nothing, if
+  // text has a non-digit or no alignment was prerendered for this baseline.
+  static bool blitLargeDigits(Adafruit_SSD1306 &oled, const char *text, int16_t x, int16_t baseline);
+
 private:
-  Adafruit_SSD1306 oled;
+  enum class Screen : uint8_t
+  {
+    None, // Panel content unknown (animation, clear), always render
+    Splash,
+    Idle,
+    Timer,
+    Paused,
+    Reset,
+    Done,
+    Adjust,
+    Provision,
+    ProjectSelect
+  };
+
+  // Logical inputs of the frame currently on the panel
+  struct RenderKey
+  {
+    Screen screen;
+    int32_t a;
+    int32_t b;
+    int32_t c;
+  };
+
+  BufferedSSD1306 oled;
   Animation animation;
+  RenderKey lastRender;
+  uint32_t framesRendered;
+  uint32_t framesSkipped;
+
+  bool needsRender(Screen screen, int32_t a = 0, int32_t b = 0, int32_t c = 0);
+
+  void flush(); // oled.present(), timed
+  void flushWindow(int16_t x, int16_t y, int16_t w, int16_t h); // The same for a rectangle
+  void drawLargeDigits(const char *text, int16_t x, int16_t baseline); // Blitted, else printed
 };
@@ -2,8 +2,11 @@
 
 #include <Arduino.h>
 #include <OneButton.h>
-#include <RotaryEncoder.h>
 #include <functional>
+#include "controllers/InputEdgeRing.h"
+
+#define INPUT_POLL_INTERVAL_MS 5 // Button polling while OneButton is mid-gesture
+#define BUTTON_DEBOUNCE_US 20000 // Button level must hold this long to count
 
 class InputController
 {
@@ -19,9 +22,14 @@ public:
 
     void releaseHandlers();
 
+    // Diagnostics
+    long getEncoderPosition() const;    // Detents since boot
+    uint32_t getDroppedEdges() const;   // Edges lost to a full ring (should stay 0)
+    uint32_t getEdgeHighWater() const;  // Deepest the ring has been
+
 private:
     OneButton button;
-    RotaryEncoder encoder;
+    InputEdgeRing edges; // Filled by the pin ISR, drained in update()
 
     uint8_t buttonPin;
     uint8_t encoderPinA;
@@ -32,15 +40,28 @@ private:
     std::function<void()> longPressHandler = nullptr;
     std::function<void(int delta)> encoderRotateHandler = nullptr;
 
+    // Quadrature decoding (same table and TWO03 latching as RotaryEncoder)
+    uint8_t quadratureState;
+    long quadratureSteps;
+    long encoderPosition;
     int lastPosition;
 
+    // Button debouncing on ISR timestamps
+    bool buttonLevel;        // Debounced level fed to OneButton
+    bool pendingButtonLevel; // Latest raw level
+    uint32_t pendingButtonSince;
+
+    void decodeQuadrature(uint8_t levels);
+    void decodeButton(const InputEdge &edge);
+    void commitButtonLevel(bool pressed);
+
     void onButtonClick();
     void onButtonDoubleClick();
     void onButtonLongPress();
     void onEncoderRotate(int delta);
 
-    static void handleEncoderInterrupt();
-    static void handleButtonInterrupt();
+    static uint8_t sampleLevels();
+    static void handlePinInterrupt();
 };
 
 extern InputController inputController;
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+
+#define INPUT_EDGE_RING_SIZE 256 // Power of two; covers a bouncy 1 kHz spin through a full-frame OLED flush
+
+// Pin levels sampled by the ISR, as bits of InputEdge::levels
+#define INPUT_LEVEL_A 0x01
+#define INPUT_LEVEL_B 0x02
+#define INPUT_LEVEL_BUTTON 0x04 // Set while the button is pressed
+
+struct InputEdge
+{
+  uint32_t timeMicros;
+  uint8_t levels;
+};
+
+// Lock-free single-producer/single-consumer ring. The pin ISR is the only
+// producer and InputController::update() the only consumer, so each index is
+// written by one side only and the acquire/release pair publishes the slot.
+class InputEdgeRing
+{
+public:
+  // ISR side; a full ring drops the edge and counts it
+  inline bool push(const InputEdge &edge)
+  {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t used = head - _tail.load(std::memory_order_acquire);
+    if (used >= INPUT_EDGE_RING_SIZE)
+    {
+      _overflows++;
+      return false;
+    }
+    _edges[head & (INPUT_EDGE_RING_SIZE - 1)] = edge;
+    _head.store(head + 1, std::memory_order_release);
+    if (used + 1 > _highWater)
+    {
+      _highWater = used + 1;
+    }
+    return true;
+  }
+
+  // Task side
+  inline bool pop(InputEdge &edge)
+  {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+    edge = _edges[tail & (INPUT_EDGE_RING_SIZE - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  uint32_t getOverflows() const { return _overflows; }
+  uint32_t getHighWater() const { return _highWater; }
+
+private:
+  InputEdge _edges[INPUT_EDGE_RING_SIZE];
+  std::atomic<uint32_t> _head{0}; // Free-running; masked on access
+  std::atomic<uint32_t> _tail{0};
+  volatile uint32_t _overflows = 0;
+  volatile uint32_t _highWater = 0;
+};
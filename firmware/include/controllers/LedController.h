@@ -1,7 +1,9 @@
 #pragma once
 
-#include <Adafruit_NeoPixel.h>
 #include <Arduino.h>
+#include "drivers/NeoPixelRmt.h"
+
+#define LED_FRAME_INTERVAL_MS 16 // Frame tick: at most ~60 frames/s go out to the ring
 
 // Define animation constants here or move to Config.h
 // const float RADAR_SWEEP_SPEED_LEDS_PER_SEC = 4.0f; // Original speed
@@ -15,8 +17,10 @@ public:
 
   void begin();
   void update();
+  void flush(); // Frame tick: send the composed frame if it changed; call once per loop pass
 
-  void startFillAndDecay(uint32_t color, uint32_t totalDuration);
+  // elapsedMs resumes a countdown part way through: only what is left lights up
+  void startFillAndDecay(uint32_t color, uint32_t totalDuration, uint32_t elapsedMs = 0);
   void setSpinner(uint32_t color, int cycles);
   void setBreath(uint32_t color, int cycles, bool endFilled, uint32_t speed);
   void setSolid(uint32_t color);
@@ -27,10 +31,15 @@ public:
 
   // New preview mode methods
   void setPreviewMode(bool enabled);
-  void setPreviewColor(const String &hexColor);
+  void setPreviewColor(uint32_t color);
   void resetPreviewColor();
   bool isInPreviewMode() const;
 
+  // Frame statistics
+  uint32_t getFramesShown() const;   // Frames sent to the ring
+  uint32_t getFramesSkipped() const; // Frames identical to the one already showing
+  void printFrameStats();
+
   // Add color conversion utility
   static inline uint32_t hexColorToUint32(const String &hexColor)
   {
@@ -43,16 +52,15 @@ public:
     // Use c_str() to get pointer, then offset by 1
     long number = strtol(hexColor.c_str() + 1, NULL, 16);
 
-    // NeoPixel uses 0x00RRGGBB format, ensure correct conversion if needed.
+    // Frames use 0x00RRGGBB; the driver reorders to GRB on the wire.
     // strtol directly parses the hex value correctly.
     return (uint32_t)number;
   }
 
 private:
-  Adafruit_NeoPixel leds;
+  NeoPixelRmt strip;
   uint16_t numLeds;
   uint8_t brightness;
-  int brightnessLevel;
 
   enum AnimationType
   {
@@ -62,23 +70,24 @@ private:
     Breath,
     RadarSweep // Added new animation type
   } currentAnimation;
-  unsigned long lastUpdateTime;
+
+  // Animations are rendered from the time since animationStart alone, so the
+  // ring shows the same frame however often (or late) update() runs
+  unsigned long animationStart;
+  unsigned long fillStart; // FillAndDecay: when the quick fill began (after animationStart on resume)
 
   uint32_t animationColor;
   uint32_t animationDuration;
   uint32_t animationSpeed;
 
-  int currentStep;
-  int currentCycle;
-  int pixelIndex;
   int animationCycles;
   bool endFilled;
-  bool decayStarted;
 
   // Preview mode variables
   bool previewMode;
   uint32_t lastColor;
   AnimationType lastAnimation;
+  unsigned long lastAnimationStart;
 
   // Animation handling methods
   void handleFillAndDecay();
@@ -89,15 +98,28 @@ private:
   // Reset animation state
   void stopCurrentAnimation();
 
+  // Deadline reported to the scheduler while an animation runs
+  unsigned long nextUpdateTime() const;
+
+  uint64_t decaySteps(unsigned long elapsed) const; // FillAndDecay progress on the countdown timeline
+  uint32_t radarStepMs() const;                     // Time for the sweep head to move one LED
+
+  // Frame compositor: animations draw into frame, flush() sends it
+  uint32_t frame[NEOPIXEL_MAX_LEDS];
+  uint32_t sentFrame[NEOPIXEL_MAX_LEDS];
+  bool framePending;
+  bool frameSent;
+  unsigned long lastShowTime;
+  uint32_t framesShown;
+  uint32_t framesSkipped;
+
+  void setPixel(uint16_t index, uint32_t color);
+  void fillFrame(uint32_t color);
+  void commitFrame();
+
   // Helper to scale color by brightness
   uint32_t scaleColor(uint32_t color, uint8_t brightness);
 
-  // New members for Radar Sweep state
-  uint32_t sweepColor;
-  float sweepPosition;
-  unsigned long lastSweepUpdate; // Reuse lastUpdateTime? Maybe dedicated one is clearer
-  // Let's use lastUpdateTime for simplicity unless conflicts arise
-
   // Save/restore state before/after preview
   void saveCurrentState();
   void restoreLastState();
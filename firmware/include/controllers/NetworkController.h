@@ -8,6 +8,18 @@
 #include <ESPmDNS.h>
 #include <ArduinoJson.h>
 #include "ProjectData.h"
+#include "managers/WebhookOutbox.h"
+#include "managers/WebhookConnection.h"
+#include "controllers/ColorPreviewMailbox.h"
+#include <atomic>
+
+#define WEBHOOK_BATCH_MAX 8     // Events per POST when the endpoint accepts batches
+#define WEBHOOK_BODY_SIZE 2048  // Static POST body; a batch stops at the last event that fits
+
+#define WS_STATE_INTERVAL_MS 1000 // Timer ticks go out at most this often; transitions go out at once
+#define WS_STATE_FRAME_SIZE 192   // {"state":...} frame; a project id too long for it is left out
+
+class State;
 
 // Define reasonable default sizes for JSON documents used in API handlers
 // Adjust these based on MAX_PROJECTS and expected name/color lengths
@@ -31,11 +43,27 @@ public:
   void initializeBluetooth();
   void startBluetooth();
   void stopBluetooth();
-  void sendWebhookAction(const String &action, int durationSetMinutes, unsigned long actualElapsedSeconds);
-
-  // New methods for WebSocket color preview
-  void handleColorPreview(const String &hexColor);
+  void sendWebhookAction(WebhookAction action, int durationSetMinutes, unsigned long actualElapsedSeconds);
+  // One delivery round of the webhook task: the oldest event, or up to
+  // WEBHOOK_BATCH_MAX of them when the endpoint accepts batches. Returns
+  // false if anything is left to retry after a backoff.
+  bool deliverWebhooks();
+
+  // WebSocket color previews. The web server's task only posts them; the
+  // loop applies the newest once per frame.
+  void applyColorPreview();
+  void handleColorPreview(uint32_t color);
   void handleColorReset();
+  uint32_t getColorPreviewsPosted() const { return colorPreviews.getPosted(); }
+  uint32_t getColorPreviewsDropped() const { return colorPreviews.getDropped(); }
+
+  // Live timer state for the web UI, called from the loop after the state
+  // machine: a frame on every state change, on each new elapsed second at
+  // most every WS_STATE_INTERVAL_MS while the timer runs, and when a client
+  // connects
+  void publishTimerState();
+  uint32_t getStateFramesSent() const { return _stateFramesSent; }
+  uint32_t getWebSocketClientsDropped() const { return _wsClientsDropped; }
 
   void startWebServer();
 
@@ -49,6 +77,14 @@ private:
   // WebSocket server
   AsyncWebSocket _ws;
   unsigned long _lastWsCleanupTime;
+  ColorPreviewMailbox colorPreviews;
+  std::atomic<bool> _stateSnapshotWanted; // A client connected since the last frame
+  const State *_statePublished;           // As of the last frame
+  uint32_t _elapsedPublished;
+  unsigned long _statePublishedAt;
+  char _stateFrame[WS_STATE_FRAME_SIZE];
+  uint32_t _stateFramesSent;
+  uint32_t _wsClientsDropped; // Frames at which a client was closed for falling WS_MAX_QUEUED_MESSAGES behind
 
   String webhookURL;
   String apiKey; // Added to store API Key
@@ -71,9 +107,9 @@ private:
   // WebSocket handlers
   void _onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocketClient *client,
                          AwsEventType type, void *arg, uint8_t *data, size_t len);
-  void _handleWebSocketMessage(const String &message, uint32_t clientId);
+  void _handleWebSocketMessage(const uint8_t *data, size_t len, uint32_t clientId);
   void _cleanupWebSocketClients();
-  void _broadcastWebSocketMessage(const String &message);
+  void _broadcastWebSocketMessage(const char *message, size_t len);
 
   // --- API Route Handlers (Member Functions) ---
   void handleGetProjects(AsyncWebServerRequest *request);
@@ -89,15 +125,26 @@ private:
   void handleUpdateWebhook(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total);
   void handleGetApiKeyStatus(AsyncWebServerRequest *request); // New handler for GET API Key status
   void handleUpdateApiKey(AsyncWebServerRequest *request);    // New handler for POST API Key
+  void handleGetMetrics(AsyncWebServerRequest *request);
+  void handleGetIndex(AsyncWebServerRequest *request); // The web UI's page; assets are served statically
 
   // Tasks
   TaskHandle_t bluetoothTaskHandle;
   TaskHandle_t webhookTaskHandle;
-  QueueHandle_t webhookQueue;
+
+  // Webhook events wait here until the server acknowledges them
+  WebhookOutbox webhookOutbox;
+  WebhookConnection webhookConnection; // Used only by the webhook task
+  WebhookEvent webhookBatch[WEBHOOK_BATCH_MAX]; // Webhook task's copy of the events being sent
+  uint32_t webhookCaptureAllocs;   // Heap allocations while capturing events (expected 0)
+  uint32_t webhookSerializeAllocs; // Heap allocations while serializing bodies (expected 0)
 
   static void bluetoothTask(void *param);
   static void webhookTask(void *param);
-  bool sendWebhookRequest(const String &action);
+  int sendWebhookRequest(const WebhookEvent &event, uint32_t seq); // HTTP status, or a negative HTTPC_ERROR_*
+  int32_t webhookEventAge(const WebhookEvent &event, uint32_t seq);
+  bool sendWebhookBatch(const WebhookEvent events[], const uint32_t seqs[], uint8_t count);
+  bool settleWebhookEvent(uint32_t seq, int status); // Acks or rejects it; false if it should be retried
 
   static NetworkController *instance;
 
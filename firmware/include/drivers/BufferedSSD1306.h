@@ -0,0 +1,101 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <driver/i2c.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+#define OLED_FLUSH_TASK_STACK 2048
+#define OLED_FLUSH_TASK_PRIORITY 2 // Above the loop, so a handed-over frame goes on the bus at once
+#define OLED_FLUSH_TASK_CORE 1
+#define OLED_FLUSH_TIMEOUT_MS 100
+#define OLED_FLUSH_I2C_PORT I2C_NUM_0 // Where Wire has the IDF driver installed
+#define OLED_FLUSH_TRANSACTIONS 4     // Sizes the command link: the window, then up to 8 pages of data
+
+// Cumulative since boot. A frame presented is flushed or dropped, once the
+// flush task has caught up.
+struct OledFlushStats
+{
+  uint32_t presented;        // present() calls
+  uint32_t flushes;          // Transfers completed, by the flush task or synchronously
+  uint32_t foundBusy;        // present() calls that found a transfer still running
+  uint32_t dropped;          // Frames presented again before they went out, or after failing to
+  uint32_t errors;           // Transfers the panel did not acknowledge; their window is sent again
+  uint64_t flushMicrosTotal; // Bus time of the completed transfers
+  uint32_t flushMicrosMax;
+};
+
+// Adafruit_SSD1306 with a second framebuffer and a task that sends it.
+//
+// Drawing goes to the back buffer as always. present() swaps it with the
+// front buffer, copies the new front into the back one so drawing carries on
+// from the same frame, and notifies the flush task, which sends the front
+// buffer (or the window of it that changed) through the ESP-IDF I2C driver.
+// The loop pays for a 1 KB copy instead of holding the bus for the 20-25 ms
+// a full display() takes at 400 kHz.
+//
+// A frame presented while a transfer is still running waits in the back
+// buffer and goes out as soon as the bus is free (service()); presenting
+// again before that merges into it, and the older frame counts as dropped.
+// A transfer that fails is retried from the back buffer at the next
+// hand-over, merged with whatever waits there.
+//
+// Without startFlushTask(), or if it fails, present() writes through Wire
+// and blocks, as display() does.
+class BufferedSSD1306 : public Adafruit_SSD1306
+{
+public:
+  // The bus runs at clock for the panel's transfers and stays there
+  BufferedSSD1306(uint8_t w, uint8_t h, TwoWire *twi, uint8_t address, uint32_t clock);
+  ~BufferedSSD1306();
+
+  // After begin(); false, staying synchronous, if the I2C driver or the panel does not answer
+  bool startFlushTask();
+  bool isBuffered() const { return front != nullptr; }
+
+  // The whole frame, or just the framebuffer under a rectangle: its columns
+  // of every page it touches, after setting that window with COLUMNADDR/PAGEADDR
+  void present();
+  void present(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // From the loop every pass: hands over a frame that found the bus busy,
+  // or one to send again
+  void service();
+
+  // A copy, from any task: the flush task updates them as it goes
+  OledFlushStats getFlushStats() const;
+
+private:
+  // Inclusive, in panel columns and pages
+  struct Window
+  {
+    int16_t firstColumn;
+    int16_t lastColumn;
+    int16_t firstPage;
+    int16_t lastPage;
+  };
+
+  uint8_t address;
+  uint8_t *front; // The flush task's while flushing
+  TaskHandle_t task;
+  Window job;     // Part of the front buffer being sent
+  Window waiting; // Part of the back buffer presented since the last hand-over
+  std::atomic<bool> frameWaiting;
+  std::atomic<bool> flushing;
+  std::atomic<bool> resend; // The last transfer failed: job goes out again
+  uint8_t link[I2C_LINK_RECOMMENDED_SIZE(OLED_FLUSH_TRANSACTIONS)];
+  OledFlushStats stats;
+  mutable portMUX_TYPE statsLock = portMUX_INITIALIZER_UNLOCKED; // flushMicrosTotal is two words
+
+  bool clip(int16_t x, int16_t y, int16_t w, int16_t h, Window &window) const;
+  static void merge(Window &into, const Window &window);
+  void recordFlush(uint32_t elapsed);
+  void present(const Window &window);
+  void handOver();
+  void writeWindow(const Window &window); // Blocking, through Wire
+
+  static void flushTask(void *param);
+  void transfer();
+};
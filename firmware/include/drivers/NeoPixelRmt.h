@@ -0,0 +1,30 @@
+#pragma once
+
+#include <Arduino.h>
+#include <driver/rmt.h>
+
+#define NEOPIXEL_RMT_CHANNEL RMT_CHANNEL_0
+#define NEOPIXEL_MAX_LEDS 16      // Sizes the static item buffer (one RMT item per bit)
+#define NEOPIXEL_RMT_MEM_BLOCKS 7 // 7 x 64 items hold a whole 16-LED frame, so no refill interrupts
+
+// WS2812 (GRB, 800 kHz) output on the RMT peripheral. write() encodes a frame
+// into RMT items and starts the transmission without waiting for it: the
+// peripheral clocks the frame out from its own RAM while the CPU and the
+// input interrupts carry on, instead of blocking in show().
+class NeoPixelRmt
+{
+public:
+  NeoPixelRmt(uint8_t pin, uint16_t numLeds);
+
+  bool begin();
+  bool isBusy() const; // Previous frame still on the wire
+
+  // Colours are 0x00RRGGBB; brightness scales like Adafruit_NeoPixel::setBrightness()
+  bool write(const uint32_t *colors, uint8_t brightness);
+
+private:
+  uint8_t pin;
+  uint16_t numLeds;
+  bool ready;
+  rmt_item32_t items[NEOPIXEL_MAX_LEDS * 24];
+};
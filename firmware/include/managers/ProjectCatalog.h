@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Arduino.h>
+#include "DataFS.h"
+#include <vector>
+#include "ProjectData.h"
+
+#define PROJECT_CATALOG_DIRECTORY_PATH "/projects/dir.bin"
+#define PROJECT_CATALOG_DIRECTORY_TMP_PATH "/projects/dir.tmp"
+#define PROJECT_CATALOG_IDS_PATH "/projects/ids.bin"
+#define PROJECT_CATALOG_IDS_TMP_PATH "/projects/ids.tmp"
+#define PROJECT_CATALOG_IDS_LOG_PATH "/projects/ids.log"
+#define PROJECT_CATALOG_PAGE_TMP_PATH "/projects/page.tmp"
+#define PROJECT_PAGE_SLOTS 32     // Projects per page file; a page is what a cursor holds in RAM
+#define PROJECT_ID_LOG_ENTRIES 64 // New ids kept out of the sorted index until it is merged
+
+#define PROJECT_RECORD_VERSION 1
+
+// How a project is stored, in a page file and in the old NVS records:
+// this header, then the id, then the name
+struct __attribute__((packed)) ProjectRecordHeader
+{
+  uint8_t version;
+  uint8_t rgb[3]; // "#RRGGBB" packed
+  uint8_t idLength;
+  uint8_t nameLength;
+};
+
+#define PROJECT_RECORD_MAX (sizeof(ProjectRecordHeader) + 255 + MAX_PROJECT_NAME_BYTES)
+
+// "#RRGGBB" -> three bytes; false if it is not a hex color
+bool packProjectColor(const String &color, uint8_t rgb[3]);
+// Returns the record length, or 0 if the project can't be stored
+size_t encodeProjectRecord(const Project &project, uint8_t *record);
+// Fills project from a whole record, reusing its String buffers
+bool decodeProjectRecord(const uint8_t *record, size_t length, Project &project);
+
+// Page id << 8 | slot. It stays put while the project exists and is never
+// given to another project, so it doubles as a handle.
+typedef uint32_t ProjectLocation;
+const ProjectLocation NO_PROJECT_LOCATION = 0xFFFFFFFF;
+
+// One page file as the directory tracks it
+struct CatalogPage
+{
+  uint32_t deleted; // Bit per slot
+  uint16_t id;      // Names the file; ids only grow, so the directory is sorted by id
+  uint8_t used;     // Slots written, deleted or not; a new project takes the next one
+  uint8_t live;     // used minus deleted
+};
+
+// The live projects of one page, decoded, in catalog order
+struct ProjectPage
+{
+  int first = -1;      // Catalog index of projects[0], -1 when nothing is loaded
+  uint8_t count = 0;
+  uint32_t generation; // ProjectCatalog::generation() when it was read
+  Project projects[PROJECT_PAGE_SLOTS];
+  ProjectLocation locations[PROJECT_PAGE_SLOTS];
+};
+
+struct ProjectCatalogStats
+{
+  uint32_t pageReads;   // Page files opened to read projects
+  uint32_t indexReads;  // Entries read from the sorted id index
+  uint32_t indexMerges; // Times the id log was merged into the index
+};
+
+// The project list on the data partition (DataFS), so it isn't bounded by RAM or by an NVS
+// entry. Projects live in page files of PROJECT_PAGE_SLOTS records
+// ("/projects/p<id>.bin"); the directory (which pages, in order, and which of
+// their slots are deleted) is the only part kept in RAM, 8 bytes a page.
+// Lookup by id goes through a file of (FNV-1a hash, location) pairs sorted by
+// hash plus a short append-only log of newer ids; since the hashes are
+// uniform, an interpolation search finds an id in one or two reads whatever
+// the catalog size.
+//
+// Writes go in an order that a reset can interrupt anywhere: an id is logged
+// before its record is written, and a record before the directory lists it.
+// Every index hit is checked against the directory and the stored id, so a
+// stale or dangling index entry costs a read, never a wrong answer.
+//
+// Not thread-safe; ProjectManager serializes access.
+class ProjectCatalog
+{
+public:
+  ProjectCatalog();
+
+  bool load();   // false if there is no readable catalog
+  bool create(); // Starts an empty catalog
+
+  size_t count() const { return total; }
+  size_t indexBytes() const { return indexEntries * sizeof(IdEntry); } // Size of the sorted id index file
+  uint32_t generation() const { return changes; } // Moves on every change
+
+  ProjectLocation locationOf(size_t index) const;
+  int indexOf(ProjectLocation location) const; // -1 once deleted
+
+  // Reads the page holding the index-th project
+  bool readPage(size_t index, ProjectPage &page);
+  bool read(ProjectLocation location, Project &project);
+  ProjectLocation find(const String &deviceProjectId);
+
+  ProjectLocation append(const Project &project);
+  bool update(ProjectLocation location, const Project &project);
+  bool remove(ProjectLocation location);
+
+  const ProjectCatalogStats &getStats() const { return stats; }
+
+private:
+  struct IdEntry
+  {
+    uint32_t hash;
+    ProjectLocation location;
+  };
+
+  std::vector<CatalogPage> pages;
+  size_t total;
+  uint32_t changes;
+  uint16_t nextPageId;
+  uint32_t indexEntries; // In the sorted file
+  IdEntry idLog[PROJECT_ID_LOG_ENTRIES];
+  uint8_t idLogCount;
+  uint8_t recordBuffer[PROJECT_RECORD_MAX];
+  ProjectCatalogStats stats;
+
+  int pageOf(uint16_t id) const; // Directory position, -1 if gone
+  bool isLive(ProjectLocation location) const;
+  bool writeDirectory();
+  bool readRecord(File &file, uint8_t *buffer, size_t &length);
+  bool seekSlot(File &file, uint8_t slot);
+  bool matches(ProjectLocation location, const String &deviceProjectId);
+  bool logId(uint32_t hash, ProjectLocation location);
+  bool mergeIdLog();
+  uint32_t lowerBound(File &file, uint32_t hash);
+  static void pagePath(uint16_t id, char path[24]);
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+#include "DataFS.h"
+#include <vector>
+
+#define PROJECT_JOURNAL_PATH "/projects/journal.log"
+#define PROJECT_JOURNAL_TMP_PATH "/projects/journal.tmp"
+#define PROJECT_JOURNAL_MAX_ENTRIES 512 // Then the oldest are dropped, down to PROJECT_JOURNAL_KEEP
+#define PROJECT_JOURNAL_KEEP 256
+
+// Which projects changed, by revision, so a client that synced at one
+// revision can fetch only what changed since. Every add, edit and delete is
+// one entry: the new revision and the id of the project it touched. The entry
+// doesn't say what happened; whoever reads it looks the id up in the catalog,
+// and an id that is no longer there was deleted. So an entry can be logged
+// before its change is made, and a reset in between costs a spurious entry,
+// never a missed change.
+//
+// The revision only grows and survives reboots. The journal keeps the last
+// PROJECT_JOURNAL_KEEP to PROJECT_JOURNAL_MAX_ENTRIES changes; a revision
+// older than that, or one from another journal (id() is random per journal,
+// so a wiped filesystem starts a new one), can't be answered with a delta.
+//
+// Not thread-safe; ProjectManager serializes access.
+class ProjectJournal
+{
+public:
+  ProjectJournal();
+
+  bool load();   // false if there is no readable journal
+  bool create(); // Starts a new journal at revision 1, so "since 0" is never covered
+
+  uint32_t id() const { return journalId; }
+  uint32_t revision() const { return current; }
+  bool covers(uint32_t since) const { return since >= base && since <= current; }
+
+  bool record(const String &deviceProjectId); // Moves the revision on
+  // Each id changed after since, once; false if !covers(since)
+  bool changedSince(uint32_t since, std::vector<String> &deviceProjectIds);
+
+  uint32_t size() const { return entries; }
+
+private:
+  uint32_t journalId;
+  uint32_t base;    // Oldest revision the entries reach back to
+  uint32_t current; // Revision of the last entry
+  uint32_t entries;
+
+  bool compact(uint32_t keep); // Rewrites the file with the newest keep entries
+};
@@ -4,44 +4,110 @@
 #include <Arduino.h>
 #include <Preferences.h>
 #include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include "ProjectData.h"
+#include "managers/ProjectCatalog.h"
+#include "managers/ProjectJournal.h"
+#include "managers/SettingsStore.h"
+
+// Refers to one project for as long as it exists. Adding or deleting other
+// projects doesn't invalidate it; ProjectManager::get() returns nullptr once
+// the project itself is deleted.
+struct ProjectHandle
+{
+  ProjectLocation location = NO_PROJECT_LOCATION;
+
+  bool isValid() const { return location != NO_PROJECT_LOCATION; }
+};
+
+class ProjectManager;
+
+// Walks the catalog by index with one page of projects in RAM, so the list
+// never has to be materialized. Each cursor has its own page; after the
+// catalog changes, the next move rereads it.
+class ProjectCursor
+{
+public:
+  explicit ProjectCursor(ProjectManager &manager);
+
+  int count() const;
+  bool seek(int index); // false, leaving the cursor where it was, if out of range
+  bool next();
+  bool prev();
+  int position() const { return _position; } // -1 before the first successful seek
+
+  // Valid after a successful move, until the next one
+  const Project &current() const { return _page.projects[_position - _page.first]; }
+  ProjectHandle handle() const;
+
+private:
+  ProjectManager &_manager;
+  ProjectPage _page;
+  int _position;
+};
 
 class ProjectManager
 {
 public:
   ProjectManager();
 
-  // Call in setup() to load data from NVS
+  // Call in setup() to mount the catalog (migrating an NVS project list)
   bool begin();
 
   // Accessors
-  const ProjectList &getProjects() const;
+  int count() const;
   int getLastProjectIndex() const;
 
-  // Modifiers (handle NVS saving internally)
+  // Lookup by device_project_id through the catalog's id index
+  ProjectHandle findById(const String &deviceProjectId);
+  // Loop task only: points at a copy that the next get() may replace
+  const Project *get(const ProjectHandle &handle);
+  int indexOf(const ProjectHandle &handle); // -1 once deleted
+
+  // Modifiers (handle flash writes internally)
   bool addProject(const JsonObject &projectData);
   bool updateProject(int index, const Project &project);
   bool deleteProject(int index);
   bool deleteProjectById(const String &deviceProjectId);
   void setLastProjectIndex(int index);
 
+  // Moves on every change to the list and survives reboots. The epoch names
+  // the change journal, which only a wiped filesystem replaces, so the pair
+  // names one version of the list.
+  uint32_t getRevision() const;
+  uint32_t getRevisionEpoch() const;
+
+  // What changed after revision since: the projects that still exist and the
+  // ids of the ones deleted, as of the returned revision. false when the
+  // journal no longer reaches back that far; only the whole list will do then.
+  bool changedSince(uint32_t since, std::vector<ProjectHandle> &changed, std::vector<String> &deleted, uint32_t &revision);
+  bool read(const ProjectHandle &handle, Project &project); // From any task
+
+  const ProjectCatalogStats &getCatalogStats() const { return _catalog.getStats(); }
+
 private:
+  friend class ProjectCursor;
+
   Preferences _preferences;
-  ProjectList _projects;
-  int _lastProjectIndex;
+  ProjectCatalog _catalog;
+  ProjectJournal _journal; // Each change is recorded before it is made
+  SemaphoreHandle_t _lock; // The web server's task edits while the loop task reads
+  Project _lookup; // What get() hands out
+  ProjectLocation _lookupLocation;
+  uint32_t _lookupGeneration;
 
-  // NVS interaction helpers
-  bool _loadProjectsFromNVS();
-  bool _saveProjectsToNVS();
-  bool _loadLastIndexFromNVS();
-  bool _saveLastIndexToNVS();
+  bool _readPage(int index, ProjectPage &page); // For cursors
+  bool _deleteLocation(ProjectLocation location);
+  bool _hasRoomForProject(); // Under the lock
 
-  // JSON serialization/deserialization
-  bool _serializeProjects(JsonDocument &doc);
-  bool _deserializeProjects(JsonDocument &doc);
+  // One-time migration of the JSON list under NVS_PROJECTS_KEY that came
+  // before the catalog
+  bool _loadLegacyJson(const String &jsonString, ProjectList &projects);
+  bool _migrateProjects(const ProjectList &projects);
 
   // Unique ID generation
   String _generateNextDeviceId();
 };
 
-#endif // PROJECT_MANAGER_H
\ No newline at end of file
+#endif // PROJECT_MANAGER_H
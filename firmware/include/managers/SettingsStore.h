@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define SETTINGS_COMMIT_DELAY_MS 5000 // Quiet time after the last change before it is written anyway
+
+// Cumulative since boot; take differences for a window
+struct SettingsStats
+{
+  uint32_t changes;     // Setter calls that changed a value
+  uint32_t coalesced;   // Changes to a value that was already waiting to be written
+  uint32_t commits;     // Commits that had something to write
+  uint32_t keysWritten; // NVS keys put or removed
+  uint32_t failures;    // Commits that could not write everything (retried later)
+};
+
+// The device's settings, held in RAM and written behind. Setters only mark
+// a value dirty; commit() writes every dirty key at once, opening each NVS
+// namespace a single time. The loop commits when the device goes back to
+// Idle or to sleep, and update() commits anyway once nothing has changed for
+// SETTINGS_COMMIT_DELAY_MS, so turning the dial or a burst of web edits ends
+// in one flash write instead of one per change.
+//
+// Keys and namespaces are the ones the firmware always used, so settings
+// survive the update. WiFi credentials stay with WiFiProvisioner.
+//
+// Safe to call from the web server's task as well as the loop task.
+class SettingsStore
+{
+public:
+  SettingsStore();
+
+  bool begin(); // Loads every setting; call first in setup()
+
+  int getTimer() const;
+  void setTimer(int minutes);
+  int getLastProjectIndex() const; // -1 for "No Project"
+  void setLastProjectIndex(int index);
+  uint32_t getProjectIdCounter() const;
+  void setProjectIdCounter(uint32_t counter);
+  bool getBluetoothPaired() const;
+  void setBluetoothPaired(bool paired);
+  String getWebhookUrl() const;
+  void setWebhookUrl(const String &url); // Empty removes it
+  String getApiKey() const;
+  void setApiKey(const String &key);
+  bool hasApiKey() const; // Stored at all, even if empty
+
+  void update();  // Loop task: commits once changes have settled
+  bool commit();  // Writes whatever is dirty, now
+  bool isDirty() const;
+
+  SettingsStats getStats() const;
+
+private:
+  enum Key : uint8_t
+  {
+    KeyTimer,
+    KeyLastProject,
+    KeyProjectIdCounter,
+    KeyBluetoothPaired,
+    KeyWebhookUrl,
+    KeyApiKey,
+    KeyCount
+  };
+
+  SemaphoreHandle_t lock;
+  int32_t timer;
+  int32_t lastProject;
+  uint32_t projectIdCounter;
+  bool bluetoothPaired;
+  String webhookUrl;
+  String apiKey;
+  bool apiKeyStored;
+  uint8_t dirty; // Bit per Key
+  unsigned long lastChange;
+  SettingsStats stats;
+
+  void markDirty(Key key); // With the lock held
+  bool writeKey(Preferences &nvs, Key key);
+};
+
+extern SettingsStore settings;
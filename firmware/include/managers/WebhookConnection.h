@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include "Metrics.h"
+
+#define WEBHOOK_IDLE_CLOSE_MS 60000 // Free the socket (and ~40 KB of TLS buffers) after a minute unused
+#define WEBHOOK_HTTP_TIMEOUT_MS 5000
+#define WEBHOOK_BATCH_HEADER "X-Webhook-Batch" // Sent as "1" by endpoints that accept a JSON array of events
+
+struct WebhookConnectionStats
+{
+  uint32_t requests;     // POSTs attempted
+  uint32_t handshakes;   // New connections: TCP connect plus, for https, a full TLS handshake
+  uint32_t reused;       // Requests sent on an already open connection
+  uint32_t staleRetries; // Kept-alive connections the server had already closed
+  uint32_t failures;     // Requests that got no HTTP status at all
+};
+
+// Long-lived connection for webhook POSTs, owned by the webhook task. The
+// WiFiClient/WiFiClientSecure and HTTPClient live as long as the controller,
+// so consecutive events (an outbox backlog, a start right after a stop) go
+// out on one kept-alive socket instead of a fresh TCP + TLS handshake each.
+// Connections open lazily on the next POST and close after
+// WEBHOOK_IDLE_CLOSE_MS, when the URL changes, or when the server drops them
+// (one immediate retry on a fresh connection).
+//
+// Events only go out as a JSON array once the endpoint has answered with
+// WEBHOOK_BATCH_HEADER, so plain automation URLs keep getting one object per
+// POST.
+//
+// The Arduino WiFiClientSecure does not expose mbedTLS session
+// save/restore, so a reconnect is always a full handshake; keeping the
+// connection open is what saves it.
+class WebhookConnection
+{
+public:
+  WebhookConnection();
+
+  // Returns the HTTP status, or a negative HTTPC_ERROR_*; fills response when given
+  int post(const String &url, const String &bearerToken, const char *body, size_t length, String *response = nullptr);
+
+  void close();
+  bool closeIfIdle();                  // True if it closed the connection
+  bool isOpen();
+  unsigned long idleCloseTime() const; // When closeIfIdle() will act (millis)
+
+  bool acceptsBatches() const { return batchesAccepted && !batchesRefused; }
+  void refuseBatches(); // The endpoint advertised batches but could not handle one; stop until the URL changes
+
+  const WebhookConnectionStats &getStats() const { return stats; }
+  const LatencyHistogram &getLatency() const { return latency; } // Per request, connect included
+  float getReuseRatio() const;
+
+private:
+  WiFiClient plainClient;
+  WiFiClientSecure secureClient;
+  WiFiClient *activeClient; // The one holding the open connection, if any
+  HTTPClient http;
+  String connectedUrl;
+  unsigned long lastUsed;
+  String batchUrl;      // The endpoint the two flags below describe (survives idle closes)
+  bool batchesAccepted; // From the last response's WEBHOOK_BATCH_HEADER
+  bool batchesRefused;
+
+  WebhookConnectionStats stats;
+  LatencyHistogram latency;
+
+  int send(WiFiClient &client, const String &url, const String &bearerToken, const char *body, size_t length);
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define WEBHOOK_PROJECT_ID_SIZE 24    // "<ChipID>-<counter>" plus terminator
+#define WEBHOOK_PROJECT_NAME_SIZE 48  // Longer names are cut on a UTF-8 boundary
+#define WEBHOOK_PROJECT_COLOR_SIZE 8  // "#RRGGBB"
+#define WEBHOOK_EVENT_JSON_MAX 784    // Worst case of one serialized event (every string byte escaped)
+
+enum class WebhookAction : uint8_t
+{
+  Start = 1, // "start_timer"
+  Stop = 2   // "stop_timer"
+};
+
+// One start/stop event, captured by value on the loop task and stored as is in
+// the outbox. The project is copied in rather than referenced, so an event
+// still describes its project after it is renamed or deleted. An empty
+// projectId means the timer ran without a project.
+struct WebhookEvent
+{
+  WebhookAction action;
+  uint8_t reserved;
+  uint16_t durationSetMinutes;
+  uint32_t durationActualSeconds; // Stop only
+  uint32_t timestamp;             // time() when it happened; counts from boot until SNTP has synced
+  uint32_t uptimeSeconds;         // millis() / 1000 when it happened, for its age later in the same boot
+  char projectId[WEBHOOK_PROJECT_ID_SIZE];
+  char projectName[WEBHOOK_PROJECT_NAME_SIZE];
+  char projectColor[WEBHOOK_PROJECT_COLOR_SIZE];
+};
+
+void setWebhookEventProject(WebhookEvent &event, const char *id, const char *name, const char *color);
+
+const char *webhookActionName(WebhookAction action);
+
+// Writes the JSON object the webhook endpoint expects. Returns its length, or 0
+// if it does not fit in size bytes. seq is the event's outbox seq; with the
+// chip id it makes "event_id", which the server remembers so a delivery
+// repeated after a lost response is applied once. ageSeconds, how long ago the
+// event happened, goes out as "age_seconds" unless negative (unknown); the
+// server dates the event by it when the timestamp isn't Unix time.
+size_t serializeWebhookEvent(const WebhookEvent &event, uint32_t seq, int32_t ageSeconds, char *out, size_t size);
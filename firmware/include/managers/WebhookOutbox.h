@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Arduino.h>
+#include "DataFS.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "managers/WebhookEvent.h"
+
+#define WEBHOOK_OUTBOX_PATH "/outbox.log"
+#define WEBHOOK_OUTBOX_TMP_PATH "/outbox.tmp"
+#define WEBHOOK_OUTBOX_MAX_PENDING 32       // Oldest event is dropped beyond this (a long time offline)
+#define WEBHOOK_OUTBOX_MAX_PAYLOAD 384      // Largest record payload the scan accepts
+#define WEBHOOK_OUTBOX_COMPACT_BYTES 8192   // Rewrite the log once it grows past this
+// Most of DataFS the outbox takes at once: a log just past the compaction
+// threshold and the compacted copy beside it, rounded up to blocks
+#define WEBHOOK_OUTBOX_MAX_FLASH (2 * (WEBHOOK_OUTBOX_COMPACT_BYTES + WEBHOOK_OUTBOX_MAX_PAYLOAD + DATA_FS_BLOCK_SIZE))
+#define WEBHOOK_RETRY_BASE_MS 2000          // First retry after 1-2 s
+#define WEBHOOK_RETRY_MAX_MS 300000         // Backoff stops doubling at 5 minutes
+
+struct WebhookOutboxStats
+{
+  uint32_t appended;  // Events written to the log
+  uint32_t delivered; // Acknowledged with a 2xx
+  uint32_t rejected;  // Dropped after a non-retryable 4xx
+  uint32_t retries;   // Failed attempts that were backed off
+  uint32_t dropped;   // Oldest events discarded because the outbox was full
+  uint32_t replayed;  // Pending events found in the log at boot
+};
+
+// Append-only webhook log on the data partition (DataFS). Each event is
+// written as its WebhookEvent bytes (and the file closed, so it is on flash)
+// before append() returns; delivery appends a small ack record instead of
+// rewriting the file. At boot the log is scanned in order, so events pending
+// from before a reboot or a WiFi outage go out first and in the order they
+// happened. A record torn by a power cut fails its checksum and ends the scan.
+// An event keeps its seq through replays and no seq is handed out twice, so
+// the seq names the event to the server (see serializeWebhookEvent()).
+//
+// append() runs on the loop task and peek()/ack() on the webhook task; a
+// mutex guards the pending index and the file.
+class WebhookOutbox
+{
+public:
+  WebhookOutbox();
+
+  bool begin(); // Mounts DataFS and rebuilds the pending list from the log
+
+  bool append(const WebhookEvent &event);
+  bool peek(WebhookEvent &event, uint32_t &seq);                          // Oldest pending event
+  uint8_t peekBatch(WebhookEvent events[], uint32_t seqs[], uint8_t max); // Oldest events, in order; returns how many
+  bool ack(uint32_t seq, bool delivered); // Remove one; delivered=false means the server rejected it
+
+  void recordRetry() { stats.retries++; }
+  uint16_t pendingCount() const { return count; }
+  bool isFromThisBoot(uint32_t seq) const { return seq >= bootSeq; } // Appended since begin(), not replayed
+  const WebhookOutboxStats &getStats() const { return stats; }
+
+  // Exponential backoff with jitter: a random delay in [d/2, d) where d doubles
+  // per failed attempt from WEBHOOK_RETRY_BASE_MS up to WEBHOOK_RETRY_MAX_MS, so
+  // devices knocked offline together do not retry in lockstep
+  static uint32_t retryDelay(uint8_t attempt);
+
+private:
+  struct Entry
+  {
+    uint32_t seq;
+    uint32_t offset; // Of the record header in the log
+    uint16_t length; // Payload bytes
+  };
+
+  SemaphoreHandle_t lock;
+  Entry pending[WEBHOOK_OUTBOX_MAX_PENDING]; // Ring, oldest at head
+  uint16_t head;
+  uint16_t count;
+  uint32_t nextSeq; // Never reused, see resetLog()
+  uint32_t bootSeq; // nextSeq when begin() had scanned the log
+  uint32_t logSize; // Bytes in the log file
+  bool ready;
+  WebhookOutboxStats stats;
+  uint8_t payloadBuffer[WEBHOOK_OUTBOX_MAX_PAYLOAD];
+
+  bool scanLog();
+  bool writeRecord(File &file, uint8_t type, uint32_t seq, const uint8_t *payload, uint16_t length);
+  bool appendRecord(uint8_t type, uint32_t seq, const uint8_t *payload, uint16_t length, uint32_t *offset);
+  bool compact();
+  bool resetLog();
+  static uint32_t firstSeq();
+  void popHead();
+  void pushEntry(uint32_t seq, uint32_t offset, uint16_t length);
+  bool removeEntry(uint32_t seq); // Anywhere in the ring; later entries keep their order
+};
@@ -16,6 +16,5 @@ public:
   void restoreDefaultLEDPattern();
 
 private:
-  int defaultDuration;
   unsigned long lastActivity;
 };
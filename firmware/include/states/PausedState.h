@@ -11,6 +11,8 @@ public:
   void exit() override;
 
   void setPause(int duration, unsigned long elapsedTime);
+  int getDuration() const { return duration; }                // Minutes
+  unsigned long getElapsedTime() const { return elapsedTime; } // Seconds, frozen at the pause
 
 private:
   int duration;
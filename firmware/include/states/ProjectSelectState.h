@@ -9,6 +9,23 @@
 class StateMachine;
 class InputController;
 
+// The list the selection screen scrolls: "No Project" at index 0, then the
+// catalog. Entries are references into the cursor's page (or the one static
+// "No Project"), valid until the next at(); nothing is copied.
+class ProjectSelectView
+{
+public:
+  explicit ProjectSelectView(ProjectManager &manager) : cursor(manager) {}
+
+  int size() const { return cursor.count() + 1; }
+  // "No Project" for index 0, and for a project that can't be read
+  const Project &at(int index);
+
+private:
+  ProjectCursor cursor; // Keeps its page between visits to the screen
+  static const Project noProject;
+};
+
 class ProjectSelectState : public State
 {
 public:
@@ -26,14 +43,12 @@ private:
   InputController &inputController;
 
   ProjectManager &projectManager; // Reference to access projects
-  int selectedProjectIndex;       // Currently highlighted project index (0 for "No Project")
-  int numProjectsToShow;          // How many projects fit on the screen (now 1)
-  ProjectList projectsWithNone;   // Local copy including the "No Project" option
+  ProjectSelectView projects;     // "No Project" plus the catalog, streamed a page at a time
+  int selectedProjectIndex;       // Currently highlighted entry (0 for "No Project", else catalog index + 1)
   bool needsInitialRender;        // Flag for first update draw
   unsigned long lastActivityTime; // For timeout
 
   // Helper methods
-  void loadProjects();
   void renderDisplay();
   void updateLedColor();
   void handleInput();
@@ -12,6 +12,8 @@ public:
   void exit() override;
 
   void setTimer(int duration, unsigned long elapsedTime);
+  int getDuration() const { return duration; }                // Minutes; 0 counts up
+  unsigned long getElapsedTime() const { return elapsedTime; } // Seconds, as of the last update
 
 private:
   unsigned long startTime;
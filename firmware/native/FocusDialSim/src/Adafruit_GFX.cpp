@@ -0,0 +1,521 @@
+#include "Adafruit_GFX.h"
+
+#include <stdlib.h>
+
+#define _swap_int16_t(a, b) \
+  {                         \
+    int16_t t = a;          \
+    a = b;                  \
+    b = t;                  \
+  }
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+      textcolor(0xFFFF), textbgcolor(0xFFFF), textsize_x(1), textsize_y(1),
+      wrap(true), gfxFont(nullptr) {}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  for (int16_t i = 0; i < h; i++)
+  {
+    drawPixel(x, y + i, color);
+  }
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  for (int16_t i = 0; i < w; i++)
+  {
+    drawPixel(x + i, y, color);
+  }
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  for (int16_t i = x; i < x + w; i++)
+  {
+    drawFastVLine(i, y, h, color);
+  }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color)
+{
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  if (x0 == x1)
+  {
+    if (y0 > y1)
+      _swap_int16_t(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    return;
+  }
+  if (y0 == y1)
+  {
+    if (x0 > x1)
+      _swap_int16_t(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    return;
+  }
+
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep)
+  {
+    _swap_int16_t(x0, y0);
+    _swap_int16_t(x1, y1);
+  }
+  if (x0 > x1)
+  {
+    _swap_int16_t(x0, x1);
+    _swap_int16_t(y0, y1);
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+
+  for (; x0 <= x1; x0++)
+  {
+    if (steep)
+      drawPixel(y0, x0, color);
+    else
+      drawPixel(x0, y0, color);
+    err -= dy;
+    if (err < 0)
+    {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  drawPixel(x0, y0 + r, color);
+  drawPixel(x0, y0 - r, color);
+  drawPixel(x0 + r, y0, color);
+  drawPixel(x0 - r, y0, color);
+
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    drawPixel(x0 + x, y0 + y, color);
+    drawPixel(x0 - x, y0 + y, color);
+    drawPixel(x0 + x, y0 - y, color);
+    drawPixel(x0 - x, y0 - y, color);
+    drawPixel(x0 + y, y0 + x, color);
+    drawPixel(x0 - y, y0 + x, color);
+    drawPixel(x0 + y, y0 - x, color);
+    drawPixel(x0 - y, y0 - x, color);
+  }
+}
+
+void Adafruit_GFX::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color)
+{
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (cornername & 0x4)
+    {
+      drawPixel(x0 + x, y0 + y, color);
+      drawPixel(x0 + y, y0 + x, color);
+    }
+    if (cornername & 0x2)
+    {
+      drawPixel(x0 + x, y0 - y, color);
+      drawPixel(x0 + y, y0 - x, color);
+    }
+    if (cornername & 0x8)
+    {
+      drawPixel(x0 - y, y0 + x, color);
+      drawPixel(x0 - x, y0 + y, color);
+    }
+    if (cornername & 0x1)
+    {
+      drawPixel(x0 - y, y0 - x, color);
+      drawPixel(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+void Adafruit_GFX::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+  drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+  fillCircleHelper(x0, y0, r, 3, 0, color);
+}
+
+void Adafruit_GFX::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color)
+{
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+
+  delta++;
+
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1))
+    {
+      if (corners & 1)
+        drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+      if (corners & 2)
+        drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+    }
+    if (y != py)
+    {
+      if (corners & 1)
+        drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+      if (corners & 2)
+        drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+  int16_t max_radius = ((w < h) ? w : h) / 2;
+  if (r > max_radius)
+    r = max_radius;
+  drawFastHLine(x + r, y, w - 2 * r, color);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+  drawFastVLine(x, y + r, h - 2 * r, color);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+  drawCircleHelper(x + r, y + r, r, 1, color);
+  drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+  drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+  drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+}
+
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+{
+  int16_t max_radius = ((w < h) ? w : h) / 2;
+  if (r > max_radius)
+    r = max_radius;
+  fillRect(x + r, y, w - 2 * r, h, color);
+  fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+  fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+{
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+
+  for (int16_t j = 0; j < h; j++, y++)
+  {
+    for (int16_t i = 0; i < w; i++)
+    {
+      if (i & 7)
+        b <<= 1;
+      else
+        b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      if (b & 0x80)
+        drawPixel(x + i, y, color);
+    }
+  }
+}
+
+void Adafruit_GFX::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
+{
+  int16_t byteWidth = (w + 7) / 8;
+  uint8_t b = 0;
+
+  for (int16_t j = 0; j < h; j++, y++)
+  {
+    for (int16_t i = 0; i < w; i++)
+    {
+      if (i & 7)
+        b <<= 1;
+      else
+        b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      drawPixel(x + i, y, (b & 0x80) ? color : bg);
+    }
+  }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y)
+{
+  if (!gfxFont)
+  {
+    // Classic font stand-in: a solid 5x7 cell per glyph
+    if (c == ' ')
+      return;
+    if (size_x == 1 && size_y == 1)
+      fillRect(x, y, 5, 7, color);
+    else
+      fillRect(x, y, 5 * size_x, 7 * size_y, color);
+    (void)bg;
+    return;
+  }
+
+  c -= (uint8_t)pgm_read_byte(&gfxFont->first);
+  GFXglyph *glyph = gfxFont->glyph + c;
+  uint8_t *bitmap = gfxFont->bitmap;
+
+  uint16_t bo = glyph->bitmapOffset;
+  uint8_t w = glyph->width;
+  uint8_t h = glyph->height;
+  int8_t xo = glyph->xOffset;
+  int8_t yo = glyph->yOffset;
+  uint8_t xx, yy, bits = 0, bit = 0;
+  int16_t xo16 = 0, yo16 = 0;
+
+  if (size_x > 1 || size_y > 1)
+  {
+    xo16 = xo;
+    yo16 = yo;
+  }
+
+  for (yy = 0; yy < h; yy++)
+  {
+    for (xx = 0; xx < w; xx++)
+    {
+      if (!(bit++ & 7))
+      {
+        bits = pgm_read_byte(&bitmap[bo++]);
+      }
+      if (bits & 0x80)
+      {
+        if (size_x == 1 && size_y == 1)
+        {
+          drawPixel(x + xo + xx, y + yo + yy, color);
+        }
+        else
+        {
+          fillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y, size_x, size_y, color);
+        }
+      }
+      bits <<= 1;
+    }
+  }
+}
+
+size_t Adafruit_GFX::write(uint8_t c)
+{
+  if (!gfxFont)
+  {
+    if (c == '\n')
+    {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    }
+    else if (c != '\r')
+    {
+      if (wrap && ((cursor_x + textsize_x * 6) > _width))
+      {
+        cursor_x = 0;
+        cursor_y += textsize_y * 8;
+      }
+      drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+      cursor_x += textsize_x * 6;
+    }
+    return 1;
+  }
+
+  if (c == '\n')
+  {
+    cursor_x = 0;
+    cursor_y += (int16_t)textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+  }
+  else if (c != '\r')
+  {
+    uint8_t first = pgm_read_byte(&gfxFont->first);
+    if ((c >= first) && (c <= (uint8_t)pgm_read_byte(&gfxFont->last)))
+    {
+      GFXglyph *glyph = gfxFont->glyph + (c - first);
+      uint8_t w = glyph->width;
+      uint8_t h = glyph->height;
+      if ((w > 0) && (h > 0))
+      {
+        int16_t xo = (int8_t)glyph->xOffset;
+        if (wrap && ((cursor_x + textsize_x * (xo + w)) > _width))
+        {
+          cursor_x = 0;
+          cursor_y += (int16_t)textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+      }
+      cursor_x += (uint8_t)glyph->xAdvance * (int16_t)textsize_x;
+    }
+  }
+  return 1;
+}
+
+void Adafruit_GFX::setFont(const GFXfont *f)
+{
+  if (f)
+  {
+    if (!gfxFont)
+    {
+      // Switching from classic to new font behavior: move cursor pos down 6 lines
+      cursor_y += 6;
+    }
+  }
+  else if (gfxFont)
+  {
+    cursor_y -= 6;
+  }
+  gfxFont = (GFXfont *)f;
+}
+
+void Adafruit_GFX::charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx, int16_t *miny, int16_t *maxx, int16_t *maxy)
+{
+  if (gfxFont)
+  {
+    if (c == '\n')
+    {
+      *x = 0;
+      *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+    }
+    else if (c != '\r')
+    {
+      uint8_t first = pgm_read_byte(&gfxFont->first);
+      uint8_t last = pgm_read_byte(&gfxFont->last);
+      if ((c >= first) && (c <= last))
+      {
+        GFXglyph *glyph = gfxFont->glyph + (c - first);
+        uint8_t gw = glyph->width;
+        uint8_t gh = glyph->height;
+        uint8_t xa = glyph->xAdvance;
+        int8_t xo = glyph->xOffset;
+        int8_t yo = glyph->yOffset;
+        if (wrap && ((*x + (((int16_t)xo + gw) * textsize_x)) > _width))
+        {
+          *x = 0;
+          *y += textsize_y * (uint8_t)pgm_read_byte(&gfxFont->yAdvance);
+        }
+        int16_t tsx = (int16_t)textsize_x;
+        int16_t tsy = (int16_t)textsize_y;
+        int16_t x1 = *x + xo * tsx;
+        int16_t y1 = *y + yo * tsy;
+        int16_t x2 = x1 + gw * tsx - 1;
+        int16_t y2 = y1 + gh * tsy - 1;
+        if (x1 < *minx)
+          *minx = x1;
+        if (y1 < *miny)
+          *miny = y1;
+        if (x2 > *maxx)
+          *maxx = x2;
+        if (y2 > *maxy)
+          *maxy = y2;
+        *x += xa * tsx;
+      }
+    }
+  }
+  else
+  {
+    if (c == '\n')
+    {
+      *x = 0;
+      *y += textsize_y * 8;
+    }
+    else if (c != '\r')
+    {
+      if (wrap && ((*x + textsize_x * 6) > _width))
+      {
+        *x = 0;
+        *y += textsize_y * 8;
+      }
+      int x2 = *x + textsize_x * 6 - 1;
+      int y2 = *y + textsize_y * 8 - 1;
+      if (x2 > *maxx)
+        *maxx = x2;
+      if (y2 > *maxy)
+        *maxy = y2;
+      if (*x < *minx)
+        *minx = *x;
+      if (*y < *miny)
+        *miny = *y;
+      *x += textsize_x * 6;
+    }
+  }
+}
+
+void Adafruit_GFX::getTextBounds(const char *str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+  uint8_t c;
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+
+  *x1 = x;
+  *y1 = y;
+  *w = *h = 0;
+
+  while ((c = *str++))
+  {
+    charBounds(c, &x, &y, &minx, &miny, &maxx, &maxy);
+  }
+
+  if (maxx >= minx)
+  {
+    *x1 = minx;
+    *w = maxx - minx + 1;
+  }
+  if (maxy >= miny)
+  {
+    *y1 = miny;
+    *h = maxy - miny + 1;
+  }
+}
+
+void Adafruit_GFX::getTextBounds(const String &str, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+{
+  if (str.length() != 0)
+  {
+    getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+  }
+}
@@ -0,0 +1,254 @@
+#include "Adafruit_SSD1306.h"
+
+Adafruit_SSD1306::Stats Adafruit_SSD1306::stats;
+Adafruit_SSD1306 *Adafruit_SSD1306::attached = nullptr;
+
+TwoWire Wire;
+
+// Upstream splits the framebuffer into I2C transactions of this many data bytes
+#define WIRE_MAX_DATA 31
+
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi, int8_t rst_pin, uint32_t clkDuring, uint32_t clkAfter)
+    : Adafruit_GFX(w, h), buffer(nullptr), panelBuffer(nullptr), wire(twi), wireClk(clkDuring), restoreClk(clkAfter),
+      columnStart(0), columnEnd(w - 1), pageStart(0), pageEnd((h + 7) / 8 - 1), column(0), page(0), command(0),
+      argumentsWanted(0), argumentsHeld(0)
+{
+  (void)rst_pin;
+}
+
+Adafruit_SSD1306::~Adafruit_SSD1306()
+{
+  if (wire)
+    wire->detach(this);
+  if (attached == this)
+    attached = nullptr;
+  free(buffer);
+  free(panelBuffer);
+}
+
+bool Adafruit_SSD1306::begin(uint8_t switchvcc, uint8_t i2caddr, bool reset, bool periphBegin)
+{
+  (void)switchvcc;
+  (void)reset;
+  (void)periphBegin;
+  size_t bytes = WIDTH * ((HEIGHT + 7) / 8);
+  if ((!buffer) && !(buffer = (uint8_t *)malloc(bytes)))
+    return false;
+  if ((!panelBuffer) && !(panelBuffer = (uint8_t *)malloc(bytes)))
+    return false;
+  memset(panelBuffer, 0, bytes);
+  clearDisplay();
+  if (wire)
+    wire->attach(i2caddr ? i2caddr : (HEIGHT == 32 ? 0x3C : 0x3D), this);
+  attached = this;
+  // Init sequence: ~25 single-byte commands
+  for (int i = 0; i < 25; i++)
+  {
+    chargeBus(3);
+  }
+  if (wire)
+    wire->setClock(restoreClk);
+  return true;
+}
+
+// Each I2C byte costs 9 bit-times (8 data + ACK); every transaction adds a
+// start, address byte and stop.
+void Adafruit_SSD1306::chargeBus(uint32_t bytes)
+{
+  uint32_t clk = wire ? wire->getClock() : wireClk;
+  uint64_t us = ((uint64_t)bytes * 9ULL * 1000000ULL + clk - 1) / clk;
+  stats.bytesOnBus += bytes;
+  stats.busMicros += us;
+  sim::advanceMicros(us);
+}
+
+void Adafruit_SSD1306::display()
+{
+  uint32_t count = WIDTH * ((HEIGHT + 7) / 8);
+  stats.flushes++;
+  if (wire)
+    wire->setClock(wireClk);
+
+  // Column/page address window: two 3-byte command transactions
+  chargeBus(2 * (1 + 1 + 3));
+
+  // Framebuffer: address + 0x40 control byte per chunk of WIRE_MAX_DATA
+  uint32_t chunks = (count + WIRE_MAX_DATA - 1) / WIRE_MAX_DATA;
+  chargeBus(count + chunks * 2);
+
+  memcpy(panelBuffer, buffer, count);
+  columnStart = column = 0;
+  columnEnd = WIDTH - 1;
+  pageStart = page = 0;
+  pageEnd = (HEIGHT + 7) / 8 - 1;
+  if (wire)
+    wire->setClock(restoreClk);
+}
+
+// A transmission from Wire: a control byte, then commands or GDDRAM data
+void Adafruit_SSD1306::receive(const uint8_t *data, size_t length)
+{
+  chargeBus(length + 1); // And the address byte
+  if (length == 0 || panelBuffer == nullptr)
+    return;
+  for (size_t i = 1; i < length; i++)
+  {
+    if (data[0] == 0x40)
+      controllerData(data[i]);
+    else
+      controllerCommand(data[i]);
+  }
+}
+
+void Adafruit_SSD1306::controllerCommand(uint8_t c)
+{
+  if (argumentsWanted > 0)
+  {
+    arguments[argumentsHeld++] = c;
+    if (argumentsHeld < argumentsWanted)
+      return;
+    argumentsWanted = 0;
+    if (command == SSD1306_COLUMNADDR)
+    {
+      columnStart = column = arguments[0] % WIDTH;
+      columnEnd = arguments[1] % WIDTH;
+      stats.windows++;
+    }
+    else if (command == SSD1306_PAGEADDR)
+    {
+      pageStart = page = arguments[0] % ((HEIGHT + 7) / 8);
+      pageEnd = arguments[1] % ((HEIGHT + 7) / 8);
+    }
+    return;
+  }
+  // Only the argument counts matter for the commands the firmware sends
+  command = c;
+  argumentsHeld = 0;
+  if (c == SSD1306_COLUMNADDR || c == SSD1306_PAGEADDR)
+    argumentsWanted = 2;
+  else if (c == SSD1306_MEMORYMODE || c == SSD1306_SETCONTRAST)
+    argumentsWanted = 1;
+}
+
+void Adafruit_SSD1306::controllerData(uint8_t data)
+{
+  panelBuffer[page * WIDTH + column] = data;
+  if (column == columnEnd)
+  {
+    column = columnStart;
+    page = page == pageEnd ? pageStart : page + 1;
+  }
+  else
+  {
+    column = (column + 1) % WIDTH;
+  }
+}
+
+void Adafruit_SSD1306::clearDisplay()
+{
+  memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+  stats.clears++;
+}
+
+void Adafruit_SSD1306::invertDisplay(bool i)
+{
+  (void)i;
+  ssd1306_command(0xA6);
+}
+
+void Adafruit_SSD1306::dim(bool dim)
+{
+  (void)dim;
+  ssd1306_command(SSD1306_SETCONTRAST);
+  ssd1306_command(0);
+}
+
+void Adafruit_SSD1306::ssd1306_command(uint8_t c)
+{
+  stats.commands++;
+  if (wire)
+    wire->setClock(wireClk);
+  chargeBus(3); // Address, 0x00 control byte, command
+  controllerCommand(c);
+  if (wire)
+    wire->setClock(restoreClk);
+}
+
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+  if ((x >= 0) && (x < width()) && (y >= 0) && (y < height()))
+  {
+    switch (color)
+    {
+    case SSD1306_WHITE:
+      buffer[x + (y / 8) * WIDTH] |= (1 << (y & 7));
+      break;
+    case SSD1306_BLACK:
+      buffer[x + (y / 8) * WIDTH] &= ~(1 << (y & 7));
+      break;
+    case SSD1306_INVERSE:
+      buffer[x + (y / 8) * WIDTH] ^= (1 << (y & 7));
+      break;
+    }
+  }
+}
+
+void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+  if ((y < 0) || (y >= HEIGHT))
+    return;
+  if (x < 0)
+  {
+    w += x;
+    x = 0;
+  }
+  if ((x + w) > WIDTH)
+    w = WIDTH - x;
+  if (w <= 0)
+    return;
+
+  uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x];
+  uint8_t mask = 1 << (y & 7);
+  switch (color)
+  {
+  case SSD1306_WHITE:
+    while (w--)
+      *pBuf++ |= mask;
+    break;
+  case SSD1306_BLACK:
+    mask = ~mask;
+    while (w--)
+      *pBuf++ &= mask;
+    break;
+  case SSD1306_INVERSE:
+    while (w--)
+      *pBuf++ ^= mask;
+    break;
+  }
+}
+
+void Adafruit_SSD1306::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+  if ((x < 0) || (x >= WIDTH))
+    return;
+  if (y < 0)
+  {
+    h += y;
+    y = 0;
+  }
+  if ((y + h) > HEIGHT)
+    h = HEIGHT - y;
+  for (int16_t i = 0; i < h; i++)
+  {
+    drawPixel(x, y + i, color);
+  }
+}
+
+bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y)
+{
+  if ((x >= 0) && (x < width()) && (y >= 0) && (y < height()))
+  {
+    return (buffer[x + (y / 8) * WIDTH] & (1 << (y & 7)));
+  }
+  return false;
+}
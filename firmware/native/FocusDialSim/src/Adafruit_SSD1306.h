@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+#define BLACK 0
+#define WHITE 1
+#define INVERSE 2
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+#define SSD1306_EXTERNALVCC 0x01
+#define SSD1306_SWITCHCAPVCC 0x02
+
+// Host replacement for Adafruit_SSD1306 backed by an in-memory framebuffer.
+//
+// display() copies the framebuffer to a "panel" buffer (what the glass would
+// show) and advances the virtual clock by the time the transfer would hold the
+// I2C bus, so blocking flushes cost the same virtual time as on the device.
+//
+// begin() also attaches the instance to its Wire at its address, so bytes
+// written there directly land the way the controller would take them:
+// commands (control byte 0x00) set the COLUMNADDR/PAGEADDR window, and data
+// (0x40) fills it column by column, page by page, in horizontal addressing
+// mode. The last instance begun gets the traffic until it is destroyed.
+class Adafruit_SSD1306 : public Adafruit_GFX, public TwoWireDevice
+{
+public:
+  Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi = &Wire, int8_t rst_pin = -1,
+                   uint32_t clkDuring = 400000UL, uint32_t clkAfter = 100000UL);
+  ~Adafruit_SSD1306();
+
+  bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0, bool reset = true, bool periphBegin = true);
+  void display();
+  void clearDisplay();
+  void invertDisplay(bool i);
+  void dim(bool dim);
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void ssd1306_command(uint8_t c);
+  bool getPixel(int16_t x, int16_t y);
+  uint8_t *getBuffer() { return buffer; }
+
+  // --- Simulator instrumentation (process-wide totals; the firmware owns one instance) ---
+  struct Stats
+  {
+    uint32_t flushes;       // display() calls
+    uint32_t commands;      // ssd1306_command() calls
+    uint64_t bytesOnBus;    // I2C bytes including address/control overhead
+    uint64_t busMicros;     // Virtual time spent holding the bus
+    uint32_t clears;        // clearDisplay() calls
+    uint32_t windows;       // COLUMNADDR/PAGEADDR windows set outside display()
+  };
+  static const Stats &simStats() { return stats; }
+  static void resetSimStats() { stats = Stats(); }
+  const uint8_t *panel() const { return panelBuffer; } // Last frame pushed to the glass
+  static Adafruit_SSD1306 *simAttached() { return attached; } // Last begun, if still alive
+
+  void receive(const uint8_t *data, size_t length) override;
+
+protected:
+  uint8_t *buffer;
+  uint8_t *panelBuffer;
+  TwoWire *wire;
+  uint32_t wireClk;
+  uint32_t restoreClk;
+  static Stats stats;
+  static Adafruit_SSD1306 *attached;
+
+  // Controller state: addressing window, write position and a command
+  // still waiting for its arguments
+  uint8_t columnStart, columnEnd, pageStart, pageEnd;
+  uint8_t column, page;
+  uint8_t command, arguments[2], argumentsWanted, argumentsHeld;
+
+  void chargeBus(uint32_t bytes);
+  void controllerCommand(uint8_t c);
+  void controllerData(uint8_t data);
+};
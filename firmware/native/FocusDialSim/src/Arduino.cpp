@@ -0,0 +1,417 @@
+#include "Arduino.h"
+#include "Sim.h"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <new>
+
+// --- Virtual clock ---
+
+static uint64_t virtualMicros = 0;
+
+struct PinEvent
+{
+  uint8_t pin;
+  int level;
+};
+
+static std::multimap<uint64_t, PinEvent> &pinEvents()
+{
+  static std::multimap<uint64_t, PinEvent> queue;
+  return queue;
+}
+
+uint64_t sim::nowMicros()
+{
+  return virtualMicros;
+}
+
+void sim::advanceMicros(uint64_t us)
+{
+  uint64_t target = virtualMicros + us;
+
+  // A scheduled task waits for the loop to move the clock
+  if (sim::inTask())
+  {
+    sim::blockTaskUntil(target);
+    return;
+  }
+
+  // Fire queued edges and run due tasks at their own timestamps on the way
+  while (true)
+  {
+    uint64_t pin = pinEvents().empty() ? UINT64_MAX : pinEvents().begin()->first;
+    uint64_t task = sim::nextTaskEventMicros();
+    uint64_t next = std::min(pin, task);
+    if (next > target)
+    {
+      break;
+    }
+    if (next > virtualMicros)
+    {
+      virtualMicros = next;
+    }
+    if (task < pin)
+    {
+      sim::runDueTasks();
+      continue;
+    }
+    auto first = pinEvents().begin();
+    PinEvent event = first->second;
+    {
+      HeapAccountingPause pause;
+      pinEvents().erase(first);
+    }
+    sim::setPin(event.pin, event.level);
+  }
+  virtualMicros = target;
+}
+
+unsigned long millis()
+{
+  return (unsigned long)(virtualMicros / 1000ULL);
+}
+
+unsigned long micros()
+{
+  return (unsigned long)virtualMicros;
+}
+
+static const char *sntpServerName = nullptr;
+
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char *server1, const char *server2, const char *server3)
+{
+  (void)gmtOffsetSec;
+  (void)daylightOffsetSec;
+  (void)server2;
+  (void)server3;
+  sntpServerName = server1;
+}
+
+const char *sim::sntpServer()
+{
+  return sntpServerName;
+}
+
+// Blocking waits simply move the virtual clock forward
+void delay(uint32_t ms)
+{
+  sim::advanceMillis(ms);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  sim::advanceMicros(us);
+}
+
+void yield() {}
+
+// --- Virtual GPIO ---
+
+struct PinState
+{
+  int level = HIGH; // Inputs idle high (all firmware inputs use pull-ups)
+  void (*isr)(void) = nullptr;
+  int mode = CHANGE;
+};
+
+static std::map<uint8_t, PinState> &pins()
+{
+  static std::map<uint8_t, PinState> table;
+  return table;
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  (void)mode;
+  pins()[pin];
+}
+
+int digitalRead(uint8_t pin)
+{
+  return pins()[pin].level;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  pins()[pin].level = val ? HIGH : LOW;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode)
+{
+  PinState &state = pins()[pin];
+  state.isr = isr;
+  state.mode = mode;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+  pins()[pin].isr = nullptr;
+}
+
+void sim::setPin(uint8_t pin, int level)
+{
+  PinState &state = pins()[pin];
+  int previous = state.level;
+  state.level = level ? HIGH : LOW;
+  if (state.isr == nullptr || previous == state.level)
+  {
+    return;
+  }
+  bool rising = state.level == HIGH;
+  if (state.mode == CHANGE || (state.mode == RISING && rising) || (state.mode == FALLING && !rising))
+  {
+    state.isr();
+  }
+}
+
+int sim::getPin(uint8_t pin)
+{
+  return pins()[pin].level;
+}
+
+void sim::schedulePin(uint64_t atMicros, uint8_t pin, int level)
+{
+  HeapAccountingPause pause;
+  pinEvents().insert({atMicros, PinEvent{pin, level}});
+}
+
+uint64_t sim::nextPinEventMicros()
+{
+  return pinEvents().empty() ? UINT64_MAX : pinEvents().begin()->first;
+}
+
+// --- Random ---
+
+long random(long howbig)
+{
+  if (howbig <= 0)
+  {
+    return 0;
+  }
+  return rand() % howbig;
+}
+
+long random(long howsmall, long howbig)
+{
+  if (howsmall >= howbig)
+  {
+    return howsmall;
+  }
+  return howsmall + random(howbig - howsmall);
+}
+
+// --- Serial ---
+
+HardwareSerial Serial;
+static bool serialEcho = true;
+static std::string serialRx;
+
+void sim::setSerialEcho(bool enabled)
+{
+  serialEcho = enabled;
+}
+
+void sim::serialInput(const char *text)
+{
+  HeapAccountingPause pause;
+  serialRx += text;
+}
+
+int HardwareSerial::available()
+{
+  return (int)serialRx.size();
+}
+
+int HardwareSerial::read()
+{
+  if (serialRx.empty())
+  {
+    return -1;
+  }
+  sim::HeapAccountingPause pause;
+  int c = (uint8_t)serialRx[0];
+  serialRx.erase(0, 1);
+  return c;
+}
+
+int HardwareSerial::peek()
+{
+  return serialRx.empty() ? -1 : (uint8_t)serialRx[0];
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  if (serialEcho)
+  {
+    fputc(c, stdout);
+  }
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  if (serialEcho)
+  {
+    fwrite(buffer, 1, size, stdout);
+  }
+  return size;
+}
+
+// --- ESP system ---
+
+EspClass ESP;
+
+uint32_t esp_random()
+{
+  return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+esp_err_t esp_efuse_mac_get_default(uint8_t *mac)
+{
+  static const uint8_t simMac[6] = {0x5E, 0xED, 0xF0, 0xC5, 0xD1, 0xA1};
+  memcpy(mac, simMac, sizeof(simMac));
+  return ESP_OK;
+}
+
+void EspClass::restart()
+{
+  printf("[sim] ESP.restart() requested, exiting simulator\n");
+  fflush(stdout);
+  exit(0);
+}
+
+// The cycle counter ticks at a nominal 240 MHz of virtual time plus host
+// time. The virtual clock only moves inside a loop pass for modelled bus
+// time, so on its own every latency histogram would read 0; the host part
+// adds what the pass actually cost to run.
+uint32_t EspClass::getCycleCount()
+{
+  static const auto hostStart = std::chrono::steady_clock::now();
+  uint64_t hostNanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - hostStart).count();
+  return (uint32_t)(virtualMicros * 240ULL + hostNanos * 240ULL / 1000ULL);
+}
+
+// --- Heap accounting ---
+//
+// Every allocation is prefixed with its size so frees can be attributed.
+// Blocks allocated while accounting is paused are tagged and ignored on free.
+
+static sim::HeapStats heap = {};
+static int heapPauseDepth = 0;
+static uint32_t heapAllocationsSinceStart = 0; // Not cleared by resetHeapStats()
+
+static constexpr size_t HEAP_HEADER = alignof(std::max_align_t);
+static constexpr size_t HEAP_UNCOUNTED = (size_t)1 << (sizeof(size_t) * 8 - 1);
+
+sim::HeapAccountingPause::HeapAccountingPause()
+{
+  heapPauseDepth++;
+}
+
+sim::HeapAccountingPause::~HeapAccountingPause()
+{
+  heapPauseDepth--;
+}
+
+sim::HeapStats sim::heapStats()
+{
+  return heap;
+}
+
+void sim::resetHeapStats()
+{
+  heap.allocations = 0;
+  heap.frees = 0;
+  heap.bytesAllocated = 0;
+  heap.peakLiveBytes = heap.liveBytes;
+}
+
+// Stands in for firmware/src/HeapCounter.cpp (linker wraps on the device);
+// shim bookkeeping under HeapAccountingPause is not counted
+uint32_t heapAllocationCount()
+{
+  return heapAllocationsSinceStart;
+}
+
+uint32_t esp_get_free_heap_size()
+{
+  // Nominal ESP32 internal heap minus what the simulated firmware holds
+  const size_t nominalHeap = 320 * 1024;
+  return heap.liveBytes < nominalHeap ? (uint32_t)(nominalHeap - heap.liveBytes) : 0;
+}
+
+// Every new/new[] gets its block from heapAllocate() and every delete/delete[]
+// returns it through heapRelease(), so the malloc() and free() pair up there
+// and nowhere else
+static void *heapAllocate(size_t size)
+{
+  unsigned char *block = (unsigned char *)malloc(size + HEAP_HEADER);
+  if (block == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  if (heapPauseDepth > 0)
+  {
+    *(size_t *)block = size | HEAP_UNCOUNTED;
+    return block + HEAP_HEADER;
+  }
+  *(size_t *)block = size;
+  heap.allocations++;
+  heapAllocationsSinceStart++;
+  heap.bytesAllocated += size;
+  heap.liveBytes += size;
+  if (heap.liveBytes > heap.peakLiveBytes)
+  {
+    heap.peakLiveBytes = heap.liveBytes;
+  }
+  return block + HEAP_HEADER;
+}
+
+static void heapRelease(void *ptr)
+{
+  if (ptr == nullptr)
+  {
+    return;
+  }
+  unsigned char *block = (unsigned char *)ptr - HEAP_HEADER;
+  size_t size = *(size_t *)block;
+  if ((size & HEAP_UNCOUNTED) == 0)
+  {
+    heap.frees++;
+    heap.liveBytes -= size;
+  }
+  free(block);
+}
+
+void *operator new(size_t size)
+{
+  return heapAllocate(size);
+}
+
+void *operator new[](size_t size)
+{
+  return heapAllocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+  heapRelease(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+  heapRelease(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  heapRelease(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept
+{
+  heapRelease(ptr);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+typedef enum
+{
+  ESP_A2D_CONNECTION_STATE_DISCONNECTED = 0,
+  ESP_A2D_CONNECTION_STATE_CONNECTING,
+  ESP_A2D_CONNECTION_STATE_CONNECTED,
+  ESP_A2D_CONNECTION_STATE_DISCONNECTING
+} esp_a2d_connection_state_t;
+
+// Host stand-in for the A2DP sink, which the firmware only uses as a
+// proximity trigger. It never connects.
+class BluetoothA2DPSink
+{
+public:
+  void start(const char *name, bool autoReconnect = true)
+  {
+    (void)name;
+    (void)autoReconnect;
+  }
+  void disconnect() {}
+  void end(bool releaseMemory = false) { (void)releaseMemory; }
+  bool is_connected() { return false; }
+  void clean_last_connection() {}
+
+  void set_stream_reader(void (*callback)(const uint8_t *, uint32_t), bool isI2S = true)
+  {
+    (void)callback;
+    (void)isI2S;
+  }
+  void set_raw_stream_reader(void (*callback)(const uint8_t *, uint32_t)) { (void)callback; }
+  void set_on_volumechange(void (*callback)(int)) { (void)callback; }
+  void set_avrc_connection_state_callback(void (*callback)(bool)) { (void)callback; }
+  void set_avrc_metadata_callback(void (*callback)(uint8_t, const uint8_t *)) { (void)callback; }
+  void set_avrc_rn_playstatus_callback(void (*callback)(int)) { (void)callback; }
+  void set_avrc_rn_track_change_callback(void (*callback)(uint8_t *)) { (void)callback; }
+  void set_avrc_rn_play_pos_callback(void (*callback)(uint32_t)) { (void)callback; }
+  void set_spp_active(bool active) { (void)active; }
+  void set_output_active(bool active) { (void)active; }
+  void set_rssi_active(bool active) { (void)active; }
+  void set_on_connection_state_changed(void (*callback)(esp_a2d_connection_state_t, void *), void *obj = nullptr)
+  {
+    (void)callback;
+    (void)obj;
+  }
+};
@@ -0,0 +1,658 @@
+#include "ESPAsyncWebServer.h"
+
+#include <algorithm>
+
+namespace
+{
+  std::vector<AsyncWebServer *> &runningServers()
+  {
+    static std::vector<AsyncWebServer *> servers;
+    return servers;
+  }
+
+  std::function<void()> &chunkHook()
+  {
+    static std::function<void()> hook;
+    return hook;
+  }
+
+  String urlDecode(const String &text)
+  {
+    String decoded;
+    const char *s = text.c_str();
+    for (size_t i = 0; s[i]; i++)
+    {
+      if (s[i] == '+')
+      {
+        decoded += ' ';
+      }
+      else if (s[i] == '%' && isxdigit((unsigned char)s[i + 1]) && isxdigit((unsigned char)s[i + 2]))
+      {
+        char hex[3] = {s[i + 1], s[i + 2], 0};
+        decoded += (char)strtol(hex, nullptr, 16);
+        i += 2;
+      }
+      else
+      {
+        decoded += s[i];
+      }
+    }
+    return decoded;
+  }
+
+  void parseParams(AsyncWebServerRequest *request, const String &query, bool form)
+  {
+    int start = 0;
+    while (start < (int)query.length())
+    {
+      int end = query.indexOf('&', start);
+      if (end < 0)
+        end = query.length();
+      String pair = query.substring(start, end);
+      int eq = pair.indexOf('=');
+      if (eq < 0)
+        request->simAddParam(urlDecode(pair), String(), form);
+      else
+        request->simAddParam(urlDecode(pair.substring(0, eq)), urlDecode(pair.substring(eq + 1)), form);
+      start = end + 1;
+    }
+  }
+
+  String contentTypeFor(const String &path)
+  {
+    if (path.endsWith(".html") || path.endsWith(".htm"))
+      return "text/html";
+    if (path.endsWith(".css"))
+      return "text/css";
+    if (path.endsWith(".js"))
+      return "application/javascript";
+    if (path.endsWith(".json"))
+      return "application/json";
+    if (path.endsWith(".png"))
+      return "image/png";
+    if (path.endsWith(".svg"))
+      return "image/svg+xml";
+    if (path.endsWith(".ico"))
+      return "image/x-icon";
+    return "text/plain";
+  }
+
+  // Like AsyncFileResponse, falls back to path + ".gz" when path is missing
+  AsyncWebServerResponse *fileResponse(FS &fs, const String &path, const String &contentType)
+  {
+    bool gzipped = !fs.exists(path) && fs.exists(path + ".gz");
+    File file = fs.open(gzipped ? path + ".gz" : path, "r");
+    if (!file)
+      return new AsyncWebServerResponse(404, "text/plain");
+
+    AsyncWebServerResponse *response = new AsyncWebServerResponse(200, contentType.length() ? contentType : contentTypeFor(path));
+    if (gzipped)
+      response->addHeader("Content-Encoding", "gzip");
+    uint8_t buf[256];
+    size_t n;
+    while ((n = file.read(buf, sizeof(buf))) > 0)
+      response->appendContent(buf, n);
+    file.close();
+    return response;
+  }
+}
+
+// --- AsyncWebServerRequest ---
+
+AsyncWebServerRequest::AsyncWebServerRequest(WebRequestMethod method, const String &url)
+    : _method(method), _url(url), _contentLength(0), _response(nullptr) {}
+
+AsyncWebServerRequest::~AsyncWebServerRequest()
+{
+  delete _response;
+}
+
+const char *AsyncWebServerRequest::methodToString() const
+{
+  switch (_method)
+  {
+  case HTTP_GET:
+    return "GET";
+  case HTTP_POST:
+    return "POST";
+  case HTTP_DELETE:
+    return "DELETE";
+  case HTTP_PUT:
+    return "PUT";
+  case HTTP_PATCH:
+    return "PATCH";
+  case HTTP_HEAD:
+    return "HEAD";
+  case HTTP_OPTIONS:
+    return "OPTIONS";
+  default:
+    return "UNKNOWN";
+  }
+}
+
+bool AsyncWebServerRequest::hasParam(const String &name, bool post, bool file) const
+{
+  return getParam(name, post, file) != nullptr;
+}
+
+const AsyncWebParameter *AsyncWebServerRequest::getParam(const String &name, bool post, bool file) const
+{
+  (void)file;
+  for (size_t i = 0; i < _params.size(); i++)
+  {
+    if (_params[i].name() == name && _params[i].isPost() == post)
+      return &_params[i];
+  }
+  return nullptr;
+}
+
+bool AsyncWebServerRequest::hasHeader(const String &name) const
+{
+  return getHeader(name) != nullptr;
+}
+
+const AsyncWebHeader *AsyncWebServerRequest::getHeader(const String &name) const
+{
+  for (size_t i = 0; i < _headers.size(); i++)
+  {
+    if (strcasecmp(_headers[i].name().c_str(), name.c_str()) == 0)
+      return &_headers[i];
+  }
+  return nullptr;
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse *response)
+{
+  if (_response)
+  {
+    // Like the real server, only the first response is sent
+    delete response;
+    return;
+  }
+  _response = response;
+  response->simSend(&_client);
+}
+
+void AsyncWebServerRequest::send(int code, const String &contentType, const String &content)
+{
+  send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::send(FS &fs, const String &path, const String &contentType, bool download)
+{
+  send(beginResponse(fs, path, contentType, download));
+}
+
+void AsyncWebServerRequest::redirect(const String &url)
+{
+  AsyncWebServerResponse *response = beginResponse(302);
+  response->addHeader("Location", url);
+  send(response);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse(int code, const String &contentType, const String &content)
+{
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(code, contentType);
+  response->appendContent((const uint8_t *)content.c_str(), content.length());
+  return response;
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse(int code, const String &contentType, const uint8_t *content, size_t len)
+{
+  AsyncWebServerResponse *response = new AsyncWebServerResponse(code, contentType);
+  response->appendContent(content, len);
+  return response;
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginResponse(FS &fs, const String &path, const String &contentType, bool download)
+{
+  (void)download;
+  return fileResponse(fs, path, contentType);
+}
+
+AsyncResponseStream *AsyncWebServerRequest::beginResponseStream(const String &contentType, size_t bufferSize)
+{
+  return new AsyncResponseStream(contentType, bufferSize);
+}
+
+AsyncWebServerResponse *AsyncWebServerRequest::beginChunkedResponse(const String &contentType, AwsResponseFiller callback)
+{
+  return new AsyncChunkedResponse(contentType, callback);
+}
+
+void AsyncChunkedResponse::simSend(AsyncClient *client)
+{
+  uint8_t buffer[SIM_CHUNK_BYTES];
+  for (;;)
+  {
+    size_t length = _filler(buffer, sizeof(buffer), _content.size());
+    if (length == RESPONSE_TRY_AGAIN && client->connected())
+      continue;
+    if (length == 0 || length == RESPONSE_TRY_AGAIN)
+      break;
+    {
+      sim::HeapAccountingPause pause;
+      appendContent(buffer, length);
+    }
+    _chunks++;
+    if (chunkHook())
+      chunkHook()();
+  }
+}
+
+// --- Handlers ---
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest *request)
+{
+  if (!(_method & request->method()))
+    return false;
+  return request->url() == _uri;
+}
+
+void AsyncCallbackWebHandler::handleRequest(AsyncWebServerRequest *request)
+{
+  if (_onRequest)
+    _onRequest(request);
+  else
+    request->send(500);
+}
+
+void AsyncCallbackWebHandler::handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
+{
+  if (_onBody)
+    _onBody(request, data, len, index, total);
+}
+
+String AsyncStaticWebHandler::_resolve(const String &url) const
+{
+  String path = _path + url.substring(_uri.length());
+  path.replace("//", "/");
+  if (path.endsWith("/"))
+    path += _defaultFile;
+  return path;
+}
+
+bool AsyncStaticWebHandler::canHandle(AsyncWebServerRequest *request)
+{
+  if (request->method() != HTTP_GET && request->method() != HTTP_HEAD)
+    return false;
+  if (!request->url().startsWith(_uri))
+    return false;
+
+  String path = _resolve(request->url());
+  return _fs.exists(path) || _fs.exists(path + ".gz");
+}
+
+void AsyncStaticWebHandler::handleRequest(AsyncWebServerRequest *request)
+{
+  String path = _resolve(request->url());
+  AsyncWebServerResponse *response = fileResponse(_fs, path, contentTypeFor(path));
+  if (_cacheControl.length())
+    response->addHeader("Cache-Control", _cacheControl);
+  request->send(response);
+}
+
+// --- WebSocket ---
+
+bool AsyncWebSocketClient::text(const char *message, size_t len)
+{
+  if (queueIsFull())
+  {
+    if (_closeWhenFull && _status == WS_CONNECTED)
+      close();
+    return false;
+  }
+  _queue.push_back(String(message, len));
+  return true;
+}
+
+std::vector<String> AsyncWebSocketClient::simDrain()
+{
+  std::vector<String> drained;
+  drained.swap(_queue);
+  return drained;
+}
+
+AsyncWebSocket::~AsyncWebSocket()
+{
+  for (size_t i = 0; i < _clients.size(); i++)
+    delete _clients[i];
+}
+
+size_t AsyncWebSocket::count() const
+{
+  size_t connected = 0;
+  for (size_t i = 0; i < _clients.size(); i++)
+  {
+    if (_clients[i]->status() == WS_CONNECTED)
+      connected++;
+  }
+  return connected;
+}
+
+AsyncWebSocketClient *AsyncWebSocket::client(uint32_t id)
+{
+  for (size_t i = 0; i < _clients.size(); i++)
+  {
+    if (_clients[i]->id() == id && _clients[i]->status() == WS_CONNECTED)
+      return _clients[i];
+  }
+  return nullptr;
+}
+
+bool AsyncWebSocket::availableForWriteAll()
+{
+  for (size_t i = 0; i < _clients.size(); i++)
+  {
+    if (_clients[i]->queueIsFull())
+      return false;
+  }
+  return true;
+}
+
+void AsyncWebSocket::cleanupClients(uint16_t maxClients)
+{
+  for (size_t i = 0; i < _clients.size();)
+  {
+    if (_clients[i]->status() == WS_DISCONNECTED)
+    {
+      delete _clients[i];
+      _clients.erase(_clients.begin() + i);
+    }
+    else
+    {
+      i++;
+    }
+  }
+  while (count() > maxClients)
+    _clients.front()->close();
+}
+
+void AsyncWebSocket::text(uint32_t id, const char *message, size_t len)
+{
+  AsyncWebSocketClient *c = client(id);
+  if (c)
+    c->text(message, len);
+}
+
+AsyncWebSocket::SendStatus AsyncWebSocket::textAll(const char *message, size_t len)
+{
+  size_t hit = 0;
+  size_t miss = 0;
+  for (size_t i = 0; i < _clients.size(); i++)
+  {
+    if (_clients[i]->status() != WS_CONNECTED)
+      continue;
+    if (_clients[i]->text(message, len))
+      hit++;
+    else
+      miss++;
+  }
+  return hit == 0 ? DISCARDED : (miss == 0 ? ENQUEUED : PARTIALLY_ENQUEUED);
+}
+
+uint32_t AsyncWebSocket::simConnect()
+{
+  AsyncWebSocketClient *c = new AsyncWebSocketClient(this, _nextId++);
+  _clients.push_back(c);
+  if (_eventHandler)
+    _eventHandler(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+  return c->id();
+}
+
+void AsyncWebSocket::simDisconnect(uint32_t id)
+{
+  AsyncWebSocketClient *c = client(id);
+  if (!c)
+    return;
+  c->simSetStatus(WS_DISCONNECTED);
+  if (_eventHandler)
+    _eventHandler(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+}
+
+void AsyncWebSocket::simReceive(uint32_t id, const char *message, size_t len)
+{
+  AsyncWebSocketClient *c = client(id);
+  if (!c || !_eventHandler)
+    return;
+
+  AwsFrameInfo info = {};
+  info.message_opcode = WS_TEXT;
+  info.opcode = WS_TEXT;
+  info.final = 1;
+  info.len = len;
+
+  // The real server hands over its receive buffer, which is writable and
+  // NUL-terminated one past the payload; mirror that
+  std::vector<uint8_t> frame;
+  {
+    sim::HeapAccountingPause pause; // The receive buffer isn't the handler's allocation
+    frame.reserve(len + 1);
+    frame.assign(message, message + len);
+    frame.push_back(0);
+  }
+  _eventHandler(this, c, WS_EVT_DATA, &info, frame.data(), len);
+}
+
+// --- AsyncWebServer ---
+
+AsyncWebServer::~AsyncWebServer()
+{
+  end();
+  reset();
+}
+
+void AsyncWebServer::begin()
+{
+  if (_running)
+    return;
+  _running = true;
+  runningServers().push_back(this);
+}
+
+void AsyncWebServer::end()
+{
+  if (!_running)
+    return;
+  _running = false;
+  std::vector<AsyncWebServer *> &servers = runningServers();
+  servers.erase(std::remove(servers.begin(), servers.end(), this), servers.end());
+}
+
+void AsyncWebServer::reset()
+{
+  for (size_t i = 0; i < _ownedHandlers.size(); i++)
+    delete _ownedHandlers[i];
+  _ownedHandlers.clear();
+  _handlers.clear();
+  _notFound = nullptr;
+}
+
+AsyncCallbackWebHandler &AsyncWebServer::on(const char *uri, ArRequestHandlerFunction onRequest)
+{
+  return on(uri, HTTP_ANY, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler &AsyncWebServer::on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest)
+{
+  return on(uri, method, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler &AsyncWebServer::on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload)
+{
+  return on(uri, method, onRequest, onUpload, nullptr);
+}
+
+AsyncCallbackWebHandler &AsyncWebServer::on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+{
+  AsyncCallbackWebHandler *handler = new AsyncCallbackWebHandler(uri, method, onRequest, onUpload, onBody);
+  _ownedHandlers.push_back(handler);
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+AsyncStaticWebHandler &AsyncWebServer::serveStatic(const char *uri, FS &fs, const char *path, const char *cacheControl)
+{
+  AsyncStaticWebHandler *handler = new AsyncStaticWebHandler(uri, fs, path, cacheControl);
+  _ownedHandlers.push_back(handler);
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+AsyncWebHandler &AsyncWebServer::addHandler(AsyncWebHandler *handler)
+{
+  _handlers.push_back(handler);
+  return *handler;
+}
+
+void AsyncWebServer::simDispatch(AsyncWebServerRequest *request, uint8_t *body, size_t bodyLen)
+{
+  for (size_t i = 0; i < _handlers.size(); i++)
+  {
+    if (!_handlers[i]->canHandle(request))
+      continue;
+
+    if (bodyLen)
+      _handlers[i]->handleBody(request, body, bodyLen, 0, bodyLen);
+    _handlers[i]->handleRequest(request);
+    return;
+  }
+
+  if (_notFound)
+    _notFound(request);
+  else
+    request->send(404);
+}
+
+AsyncWebSocket *AsyncWebServer::simFindWebSocket(const char *url)
+{
+  for (size_t i = 0; i < _handlers.size(); i++)
+  {
+    AsyncWebSocket *ws = dynamic_cast<AsyncWebSocket *>(_handlers[i]);
+    if (ws && strcmp(ws->url(), url) == 0)
+      return ws;
+  }
+  return nullptr;
+}
+
+// --- Harness API ---
+
+namespace sim
+{
+  static AsyncWebSocket *findWebSocket(const char *path)
+  {
+    std::vector<AsyncWebServer *> &servers = runningServers();
+    for (size_t i = 0; i < servers.size(); i++)
+    {
+      AsyncWebSocket *ws = servers[i]->simFindWebSocket(path);
+      if (ws)
+        return ws;
+    }
+    return nullptr;
+  }
+
+  String HttpResponse::header(const char *name) const
+  {
+    for (size_t i = 0; i < headers.size(); i++)
+    {
+      if (strcasecmp(headers[i].name().c_str(), name) == 0)
+        return headers[i].value();
+    }
+    return String();
+  }
+
+  HttpResponse httpRequest(WebRequestMethod method, const char *url, const String &body, const char *contentType, const char *headers)
+  {
+    HttpResponse result = {};
+    if (runningServers().empty())
+      return result;
+
+    String fullUrl(url);
+    int query = fullUrl.indexOf('?');
+    AsyncWebServerRequest request(method, query < 0 ? fullUrl : fullUrl.substring(0, query));
+    if (query >= 0)
+      parseParams(&request, fullUrl.substring(query + 1), false);
+
+    if (headers)
+    {
+      String lines(headers);
+      int start = 0;
+      while (start < (int)lines.length())
+      {
+        int end = lines.indexOf('\n', start);
+        if (end < 0)
+          end = lines.length();
+        String line = lines.substring(start, end);
+        int colon = line.indexOf(':');
+        if (colon > 0)
+        {
+          String value = line.substring(colon + 1);
+          value.trim();
+          request.simAddHeader(line.substring(0, colon), value);
+        }
+        start = end + 1;
+      }
+    }
+
+    std::vector<uint8_t> bodyBytes(body.c_str(), body.c_str() + body.length());
+    request.simSetBody(contentType ? contentType : "", bodyBytes.size());
+    bool form = contentType && strncmp(contentType, "application/x-www-form-urlencoded", 33) == 0;
+    if (form)
+    {
+      parseParams(&request, body, true);
+      bodyBytes.clear();
+    }
+
+    runningServers().front()->simDispatch(&request, bodyBytes.data(), bodyBytes.size());
+
+    AsyncWebServerResponse *response = request.simResponse();
+    if (response)
+    {
+      sim::HeapAccountingPause pause; // The harness's copy of what went out
+      result.code = response->code();
+      result.contentType = response->contentType();
+      result.body = String((const char *)response->content().data(), response->content().size());
+      result.headers = response->headers();
+      result.closed = !request.client()->connected();
+    }
+    return result;
+  }
+
+  void setChunkHook(std::function<void()> hook)
+  {
+    chunkHook() = hook;
+  }
+
+  uint32_t wsConnect(const char *path)
+  {
+    AsyncWebSocket *ws = findWebSocket(path);
+    return ws ? ws->simConnect() : 0;
+  }
+
+  void wsDisconnect(const char *path, uint32_t clientId)
+  {
+    AsyncWebSocket *ws = findWebSocket(path);
+    if (ws)
+      ws->simDisconnect(clientId);
+  }
+
+  void wsSend(const char *path, uint32_t clientId, const String &message)
+  {
+    AsyncWebSocket *ws = findWebSocket(path);
+    if (ws)
+      ws->simReceive(clientId, message.c_str(), message.length());
+  }
+
+  std::vector<String> wsReceive(const char *path, uint32_t clientId)
+  {
+    AsyncWebSocket *ws = findWebSocket(path);
+    AsyncWebSocketClient *c = ws ? ws->client(clientId) : nullptr;
+    return c ? c->simDrain() : std::vector<String>();
+  }
+
+  bool wsIsConnected(const char *path, uint32_t clientId)
+  {
+    AsyncWebSocket *ws = findWebSocket(path);
+    return ws && ws->client(clientId) != nullptr;
+  }
+}
@@ -0,0 +1,445 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Host stand-in for ESPAsyncWebServer, as maintained by ESP32Async.
+//
+// Routes, static files and WebSocket handlers are registered exactly as on
+// the device. Nothing listens on a socket; the harness drives requests with
+// sim::httpRequest() and WebSocket traffic with sim::ws*(), and handlers run
+// synchronously on the caller's thread.
+
+typedef enum
+{
+  HTTP_GET = 0b00000001,
+  HTTP_POST = 0b00000010,
+  HTTP_DELETE = 0b00000100,
+  HTTP_PUT = 0b00001000,
+  HTTP_PATCH = 0b00010000,
+  HTTP_HEAD = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class AsyncWebSocket;
+class AsyncWebSocketClient;
+
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+typedef std::function<size_t(uint8_t *buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+// A filler's "nothing yet": the server calls it again on the connection's next poll
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+// The request's TCP connection
+class AsyncClient
+{
+public:
+  AsyncClient() : _connected(true) {}
+  bool connected() const { return _connected; }
+  void close(bool now = false)
+  {
+    (void)now;
+    _connected = false;
+  }
+
+private:
+  bool _connected;
+};
+
+class AsyncWebParameter
+{
+public:
+  AsyncWebParameter(const String &name, const String &value, bool form) : _name(name), _value(value), _isForm(form) {}
+  const String &name() const { return _name; }
+  const String &value() const { return _value; }
+  bool isPost() const { return _isForm; }
+  bool isFile() const { return false; }
+
+private:
+  String _name;
+  String _value;
+  bool _isForm;
+};
+
+class AsyncWebHeader
+{
+public:
+  AsyncWebHeader(const String &name, const String &value) : _name(name), _value(value) {}
+  const String &name() const { return _name; }
+  const String &value() const { return _value; }
+
+private:
+  String _name;
+  String _value;
+};
+
+class AsyncWebServerResponse
+{
+public:
+  AsyncWebServerResponse(int code, const String &contentType) : _code(code), _contentType(contentType) {}
+  virtual ~AsyncWebServerResponse() {}
+
+  void setCode(int code) { _code = code; }
+  void setContentType(const String &type) { _contentType = type; }
+  void addHeader(const String &name, const String &value) { _headers.push_back(AsyncWebHeader(name, value)); }
+
+  int code() const { return _code; }
+  const String &contentType() const { return _contentType; }
+  const std::vector<AsyncWebHeader> &headers() const { return _headers; }
+  const std::vector<uint8_t> &content() const { return _content; }
+  void appendContent(const uint8_t *data, size_t len) { _content.insert(_content.end(), data, data + len); }
+
+  // Called once the response is handed to send()
+  virtual void simSend(AsyncClient *client) {}
+
+protected:
+  int _code;
+  String _contentType;
+  std::vector<AsyncWebHeader> _headers;
+  std::vector<uint8_t> _content;
+};
+
+class AsyncResponseStream : public AsyncWebServerResponse, public Print
+{
+public:
+  AsyncResponseStream(const String &contentType, size_t bufferSize) : AsyncWebServerResponse(200, contentType) { _content.reserve(bufferSize); }
+  size_t write(uint8_t c) override
+  {
+    _content.push_back(c);
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t len) override
+  {
+    appendContent(data, len);
+    return len;
+  }
+  using Print::write;
+};
+
+// Chunked transfer: the filler is pulled a TCP segment at a time until it
+// returns 0, as the real server does while the client acks. What it hands
+// over counts as sent, not as firmware heap. RESPONSE_TRY_AGAIN pulls again
+// at once, standing in for the next poll, unless the filler closed the
+// connection: then the body ends there, without its last chunk.
+class AsyncChunkedResponse : public AsyncWebServerResponse
+{
+public:
+  static const size_t SIM_CHUNK_BYTES = 1428; // One 1436-byte segment less the chunk framing
+
+  AsyncChunkedResponse(const String &contentType, AwsResponseFiller filler)
+      : AsyncWebServerResponse(200, contentType), _filler(filler), _chunks(0) {}
+
+  void simSend(AsyncClient *client) override;
+  size_t simChunks() const { return _chunks; }
+
+private:
+  AwsResponseFiller _filler;
+  size_t _chunks;
+};
+
+class AsyncWebServerRequest
+{
+public:
+  AsyncWebServerRequest(WebRequestMethod method, const String &url);
+  ~AsyncWebServerRequest();
+
+  WebRequestMethod method() const { return _method; }
+  const char *methodToString() const;
+  const String &url() const { return _url; }
+  const String &contentType() const { return _contentType; }
+  size_t contentLength() const { return _contentLength; }
+
+  bool hasParam(const String &name, bool post = false, bool file = false) const;
+  const AsyncWebParameter *getParam(const String &name, bool post = false, bool file = false) const;
+  size_t params() const { return _params.size(); }
+  const AsyncWebParameter *getParam(size_t index) const { return index < _params.size() ? &_params[index] : nullptr; }
+
+  bool hasHeader(const String &name) const;
+  const AsyncWebHeader *getHeader(const String &name) const;
+
+  AsyncClient *client() { return &_client; }
+
+  void send(AsyncWebServerResponse *response);
+  void send(int code, const String &contentType = String(), const String &content = String());
+  void send(FS &fs, const String &path, const String &contentType = String(), bool download = false);
+  void redirect(const String &url);
+
+  AsyncWebServerResponse *beginResponse(int code, const String &contentType = String(), const String &content = String());
+  AsyncWebServerResponse *beginResponse(int code, const String &contentType, const uint8_t *content, size_t len);
+  AsyncWebServerResponse *beginResponse(FS &fs, const String &path, const String &contentType = String(), bool download = false);
+  AsyncResponseStream *beginResponseStream(const String &contentType, size_t bufferSize = 1460);
+  AsyncWebServerResponse *beginChunkedResponse(const String &contentType, AwsResponseFiller callback);
+
+  // Simulator plumbing
+  void simAddParam(const String &name, const String &value, bool form) { _params.push_back(AsyncWebParameter(name, value, form)); }
+  void simAddHeader(const String &name, const String &value) { _headers.push_back(AsyncWebHeader(name, value)); }
+  void simSetBody(const String &contentType, size_t length)
+  {
+    _contentType = contentType;
+    _contentLength = length;
+  }
+  AsyncWebServerResponse *simResponse() const { return _response; }
+
+private:
+  WebRequestMethod _method;
+  String _url;
+  String _contentType;
+  size_t _contentLength;
+  std::vector<AsyncWebParameter> _params;
+  std::vector<AsyncWebHeader> _headers;
+  AsyncClient _client;
+  AsyncWebServerResponse *_response;
+};
+
+class AsyncWebHandler
+{
+public:
+  virtual ~AsyncWebHandler() {}
+  virtual bool canHandle(AsyncWebServerRequest *request) = 0;
+  virtual void handleRequest(AsyncWebServerRequest *request) = 0;
+  virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
+};
+
+class AsyncCallbackWebHandler : public AsyncWebHandler
+{
+public:
+  AsyncCallbackWebHandler(const String &uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody)
+      : _uri(uri), _method(method), _onRequest(onRequest), _onUpload(onUpload), _onBody(onBody) {}
+
+  bool canHandle(AsyncWebServerRequest *request) override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+  void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) override;
+
+private:
+  String _uri;
+  WebRequestMethodComposite _method;
+  ArRequestHandlerFunction _onRequest;
+  ArUploadHandlerFunction _onUpload;
+  ArBodyHandlerFunction _onBody;
+};
+
+class AsyncStaticWebHandler : public AsyncWebHandler
+{
+public:
+  AsyncStaticWebHandler(const String &uri, FS &fs, const String &path, const char *cacheControl)
+      : _uri(uri), _fs(fs), _path(path), _defaultFile("index.htm"), _cacheControl(cacheControl ? cacheControl : "") {}
+
+  AsyncStaticWebHandler &setDefaultFile(const char *filename)
+  {
+    _defaultFile = filename;
+    return *this;
+  }
+  AsyncStaticWebHandler &setCacheControl(const char *cacheControl)
+  {
+    _cacheControl = cacheControl;
+    return *this;
+  }
+
+  bool canHandle(AsyncWebServerRequest *request) override;
+  void handleRequest(AsyncWebServerRequest *request) override;
+
+private:
+  String _uri;
+  FS &_fs;
+  String _path;
+  String _defaultFile;
+  String _cacheControl;
+
+  String _resolve(const String &url) const;
+};
+
+// --- WebSocket ---
+
+typedef enum
+{
+  WS_EVT_CONNECT,
+  WS_EVT_DISCONNECT,
+  WS_EVT_PONG,
+  WS_EVT_ERROR,
+  WS_EVT_DATA
+} AwsEventType;
+
+typedef enum
+{
+  WS_CONTINUATION,
+  WS_TEXT,
+  WS_BINARY,
+  WS_DISCONNECT = 0x08,
+  WS_PING,
+  WS_PONG
+} AwsFrameType;
+
+typedef enum
+{
+  WS_DISCONNECTED,
+  WS_CONNECTED,
+  WS_DISCONNECTING
+} AwsClientStatus;
+
+typedef struct
+{
+  uint8_t message_opcode;
+  uint32_t num;
+  uint8_t final;
+  uint8_t masked;
+  uint8_t opcode;
+  uint64_t len;
+  uint8_t mask[4];
+  uint64_t index;
+} AwsFrameInfo;
+
+#ifndef WS_MAX_QUEUED_MESSAGES
+#define WS_MAX_QUEUED_MESSAGES 32
+#endif
+
+typedef std::function<void(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)> AwsEventHandler;
+
+class AsyncWebSocketClient
+{
+public:
+  AsyncWebSocketClient(AsyncWebSocket *server, uint32_t id) : _server(server), _id(id), _status(WS_CONNECTED), _closeWhenFull(true) {}
+
+  uint32_t id() const { return _id; }
+  AwsClientStatus status() const { return _status; }
+  IPAddress remoteIP() const { return IPAddress(192, 168, 1, (uint8_t)(100 + _id)); }
+  AsyncWebSocket *server() { return _server; }
+
+  bool text(const char *message, size_t len);
+  bool text(const char *message) { return text(message, strlen(message)); }
+  bool text(const String &message) { return text(message.c_str(), message.length()); }
+  void close() { _status = WS_DISCONNECTING; }
+  void setCloseClientOnQueueFull(bool close) { _closeWhenFull = close; }
+
+  size_t queueLen() const { return _queue.size(); }
+  bool queueIsFull() const { return _queue.size() >= WS_MAX_QUEUED_MESSAGES || _status != WS_CONNECTED; }
+  bool canSend() const { return !queueIsFull(); }
+
+  // Simulator plumbing: messages queued to this client, oldest first
+  std::vector<String> simDrain();
+  void simSetStatus(AwsClientStatus status) { _status = status; }
+
+private:
+  AsyncWebSocket *_server;
+  uint32_t _id;
+  AwsClientStatus _status;
+  bool _closeWhenFull; // A message that finds the queue full closes the client, rather than being dropped
+  std::vector<String> _queue;
+};
+
+class AsyncWebSocket : public AsyncWebHandler
+{
+public:
+  // What textAll() did with a message
+  enum SendStatus
+  {
+    DISCARDED,         // No client took it
+    ENQUEUED,          // Every connected client
+    PARTIALLY_ENQUEUED // Some, not all
+  };
+
+  explicit AsyncWebSocket(const String &url) : _url(url), _nextId(1) {}
+  ~AsyncWebSocket();
+
+  const char *url() const { return _url.c_str(); }
+  void onEvent(AwsEventHandler handler) { _eventHandler = handler; }
+
+  size_t count() const;
+  AsyncWebSocketClient *client(uint32_t id);
+  bool hasClient(uint32_t id) { return client(id) != nullptr; }
+  std::vector<AsyncWebSocketClient *> &getClients() { return _clients; }
+  bool availableForWriteAll();
+  void cleanupClients(uint16_t maxClients = 8);
+
+  void text(uint32_t id, const char *message, size_t len);
+  void text(uint32_t id, const String &message) { text(id, message.c_str(), message.length()); }
+  SendStatus textAll(const char *message, size_t len);
+  SendStatus textAll(const char *message) { return textAll(message, strlen(message)); }
+  SendStatus textAll(const String &message) { return textAll(message.c_str(), message.length()); }
+
+  bool canHandle(AsyncWebServerRequest *request) override { return false; }
+  void handleRequest(AsyncWebServerRequest *request) override {}
+
+  // Simulator plumbing
+  uint32_t simConnect();
+  void simDisconnect(uint32_t id);
+  void simReceive(uint32_t id, const char *message, size_t len);
+
+private:
+  String _url;
+  uint32_t _nextId;
+  AwsEventHandler _eventHandler;
+  std::vector<AsyncWebSocketClient *> _clients;
+};
+
+class AsyncWebServer
+{
+public:
+  explicit AsyncWebServer(uint16_t port) : _port(port), _running(false) {}
+  ~AsyncWebServer();
+
+  void begin();
+  void end();
+
+  AsyncCallbackWebHandler &on(const char *uri, ArRequestHandlerFunction onRequest);
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload);
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody);
+  AsyncStaticWebHandler &serveStatic(const char *uri, FS &fs, const char *path, const char *cacheControl = NULL);
+  AsyncWebHandler &addHandler(AsyncWebHandler *handler);
+  void onNotFound(ArRequestHandlerFunction fn) { _notFound = fn; }
+  void reset();
+
+  // Simulator plumbing
+  bool simIsRunning() const { return _running; }
+  void simDispatch(AsyncWebServerRequest *request, uint8_t *body, size_t bodyLen);
+  AsyncWebSocket *simFindWebSocket(const char *url);
+
+private:
+  uint16_t _port;
+  bool _running;
+  std::vector<AsyncWebHandler *> _handlers;
+  std::vector<AsyncWebHandler *> _ownedHandlers;
+  ArRequestHandlerFunction _notFound;
+};
+
+namespace sim
+{
+  struct HttpResponse
+  {
+    int code; // 0 when no server is running
+    String contentType;
+    String body;
+    std::vector<AsyncWebHeader> headers;
+    bool closed; // The server closed the connection before the body ended
+
+    String header(const char *name) const;
+  };
+
+  // Issues a request against the running AsyncWebServer. The query string of
+  // `url` becomes GET parameters; a form-encoded body becomes POST parameters,
+  // any other body is delivered to the route's body handler. `headers` holds
+  // "Name: value" lines separated by '\n'.
+  HttpResponse httpRequest(WebRequestMethod method, const char *url, const String &body = String(),
+                           const char *contentType = "application/json", const char *headers = nullptr);
+
+  // Runs after each chunk of a chunked response, where the device's other
+  // tasks could act between the client's acks; an empty one clears it
+  void setChunkHook(std::function<void()> hook);
+
+  // WebSocket clients connected to the running server's socket at `path`
+  uint32_t wsConnect(const char *path);
+  void wsDisconnect(const char *path, uint32_t clientId);
+  void wsSend(const char *path, uint32_t clientId, const String &message);
+  std::vector<String> wsReceive(const char *path, uint32_t clientId);
+  bool wsIsConnected(const char *path, uint32_t clientId); // false once either side closed it
+}
@@ -0,0 +1,348 @@
+#include "LittleFS.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <map>
+#include <set>
+#include <string>
+
+#define FS_BLOCK_SIZE 4096
+
+namespace fs
+{
+  typedef std::map<std::string, std::shared_ptr<FileData>> FileTable;
+
+  struct Volume
+  {
+    size_t blocks;  // 0 when the partition is not in the table
+    bool mounted;
+    bool corrupt;   // The next mount fails
+    FileTable files;
+  };
+
+  struct FileData
+  {
+    std::vector<uint8_t> bytes;
+    Volume *volume;
+  };
+}
+
+namespace
+{
+  using fs::FileTable;
+  using fs::Volume;
+
+  // Data partitions of firmware/partitions.csv, by label
+  std::map<std::string, Volume> &partitions()
+  {
+    static std::map<std::string, Volume> table = {
+        {"spiffs", {0x30000 / FS_BLOCK_SIZE, false, false, {}}},
+        {"data", {0x2D0000 / FS_BLOCK_SIZE, false, false, {}}},
+    };
+    return table;
+  }
+
+  size_t blocksFor(size_t bytes)
+  {
+    return bytes == 0 ? 1 : (bytes + FS_BLOCK_SIZE - 1) / FS_BLOCK_SIZE;
+  }
+
+  // A metadata pair for the root and for each directory, plus file blocks
+  size_t usedBlocks(const Volume &volume)
+  {
+    std::set<std::string> directories;
+    size_t used = 2;
+    for (FileTable::const_iterator it = volume.files.begin(); it != volume.files.end(); ++it)
+    {
+      size_t slash = it->first.rfind('/');
+      if (slash != std::string::npos && slash > 0)
+        directories.insert(it->first.substr(0, slash));
+      used += blocksFor(it->second->bytes.size());
+    }
+    return used + 2 * directories.size();
+  }
+
+  bool isMounted(const Volume *volume)
+  {
+    return volume && volume->mounted;
+  }
+
+  sim::FsStats stats;
+}
+
+fs::LittleFSFS LittleFS;
+
+namespace fs
+{
+  File::File(std::shared_ptr<FileData> data, const String &path, bool writable, bool append)
+      : _data(data), _path(path), _pos(append ? data->bytes.size() : 0), _writable(writable) {}
+
+  size_t File::write(uint8_t c)
+  {
+    return write(&c, 1);
+  }
+
+  size_t File::write(const uint8_t *buf, size_t size)
+  {
+    if (!_data || !_writable)
+      return 0;
+
+    sim::HeapAccountingPause pause;
+    std::vector<uint8_t> &bytes = _data->bytes;
+    if (_pos + size > bytes.size())
+    {
+      // No space: LittleFS fails the write (LFS_ERR_NOSPC) and the file keeps
+      // its old size
+      Volume *volume = _data->volume;
+      size_t grow = blocksFor(_pos + size) - blocksFor(bytes.size());
+      if (!isMounted(volume) || (grow > 0 && usedBlocks(*volume) + grow > volume->blocks))
+        return 0;
+      bytes.resize(_pos + size);
+    }
+    memcpy(bytes.data() + _pos, buf, size);
+    _pos += size;
+    stats.bytesWritten += size;
+    return size;
+  }
+
+  int File::available()
+  {
+    return _data ? (int)(_data->bytes.size() - _pos) : 0;
+  }
+
+  int File::read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+
+  int File::peek()
+  {
+    if (!_data || _pos >= _data->bytes.size())
+      return -1;
+    return _data->bytes[_pos];
+  }
+
+  size_t File::read(uint8_t *buf, size_t size)
+  {
+    if (!_data || _pos >= _data->bytes.size())
+      return 0;
+
+    size_t n = std::min(size, _data->bytes.size() - _pos);
+    memcpy(buf, _data->bytes.data() + _pos, n);
+    _pos += n;
+    stats.bytesRead += n;
+    return n;
+  }
+
+  bool File::seek(uint32_t pos, SeekMode mode)
+  {
+    if (!_data)
+      return false;
+
+    size_t base = mode == SeekSet ? 0 : (mode == SeekCur ? _pos : _data->bytes.size());
+    size_t target = base + pos;
+    if (target > _data->bytes.size())
+      return false;
+    _pos = target;
+    return true;
+  }
+
+  size_t File::size() const
+  {
+    return _data ? _data->bytes.size() : 0;
+  }
+
+  void File::close()
+  {
+    sim::HeapAccountingPause pause;
+    _data.reset();
+  }
+
+  const char *File::name() const
+  {
+    const char *slash = strrchr(_path.c_str(), '/');
+    return slash ? slash + 1 : _path.c_str();
+  }
+
+  File FS::open(const char *path, const char *mode, bool create)
+  {
+    sim::HeapAccountingPause pause;
+    if (!isMounted(_volume))
+      return File();
+    stats.opens++;
+
+    FileTable &files = _volume->files;
+    FileTable::iterator it = files.find(path);
+    bool write = mode[0] == 'w' || mode[0] == 'a' || strchr(mode, '+') != nullptr;
+
+    if (it == files.end())
+    {
+      if (mode[0] == 'r' && !create)
+        return File();
+      if (usedBlocks(*_volume) + 1 > _volume->blocks)
+        return File();
+      std::shared_ptr<FileData> data = std::make_shared<FileData>();
+      data->volume = _volume;
+      it = files.insert(std::make_pair(std::string(path), data)).first;
+    }
+    else if (mode[0] == 'w')
+    {
+      it->second->bytes.clear();
+    }
+
+    return File(it->second, path, write, mode[0] == 'a');
+  }
+
+  bool FS::exists(const char *path)
+  {
+    return isMounted(_volume) && _volume->files.count(path) > 0;
+  }
+
+  bool FS::remove(const char *path)
+  {
+    sim::HeapAccountingPause pause;
+    return isMounted(_volume) && _volume->files.erase(path) > 0;
+  }
+
+  bool FS::rename(const char *from, const char *to)
+  {
+    sim::HeapAccountingPause pause;
+    if (!isMounted(_volume))
+      return false;
+    FileTable &files = _volume->files;
+    FileTable::iterator it = files.find(from);
+    if (it == files.end())
+      return false;
+    std::shared_ptr<FileData> data = it->second;
+    files.erase(it);
+    files[to] = data;
+    return true;
+  }
+}
+
+bool fs::LittleFSFS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles, const char *partitionLabel)
+{
+  (void)basePath;
+  (void)maxOpenFiles;
+  sim::HeapAccountingPause pause;
+  std::map<std::string, Volume>::iterator it = partitions().find(partitionLabel);
+  if (it == partitions().end() || it->second.blocks == 0)
+    return false;
+
+  Volume &volume = it->second;
+  if (volume.corrupt)
+  {
+    if (!formatOnFail)
+      return false;
+    volume.files.clear();
+    volume.corrupt = false;
+  }
+  volume.mounted = true;
+  _volume = &volume;
+  return true;
+}
+
+void fs::LittleFSFS::end()
+{
+  if (_volume)
+    _volume->mounted = false;
+  _volume = nullptr;
+}
+
+bool fs::LittleFSFS::format()
+{
+  sim::HeapAccountingPause pause;
+  if (!_volume)
+    return false;
+  _volume->files.clear();
+  return true;
+}
+
+size_t fs::LittleFSFS::totalBytes() const
+{
+  return isMounted(_volume) ? _volume->blocks * FS_BLOCK_SIZE : 0;
+}
+
+size_t fs::LittleFSFS::usedBytes() const
+{
+  return isMounted(_volume) ? usedBlocks(*_volume) * FS_BLOCK_SIZE : 0;
+}
+
+namespace sim
+{
+  static size_t loadDirectory(const std::string &hostDir, const std::string &fsDir)
+  {
+    DIR *dir = opendir(hostDir.c_str());
+    if (!dir)
+      return 0;
+
+    size_t loaded = 0;
+    while (struct dirent *entry = readdir(dir))
+    {
+      if (entry->d_name[0] == '.')
+        continue;
+
+      std::string hostPath = hostDir + "/" + entry->d_name;
+      std::string fsPath = fsDir + "/" + entry->d_name;
+      struct stat st;
+      if (stat(hostPath.c_str(), &st) != 0)
+        continue;
+
+      if (S_ISDIR(st.st_mode))
+      {
+        loaded += loadDirectory(hostPath, fsPath);
+        continue;
+      }
+
+      FILE *f = fopen(hostPath.c_str(), "rb");
+      if (!f)
+        continue;
+      std::shared_ptr<fs::FileData> data = std::make_shared<fs::FileData>();
+      data->volume = &partitions()["spiffs"];
+      data->bytes.resize(st.st_size);
+      size_t n = fread(data->bytes.data(), 1, data->bytes.size(), f);
+      fclose(f);
+      data->bytes.resize(n);
+      data->volume->files[fsPath] = data;
+      loaded++;
+    }
+    closedir(dir);
+    return loaded;
+  }
+
+  size_t loadFilesystemImage(const char *hostDir)
+  {
+    HeapAccountingPause pause;
+    return loadDirectory(hostDir, "");
+  }
+
+  size_t setPartitionSize(const char *label, size_t bytes)
+  {
+    HeapAccountingPause pause;
+    Volume &volume = partitions()[label];
+    size_t old = volume.blocks * FS_BLOCK_SIZE;
+    volume.blocks = bytes / FS_BLOCK_SIZE;
+    volume.mounted = false;
+    volume.files.clear();
+    return old;
+  }
+
+  void corruptPartition(const char *label)
+  {
+    Volume &volume = partitions()[label];
+    volume.corrupt = true;
+    volume.mounted = false;
+  }
+
+  FsStats fsStats()
+  {
+    return stats;
+  }
+
+  void resetFsStats()
+  {
+    stats = FsStats();
+  }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+namespace fs
+{
+  enum SeekMode
+  {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+  };
+
+  struct FileData; // In-memory file contents shared between handles
+  struct Volume;   // One partition's files and block count
+
+  // Handle to a file in the in-memory filesystem. Like the Arduino File it is
+  // cheap to copy and evaluates to false when the open failed.
+  class File : public Stream
+  {
+  public:
+    File() {}
+    File(std::shared_ptr<FileData> data, const String &path, bool writable, bool append);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t read(uint8_t *buf, size_t size);
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const { return _pos; }
+    size_t size() const;
+    void flush() {}
+    void close();
+    const char *path() const { return _path.c_str(); }
+    const char *name() const;
+    explicit operator bool() const { return (bool)_data; }
+
+  private:
+    std::shared_ptr<FileData> _data;
+    String _path;
+    size_t _pos = 0;
+    bool _writable = false;
+  };
+
+  // A mounted partition, like the Arduino FS; every call fails until a
+  // begin() has mounted it
+  class FS
+  {
+  public:
+    File open(const char *path, const char *mode = "r", bool create = false);
+    File open(const String &path, const char *mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char *path);
+    bool exists(const String &path) { return exists(path.c_str()); }
+    bool remove(const char *path);
+    bool remove(const String &path) { return remove(path.c_str()); }
+    bool rename(const char *from, const char *to);
+    bool mkdir(const char *path) { (void)path; return _volume != nullptr; }
+
+  protected:
+    Volume *_volume = nullptr;
+  };
+}
+
+using fs::File;
+using fs::FS;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekSet;
+
+namespace sim
+{
+  // Loads every regular file under hostDir into the "spiffs" partition,
+  // e.g. firmware/data so the web UI can be served from the simulator
+  size_t loadFilesystemImage(const char *hostDir);
+
+  // Resizes a partition of the table (a copy of firmware/partitions.csv),
+  // dropping its files; 0 bytes removes it, so begin() can't find it.
+  // Returns the old size.
+  size_t setPartitionSize(const char *label, size_t bytes);
+  // Makes the next mount of a partition fail as if its flash were corrupt
+  void corruptPartition(const char *label);
+
+  struct FsStats
+  {
+    uint32_t opens;
+    uint32_t bytesRead;
+    uint32_t bytesWritten;
+  };
+  FsStats fsStats();
+  void resetFsStats();
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include "fonts/Org_01.h"
+
+// The FreeSans glyph tables ship with the real Adafruit GFX library and are
+// not vendored here. The simulator borrows Org_01's glyphs with FreeSansBold
+// 9pt line spacing; text width and pixel counts are therefore approximate.
+const GFXfont FreeSansBold9pt7b PROGMEM = {(uint8_t *)Org_01Bitmaps,
+                                           (GFXglyph *)Org_01Glyphs, 0x20, 0x7E, 22};
@@ -0,0 +1,458 @@
+#include "freertos/FreeRTOS.h"
+
+#include <Arduino.h>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Fixed-capacity ring of fixed-size items, allocated once at creation
+struct QueueDefinition
+{
+  uint8_t *storage;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t head;
+  UBaseType_t count;
+  bool isMutex;
+};
+
+struct tskTaskControlBlock
+{
+  const char *name;
+  // Scheduled tasks only (sim::runTask())
+  bool scheduled;
+  TaskFunction_t fn;
+  void *param;
+  uint32_t notifications;
+  bool waitingForNotify;
+  uint64_t wakeAt; // Virtual time the task runs again on its own; UINT64_MAX for never
+};
+
+static QueueDefinition *createQueue(UBaseType_t length, UBaseType_t itemSize)
+{
+  QueueDefinition *queue = new QueueDefinition();
+  queue->storage = itemSize > 0 ? new uint8_t[length * itemSize] : nullptr;
+  queue->length = length;
+  queue->itemSize = itemSize;
+  queue->head = 0;
+  queue->count = 0;
+  queue->isMutex = false;
+  return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+  return createQueue(length, itemSize);
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+  if (queue == nullptr)
+  {
+    return;
+  }
+  delete[] queue->storage;
+  delete queue;
+}
+
+// Nothing else can run while the caller "waits", so a full queue stays full:
+// burn the requested timeout on the virtual clock and report failure.
+static void waitTicks(TickType_t ticksToWait)
+{
+  if (ticksToWait != portMAX_DELAY)
+  {
+    vTaskDelay(ticksToWait);
+  }
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+  if (queue == nullptr)
+  {
+    return pdFAIL;
+  }
+  if (queue->count >= queue->length)
+  {
+    waitTicks(ticksToWait);
+    return errQUEUE_FULL;
+  }
+  UBaseType_t tail = (queue->head + queue->count) % queue->length;
+  memcpy(queue->storage + tail * queue->itemSize, item, queue->itemSize);
+  queue->count++;
+  return pdPASS;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+  return xQueueSend(queue, item, ticksToWait);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item)
+{
+  if (queue == nullptr)
+  {
+    return pdFAIL;
+  }
+  queue->head = 0;
+  queue->count = 0;
+  return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticksToWait)
+{
+  if (queue == nullptr)
+  {
+    return pdFAIL;
+  }
+  if (queue->count == 0)
+  {
+    waitTicks(ticksToWait);
+    return pdFAIL;
+  }
+  memcpy(buffer, queue->storage + queue->head * queue->itemSize, queue->itemSize);
+  queue->head = (queue->head + 1) % queue->length;
+  queue->count--;
+  return pdPASS;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *buffer, TickType_t ticksToWait)
+{
+  if (queue == nullptr || queue->count == 0)
+  {
+    waitTicks(ticksToWait);
+    return pdFAIL;
+  }
+  memcpy(buffer, queue->storage + queue->head * queue->itemSize, queue->itemSize);
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+  return queue ? queue->count : 0;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue)
+{
+  return queue ? queue->length - queue->count : 0;
+}
+
+// --- Semaphores (counting on a one-slot queue) ---
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+  QueueDefinition *mutex = createQueue(1, 0);
+  mutex->isMutex = true;
+  mutex->count = 1; // Mutexes start available
+  return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+  return createQueue(1, 0); // Binary semaphores start empty
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+  vQueueDelete(semaphore);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait)
+{
+  if (semaphore == nullptr)
+  {
+    return pdFALSE;
+  }
+  if (semaphore->count == 0)
+  {
+    if (semaphore->isMutex && ticksToWait == portMAX_DELAY)
+    {
+      // On the device this would block the caller forever
+      printf("[sim] WARNING: recursive take of a held mutex would deadlock on target\n");
+    }
+    waitTicks(ticksToWait);
+    return pdFALSE;
+  }
+  semaphore->count = 0;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+  if (semaphore == nullptr || semaphore->count != 0)
+  {
+    return pdFALSE;
+  }
+  semaphore->count = 1;
+  return pdTRUE;
+}
+
+// --- Tasks ---
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stackDepth, void *param,
+                       UBaseType_t priority, TaskHandle_t *handle)
+{
+  return xTaskCreatePinnedToCore(fn, name, stackDepth, param, priority, handle, 0);
+}
+
+// Scheduled tasks run on their own threads, but only one thread, the loop's
+// or a task's, ever runs at a time: they hand a baton back and forth. A task
+// runs from when it is created or notified, or its wake time comes up on the
+// virtual clock, until it blocks again, so runs are deterministic and the
+// shims need no locking.
+namespace
+{
+  // Never destroyed: parked task threads still wait on them after main() returns
+  std::mutex &batonMutex = *new std::mutex;
+  std::condition_variable &batonPassed = *new std::condition_variable;
+  tskTaskControlBlock *runningTask = nullptr; // nullptr: the loop task
+  std::vector<std::string> &tasksToRun = *new std::vector<std::string>;
+  std::vector<tskTaskControlBlock *> &scheduledTasks = *new std::vector<tskTaskControlBlock *>;
+
+  // Loop side: let a task run until it blocks
+  void resume(tskTaskControlBlock *task)
+  {
+    std::unique_lock<std::mutex> lock(batonMutex);
+    runningTask = task;
+    batonPassed.notify_all();
+    batonPassed.wait(lock, []
+                     { return runningTask == nullptr; });
+  }
+
+  // Task side: hand the baton back and wait for the next resume()
+  void yieldToLoop(tskTaskControlBlock *task)
+  {
+    std::unique_lock<std::mutex> lock(batonMutex);
+    runningTask = nullptr;
+    batonPassed.notify_all();
+    batonPassed.wait(lock, [task]
+                     { return runningTask == task; });
+  }
+
+  bool isDue(const tskTaskControlBlock *task)
+  {
+    return (task->waitingForNotify && task->notifications > 0) || task->wakeAt <= sim::nowMicros();
+  }
+}
+
+void sim::runTask(const char *name)
+{
+  HeapAccountingPause pause;
+  tasksToRun.push_back(name);
+}
+
+bool sim::inTask()
+{
+  return runningTask != nullptr;
+}
+
+uint64_t sim::nextTaskEventMicros()
+{
+  uint64_t next = UINT64_MAX;
+  for (tskTaskControlBlock *task : scheduledTasks)
+  {
+    next = std::min(next, isDue(task) ? sim::nowMicros() : task->wakeAt);
+  }
+  return next;
+}
+
+void sim::runDueTasks()
+{
+  for (bool ran = true; ran && runningTask == nullptr;)
+  {
+    ran = false;
+    for (tskTaskControlBlock *task : scheduledTasks)
+    {
+      if (isDue(task))
+      {
+        resume(task);
+        ran = true;
+        break; // The list may have changed
+      }
+    }
+  }
+}
+
+void sim::blockTaskUntil(uint64_t atMicros)
+{
+  tskTaskControlBlock *task = runningTask;
+  if (task == nullptr || atMicros <= sim::nowMicros())
+  {
+    return;
+  }
+  task->wakeAt = atMicros;
+  yieldToLoop(task);
+  task->wakeAt = UINT64_MAX;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stackDepth, void *param,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t coreId)
+{
+  (void)stackDepth;
+  (void)priority;
+  (void)coreId;
+  bool scheduled = false;
+  for (const std::string &taskName : tasksToRun)
+  {
+    scheduled = scheduled || taskName == name;
+  }
+  tskTaskControlBlock *task;
+  {
+    sim::HeapAccountingPause pause;
+    task = new tskTaskControlBlock{name, scheduled, fn, param, 0, false, UINT64_MAX};
+  }
+  if (handle != nullptr)
+  {
+    *handle = task;
+  }
+  if (!scheduled)
+  {
+    Serial.printf("[sim] Task '%s' registered (background tasks are not scheduled)\n", name);
+    return pdPASS;
+  }
+
+  Serial.printf("[sim] Task '%s' scheduled\n", name);
+  {
+    sim::HeapAccountingPause pause;
+    scheduledTasks.push_back(task);
+    std::thread([task]()
+                {
+                  {
+                    std::unique_lock<std::mutex> lock(batonMutex);
+                    batonPassed.wait(lock, [task]
+                                     { return runningTask == task; });
+                  }
+                  task->fn(task->param);
+                  // Returning from a task function is an error on the device; park it
+                  task->wakeAt = UINT64_MAX;
+                  task->waitingForNotify = false;
+                  yieldToLoop(task);
+                })
+        .detach();
+  }
+  resume(task); // Runs up to its first wait, as a higher-priority task would
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  if (task->scheduled)
+  {
+    // Its thread stays parked on the baton, never resumed again
+    sim::HeapAccountingPause pause;
+    for (size_t i = 0; i < scheduledTasks.size(); i++)
+    {
+      if (scheduledTasks[i] == task)
+      {
+        scheduledTasks.erase(scheduledTasks.begin() + i);
+        break;
+      }
+    }
+    return;
+  }
+  delete task;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  sim::advanceMillis((uint64_t)ticks * portTICK_PERIOD_MS);
+}
+
+void vTaskDelayUntil(TickType_t *previousWakeTime, TickType_t increment)
+{
+  TickType_t target = *previousWakeTime + increment;
+  TickType_t now = xTaskGetTickCount();
+  if ((int32_t)(target - now) > 0)
+  {
+    vTaskDelay(target - now);
+  }
+  *previousWakeTime = target;
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return (TickType_t)(sim::nowMicros() / (1000ULL * portTICK_PERIOD_MS));
+}
+
+// --- Task notifications ---
+
+namespace
+{
+  tskTaskControlBlock loopTask{"loopTask"};
+  uint32_t loopTaskNotifications = 0;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+  return runningTask != nullptr ? runningTask : &loopTask;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+  // A scheduled task gives the baton back until it is notified or times out
+  tskTaskControlBlock *task = runningTask;
+  if (task != nullptr)
+  {
+    if (task->notifications == 0)
+    {
+      task->waitingForNotify = true;
+      task->wakeAt = ticksToWait == portMAX_DELAY ? UINT64_MAX
+                                                  : sim::nowMicros() + (uint64_t)ticksToWait * portTICK_PERIOD_MS * 1000ULL;
+      yieldToLoop(task);
+      task->waitingForNotify = false;
+      task->wakeAt = UINT64_MAX;
+    }
+    uint32_t count = task->notifications;
+    task->notifications = clearCountOnExit ? 0 : (count ? count - 1 : 0);
+    return count;
+  }
+
+  if (loopTaskNotifications == 0)
+  {
+    if (ticksToWait == portMAX_DELAY)
+    {
+      Serial.println("[sim] ulTaskNotifyTake(portMAX_DELAY) with nothing pending would never return");
+      return 0;
+    }
+    // Sleep until the timeout, or until a scheduled pin edge notifies us
+    uint64_t deadline = sim::nowMicros() + (uint64_t)ticksToWait * portTICK_PERIOD_MS * 1000ULL;
+    while (loopTaskNotifications == 0 && sim::nowMicros() < deadline)
+    {
+      uint64_t next = std::min(sim::nextPinEventMicros(), sim::nextTaskEventMicros());
+      uint64_t until = next < deadline ? next : deadline;
+      sim::advanceMicros(until > sim::nowMicros() ? until - sim::nowMicros() : 0);
+    }
+    if (loopTaskNotifications == 0)
+    {
+      return 0;
+    }
+  }
+
+  uint32_t count = loopTaskNotifications;
+  loopTaskNotifications = clearCountOnExit ? 0 : count - 1;
+  return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+  if (task == &loopTask)
+  {
+    loopTaskNotifications++;
+  }
+  else if (task != nullptr && task->scheduled)
+  {
+    task->notifications++;
+    sim::runDueTasks(); // From the loop it runs now; from a task, when the loop next gets the baton
+  }
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+  xTaskNotifyGive(task);
+  if (higherPriorityTaskWoken != nullptr)
+  {
+    *higherPriorityTaskWoken = pdFALSE;
+  }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <WiFi.h>
+#include <functional>
+#include <vector>
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+// Host stand-in for the ESP32 HTTPClient. Requests are answered by the
+// responder installed with sim::setHttpResponder(); without WiFi or a
+// responder every request fails with HTTPC_ERROR_CONNECTION_REFUSED. Like the
+// real client it reuses its WiFiClient's connection while setReuse(true) and
+// only connects (and, for WiFiClientSecure, handshakes) when it is closed.
+class HTTPClient
+{
+public:
+  bool begin(WiFiClient &client, const String &url);
+  bool begin(const String &url);
+  void end();
+  void addHeader(const String &name, const String &value);
+  void setReuse(bool reuse) { _reuse = reuse; }
+  void setTimeout(uint16_t timeout) { (void)timeout; }
+  int GET();
+  int POST(const String &payload);
+  int POST(const uint8_t *payload, size_t size);
+  String getString() const { return _response; }
+  void collectHeaders(const char *headerKeys[], size_t headerKeysCount);
+  String header(const char *name) const; // Only headers named in collectHeaders()
+
+private:
+  WiFiClient *_client = nullptr;
+  String _url;
+  String _headers;
+  String _response;
+  bool _reuse = true;
+  std::vector<String> _collected;
+
+  int _send(const char *method, const String &payload);
+};
+
+namespace sim
+{
+  struct HttpExchange
+  {
+    String method;
+    String url;
+    String headers; // "Name: value\n" lines, in the order they were added
+    String body;
+  };
+
+  // Returns the HTTP status code (or a negative HTTPC_ERROR_*), filling in the response body
+  typedef std::function<int(const HttpExchange &request, String &responseBody)> HttpResponder;
+  void setHttpResponder(HttpResponder responder);
+
+  // Adds a header to every response from now on (an empty value removes it)
+  void setHttpResponseHeader(const String &name, const String &value);
+
+  struct HttpStats
+  {
+    uint32_t requests;
+    uint32_t failures;
+    uint32_t tcpConnects;   // New TCP connections
+    uint32_t tlsHandshakes; // Full TLS handshakes on top of them
+  };
+  HttpStats httpStats();
+  void resetHttpStats();
+
+  // The server closes every open keep-alive connection (idle timeout, restart)
+  void closeHttpConnections();
+
+  // Modelled network costs charged to the virtual clock
+  const uint64_t HTTP_TCP_CONNECT_US = 20000;    // SYN round trip on a LAN
+  const uint64_t HTTP_TLS_HANDSHAKE_US = 450000; // ECDHE handshake on the ESP32 (mbedTLS, no hardware offload)
+  const uint64_t HTTP_REQUEST_US = 25000;        // Request/response round trip on an open connection
+}
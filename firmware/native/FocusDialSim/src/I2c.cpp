@@ -0,0 +1,134 @@
+#include "driver/i2c.h"
+#include "Sim.h"
+
+#include <Wire.h>
+
+#define I2C_MAX_TRANSACTION 1100 // Address and a whole 128x64 frame with its control byte
+
+namespace
+{
+  enum class Op : uint8_t
+  {
+    Start,
+    Write,
+    Stop
+  };
+
+  struct Command
+  {
+    const uint8_t *data; // Not copied, as IDF: must outlive i2c_master_cmd_begin()
+    uint32_t length;
+    Op op;
+    uint8_t byte; // i2c_master_write_byte()
+  };
+
+  // Laid out in the caller's buffer
+  struct Link
+  {
+    size_t count;
+    size_t capacity;
+    Command commands[1];
+  };
+
+  esp_err_t add(i2c_cmd_handle_t cmd, Command command)
+  {
+    Link *link = (Link *)cmd;
+    if (link == nullptr)
+      return ESP_ERR_INVALID_ARG;
+    if (link->count == link->capacity)
+      return ESP_FAIL; // IDF's static link runs out the same way
+    link->commands[link->count++] = command;
+    return ESP_OK;
+  }
+
+  uint8_t transaction[I2C_MAX_TRANSACTION];
+  bool portBusy = false; // IDF holds a per-port mutex across the command link
+}
+
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t *buffer, uint32_t size)
+{
+  uintptr_t aligned = ((uintptr_t)buffer + alignof(Link) - 1) & ~(uintptr_t)(alignof(Link) - 1);
+  size_t usable = size - (aligned - (uintptr_t)buffer);
+  if (buffer == nullptr || size < (aligned - (uintptr_t)buffer) + sizeof(Link))
+    return nullptr;
+  Link *link = (Link *)aligned;
+  link->count = 0;
+  link->capacity = (usable - offsetof(Link, commands)) / sizeof(Command);
+  return link;
+}
+
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t cmd)
+{
+  (void)cmd;
+}
+
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd)
+{
+  return add(cmd, {nullptr, 0, Op::Start, 0});
+}
+
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ackEnable)
+{
+  (void)ackEnable;
+  return add(cmd, {nullptr, 1, Op::Write, data});
+}
+
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t *data, size_t length, bool ackEnable)
+{
+  (void)ackEnable;
+  if (data == nullptr)
+    return ESP_ERR_INVALID_ARG;
+  return add(cmd, {data, (uint32_t)length, Op::Write, 0});
+}
+
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd)
+{
+  return add(cmd, {nullptr, 0, Op::Stop, 0});
+}
+
+// Each transaction's first byte is the address and the write bit; the rest
+// goes to the device there, which charges the bus time
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t ticksToWait)
+{
+  (void)ticksToWait;
+  Link *link = (Link *)cmd;
+  if (port != I2C_NUM_0 || link == nullptr)
+    return ESP_ERR_INVALID_ARG;
+
+  while (portBusy)
+    sim::advanceMicros(10);
+  portBusy = true;
+  esp_err_t result = ESP_OK;
+  size_t length = 0;
+  for (size_t i = 0; i < link->count; i++)
+  {
+    const Command &command = link->commands[i];
+    if (command.op == Op::Start)
+    {
+      length = 0;
+    }
+    else if (command.op == Op::Write)
+    {
+      if (length + command.length > I2C_MAX_TRANSACTION)
+      {
+        result = ESP_ERR_INVALID_SIZE;
+        break;
+      }
+      memcpy(transaction + length, command.data ? command.data : &command.byte, command.length);
+      length += command.length;
+    }
+    else if (length > 0)
+    {
+      TwoWireDevice *device = Wire.deviceAt(transaction[0] >> 1);
+      if (device == nullptr || (transaction[0] & 1) != I2C_MASTER_WRITE)
+      {
+        result = ESP_FAIL; // NACK on the address
+        break;
+      }
+      device->receive(transaction + 1, length - 1);
+      length = 0;
+    }
+  }
+  portBusy = false;
+  return result;
+}
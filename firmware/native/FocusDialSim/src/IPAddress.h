@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "Print.h"
+
+class IPAddress : public Printable
+{
+public:
+  IPAddress() : _addr{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr{a, b, c, d} {}
+
+  String toString() const
+  {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr[0], _addr[1], _addr[2], _addr[3]);
+    return String(buf);
+  }
+
+  size_t printTo(Print &p) const override { return p.print(toString()); }
+
+private:
+  uint8_t _addr[4];
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "FS.h"
+
+namespace fs
+{
+  // LittleFS on a partition of firmware/partitions.csv. Space is counted in
+  // 4 KB blocks as LittleFS allocates it: at least one a file, two for each
+  // directory's metadata, and a write that needs a block when none is free
+  // fails.
+  class LittleFSFS : public FS
+  {
+  public:
+    bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10, const char *partitionLabel = "spiffs");
+    void end();
+    bool format();
+    size_t totalBytes() const;
+    size_t usedBytes() const;
+  };
+}
+
+using fs::LittleFSFS;
+
+extern fs::LittleFSFS LittleFS;
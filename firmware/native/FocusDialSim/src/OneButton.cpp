@@ -0,0 +1,157 @@
+#include "OneButton.h"
+
+OneButton::OneButton(const int pin, const bool activeLow, const bool pullupActive)
+{
+  (void)pullupActive;
+  _pin = pin;
+  _buttonPressed = activeLow ? LOW : HIGH;
+}
+
+void OneButton::attachClick(callbackFunction newFunction)
+{
+  _clickFunc = newFunction;
+}
+
+void OneButton::attachClick(parameterizedCallbackFunction newFunction, void *parameter)
+{
+  _paramClickFunc = newFunction;
+  _clickFuncParam = parameter;
+}
+
+void OneButton::attachDoubleClick(callbackFunction newFunction)
+{
+  _doubleClickFunc = newFunction;
+  _maxClicks = max(_maxClicks, 2);
+}
+
+void OneButton::attachDoubleClick(parameterizedCallbackFunction newFunction, void *parameter)
+{
+  _paramDoubleClickFunc = newFunction;
+  _doubleClickFuncParam = parameter;
+  _maxClicks = max(_maxClicks, 2);
+}
+
+void OneButton::attachLongPressStart(callbackFunction newFunction)
+{
+  _longPressStartFunc = newFunction;
+}
+
+void OneButton::attachLongPressStart(parameterizedCallbackFunction newFunction, void *parameter)
+{
+  _paramLongPressStartFunc = newFunction;
+  _longPressStartFuncParam = parameter;
+}
+
+void OneButton::tick()
+{
+  if (_pin >= 0)
+  {
+    _fsm(_debounce(digitalRead(_pin) == _buttonPressed));
+  }
+}
+
+void OneButton::tick(bool activeLevel)
+{
+  _fsm(_debounce(activeLevel));
+}
+
+void OneButton::reset()
+{
+  _state = OCS_INIT;
+  _nClicks = 0;
+  _startTime = millis();
+}
+
+bool OneButton::_debounce(bool value)
+{
+  _now = millis();
+  if (_lastDebounceLevel == value)
+  {
+    if (_now - _lastDebounceTime >= _debounce_ms)
+    {
+      _debouncedLevel = value;
+    }
+  }
+  else
+  {
+    _lastDebounceTime = _now;
+    _lastDebounceLevel = value;
+  }
+  return _debouncedLevel;
+}
+
+void OneButton::_fsm(bool activeLevel)
+{
+  unsigned long waitTime = (_now - _startTime);
+
+  switch (_state)
+  {
+  case OCS_INIT:
+    if (activeLevel)
+    {
+      _state = OCS_DOWN;
+      _startTime = _now;
+      _nClicks = 0;
+    }
+    break;
+
+  case OCS_DOWN:
+    if (!activeLevel)
+    {
+      _state = OCS_UP;
+      _startTime = _now;
+    }
+    else if (waitTime > _press_ms)
+    {
+      if (_longPressStartFunc)
+        _longPressStartFunc();
+      if (_paramLongPressStartFunc)
+        _paramLongPressStartFunc(_longPressStartFuncParam);
+      _state = OCS_PRESS;
+    }
+    break;
+
+  case OCS_UP:
+    _nClicks++;
+    _state = OCS_COUNT;
+    break;
+
+  case OCS_COUNT:
+    if (activeLevel)
+    {
+      _state = OCS_DOWN;
+      _startTime = _now;
+    }
+    else if ((waitTime >= _click_ms) || (_nClicks == _maxClicks))
+    {
+      if (_nClicks == 1)
+      {
+        if (_clickFunc)
+          _clickFunc();
+        if (_paramClickFunc)
+          _paramClickFunc(_clickFuncParam);
+      }
+      else if (_nClicks == 2)
+      {
+        if (_doubleClickFunc)
+          _doubleClickFunc();
+        if (_paramDoubleClickFunc)
+          _paramDoubleClickFunc(_doubleClickFuncParam);
+      }
+      reset();
+    }
+    break;
+
+  case OCS_PRESS:
+    if (!activeLevel)
+    {
+      _state = OCS_PRESSEND;
+      _startTime = _now;
+    }
+    break;
+
+  case OCS_PRESSEND:
+    reset();
+    break;
+  }
+}
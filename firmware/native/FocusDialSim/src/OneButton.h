@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+
+extern "C"
+{
+  typedef void (*callbackFunction)(void);
+  typedef void (*parameterizedCallbackFunction)(void *);
+}
+
+// Host port of mathertel/OneButton 2.x: same debounce and click/double/long
+// state machine, reading the level from the virtual GPIO.
+class OneButton
+{
+public:
+  OneButton(const int pin, const bool activeLow = true, const bool pullupActive = true);
+
+  void setDebounceMs(const int ms) { _debounce_ms = ms; }
+  void setClickMs(const unsigned int ms) { _click_ms = ms; }
+  void setPressMs(const unsigned int ms) { _press_ms = ms; }
+
+  void attachClick(callbackFunction newFunction);
+  void attachClick(parameterizedCallbackFunction newFunction, void *parameter);
+  void attachDoubleClick(callbackFunction newFunction);
+  void attachDoubleClick(parameterizedCallbackFunction newFunction, void *parameter);
+  void attachLongPressStart(callbackFunction newFunction);
+  void attachLongPressStart(parameterizedCallbackFunction newFunction, void *parameter);
+
+  void tick();
+  void tick(bool activeLevel);
+  void reset();
+  bool isIdle() const { return _state == OCS_INIT; }
+  bool isLongPressed() const { return _state == OCS_PRESS; }
+
+private:
+  enum stateMachine_t : int
+  {
+    OCS_INIT = 0,
+    OCS_DOWN = 1,
+    OCS_UP = 2,
+    OCS_COUNT = 3,
+    OCS_PRESS = 6,
+    OCS_PRESSEND = 7,
+  };
+
+  int _pin = -1;
+  int _buttonPressed = LOW;
+  unsigned int _debounce_ms = 50;
+  unsigned int _click_ms = 400;
+  unsigned int _press_ms = 800;
+  int _maxClicks = 1;
+
+  callbackFunction _clickFunc = nullptr;
+  parameterizedCallbackFunction _paramClickFunc = nullptr;
+  void *_clickFuncParam = nullptr;
+  callbackFunction _doubleClickFunc = nullptr;
+  parameterizedCallbackFunction _paramDoubleClickFunc = nullptr;
+  void *_doubleClickFuncParam = nullptr;
+  callbackFunction _longPressStartFunc = nullptr;
+  parameterizedCallbackFunction _paramLongPressStartFunc = nullptr;
+  void *_longPressStartFuncParam = nullptr;
+
+  stateMachine_t _state = OCS_INIT;
+  bool _debouncedLevel = false;
+  bool _lastDebounceLevel = false;
+  unsigned long _lastDebounceTime = 0;
+  unsigned long _now = 0;
+  unsigned long _startTime = 0;
+  int _nClicks = 0;
+
+  bool _debounce(bool value);
+  void _fsm(bool activeLevel);
+};
@@ -0,0 +1,232 @@
+#include "Preferences.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+typedef std::map<std::string, std::vector<uint8_t>> NvsNamespace;
+
+static std::map<std::string, NvsNamespace> &nvsStore()
+{
+  static std::map<std::string, NvsNamespace> store;
+  return store;
+}
+
+static sim::NvsStats nvsCounters = {};
+
+sim::NvsStats sim::nvsStats()
+{
+  return nvsCounters;
+}
+
+void sim::resetNvsStats()
+{
+  nvsCounters = {};
+}
+
+esp_err_t nvs_flash_init()
+{
+  return ESP_OK;
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partitionLabel)
+{
+  (void)partitionLabel;
+  if (name == nullptr || strlen(name) >= sizeof(_namespace))
+  {
+    return false; // NVS namespace names are limited to 15 characters
+  }
+  sim::HeapAccountingPause pause;
+  strcpy(_namespace, name);
+  nvsStore()[_namespace];
+  _started = true;
+  _readOnly = readOnly;
+  nvsCounters.opens++;
+  return true;
+}
+
+void Preferences::end()
+{
+  _started = false;
+}
+
+bool Preferences::clear()
+{
+  if (!_started || _readOnly)
+  {
+    return false;
+  }
+  sim::HeapAccountingPause pause;
+  nvsStore()[_namespace].clear();
+  nvsCounters.writes++;
+  return true;
+}
+
+bool Preferences::remove(const char *key)
+{
+  if (!_started || _readOnly)
+  {
+    return false;
+  }
+  sim::HeapAccountingPause pause;
+  bool removed = nvsStore()[_namespace].erase(key) > 0;
+  if (removed)
+  {
+    nvsCounters.writes++;
+  }
+  return removed;
+}
+
+bool Preferences::isKey(const char *key)
+{
+  if (!_started)
+  {
+    return false;
+  }
+  sim::HeapAccountingPause pause;
+  const NvsNamespace &ns = nvsStore()[_namespace];
+  return ns.find(key) != ns.end();
+}
+
+size_t Preferences::_put(const char *key, const void *value, size_t len, bool variableLength)
+{
+  if (!_started || _readOnly || key == nullptr || strlen(key) > 15)
+  {
+    return 0; // NVS keys are limited to 15 characters too
+  }
+  sim::HeapAccountingPause pause;
+  const uint8_t *bytes = (const uint8_t *)value;
+  nvsStore()[_namespace][key] = std::vector<uint8_t>(bytes, bytes + len);
+  nvsCounters.writes++;
+  nvsCounters.bytesWritten += len;
+  nvsCounters.flashBytes += variableLength ? 32 * (1 + (len + 31) / 32) : 32;
+  return len;
+}
+
+bool Preferences::_get(const char *key, void *buf, size_t len)
+{
+  if (!_started || key == nullptr)
+  {
+    return false;
+  }
+  sim::HeapAccountingPause pause;
+  const NvsNamespace &ns = nvsStore()[_namespace];
+  auto it = ns.find(key);
+  if (it == ns.end() || it->second.size() != len)
+  {
+    return false;
+  }
+  memcpy(buf, it->second.data(), len);
+  return true;
+}
+
+size_t Preferences::putBool(const char *key, bool value)
+{
+  uint8_t v = value ? 1 : 0;
+  return _put(key, &v, sizeof(v));
+}
+
+size_t Preferences::putInt(const char *key, int32_t value)
+{
+  return _put(key, &value, sizeof(value));
+}
+
+size_t Preferences::putUInt(const char *key, uint32_t value)
+{
+  return _put(key, &value, sizeof(value));
+}
+
+size_t Preferences::putULong64(const char *key, uint64_t value)
+{
+  return _put(key, &value, sizeof(value));
+}
+
+size_t Preferences::putString(const char *key, const char *value)
+{
+  if (value == nullptr)
+  {
+    return 0;
+  }
+  // Stored with its terminator, like nvs_set_str()
+  size_t len = strlen(value);
+  return _put(key, value, len + 1, true) ? len : 0;
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len)
+{
+  return _put(key, value, len, true);
+}
+
+bool Preferences::getBool(const char *key, bool defaultValue)
+{
+  uint8_t v;
+  return _get(key, &v, sizeof(v)) ? v != 0 : defaultValue;
+}
+
+int32_t Preferences::getInt(const char *key, int32_t defaultValue)
+{
+  int32_t v;
+  return _get(key, &v, sizeof(v)) ? v : defaultValue;
+}
+
+uint32_t Preferences::getUInt(const char *key, uint32_t defaultValue)
+{
+  uint32_t v;
+  return _get(key, &v, sizeof(v)) ? v : defaultValue;
+}
+
+uint64_t Preferences::getULong64(const char *key, uint64_t defaultValue)
+{
+  uint64_t v;
+  return _get(key, &v, sizeof(v)) ? v : defaultValue;
+}
+
+String Preferences::getString(const char *key, const String &defaultValue)
+{
+  if (!_started || key == nullptr)
+  {
+    return defaultValue;
+  }
+  std::string value;
+  {
+    sim::HeapAccountingPause pause;
+    const NvsNamespace &ns = nvsStore()[_namespace];
+    auto it = ns.find(key);
+    if (it == ns.end() || it->second.empty())
+    {
+      return defaultValue;
+    }
+    value.assign((const char *)it->second.data(), it->second.size() - 1);
+  }
+  // The returned String is the caller's allocation, as on the device
+  return String(value.c_str(), value.size());
+}
+
+size_t Preferences::getBytesLength(const char *key)
+{
+  if (!_started || key == nullptr)
+  {
+    return 0;
+  }
+  sim::HeapAccountingPause pause;
+  const NvsNamespace &ns = nvsStore()[_namespace];
+  auto it = ns.find(key);
+  return it == ns.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen)
+{
+  if (!_started || key == nullptr)
+  {
+    return 0;
+  }
+  sim::HeapAccountingPause pause;
+  const NvsNamespace &ns = nvsStore()[_namespace];
+  auto it = ns.find(key);
+  if (it == ns.end() || it->second.size() > maxLen)
+  {
+    return 0;
+  }
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
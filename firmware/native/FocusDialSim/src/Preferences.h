@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Host replacement for the ESP32 Preferences (NVS) wrapper.
+//
+// All instances share one in-memory store keyed by namespace, which survives
+// for the lifetime of the simulator process. Like the real library, writes
+// through a namespace opened read-only fail.
+//
+// Members are plain data so global instances work even when they are used
+// by other static constructors before their own constructor has run.
+class Preferences
+{
+public:
+  bool begin(const char *name, bool readOnly = false, const char *partitionLabel = nullptr);
+  void end();
+
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putBool(const char *key, bool value);
+  size_t putInt(const char *key, int32_t value);
+  size_t putUInt(const char *key, uint32_t value);
+  size_t putULong64(const char *key, uint64_t value);
+  size_t putString(const char *key, const char *value);
+  size_t putString(const char *key, const String &value) { return putString(key, value.c_str()); }
+  size_t putBytes(const char *key, const void *value, size_t len);
+
+  bool getBool(const char *key, bool defaultValue = false);
+  int32_t getInt(const char *key, int32_t defaultValue = 0);
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+  uint64_t getULong64(const char *key, uint64_t defaultValue = 0);
+  String getString(const char *key, const String &defaultValue = String());
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+private:
+  char _namespace[16];
+  bool _started;
+  bool _readOnly;
+
+  size_t _put(const char *key, const void *value, size_t len, bool variableLength = false);
+  bool _get(const char *key, void *buf, size_t len);
+};
+
+esp_err_t nvs_flash_init();
+
+namespace sim
+{
+  // Flash write accounting for the emulated NVS partition
+  struct NvsStats
+  {
+    size_t opens;        // Preferences::begin() calls
+    size_t writes;       // Successful put*/remove/clear calls
+    size_t bytesWritten; // Payload bytes written (keys excluded)
+    size_t flashBytes;   // Flash consumed: 32-byte NVS entries, one per primitive or
+                         // one header plus ceil(length / 32) data entries per string/blob
+  };
+  NvsStats nvsStats();
+  void resetNvsStats();
+}
@@ -0,0 +1,64 @@
+#include "Print.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::write(const char *str)
+{
+  if (str == nullptr)
+  {
+    return 0;
+  }
+  return write((const uint8_t *)str, strlen(str));
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char stackBuf[128];
+  va_list args;
+  va_start(args, format);
+  va_list copy;
+  va_copy(copy, args);
+  int len = vsnprintf(stackBuf, sizeof(stackBuf), format, copy);
+  va_end(copy);
+  if (len < 0)
+  {
+    va_end(args);
+    return 0;
+  }
+  if ((size_t)len < sizeof(stackBuf))
+  {
+    va_end(args);
+    return write((const uint8_t *)stackBuf, len);
+  }
+  std::vector<char> heapBuf(len + 1);
+  vsnprintf(heapBuf.data(), heapBuf.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)heapBuf.data(), len);
+}
+
+size_t Print::print(long n, int base)
+{
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::print(double n, int digits)
+{
+  return print(String(n, (unsigned int)digits));
+}
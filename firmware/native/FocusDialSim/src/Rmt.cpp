@@ -0,0 +1,133 @@
+#include "driver/rmt.h"
+#include "Sim.h"
+
+#include <vector>
+
+namespace
+{
+  struct Channel
+  {
+    bool configured = false;
+    bool installed = false;
+    uint8_t clockDivider = 80;
+    uint64_t busyUntil = 0;
+    std::vector<rmt_item32_t> lastItems;
+  };
+
+  Channel channels[RMT_CHANNEL_MAX];
+  sim::RmtStats stats;
+}
+
+esp_err_t rmt_config(const rmt_config_t *config)
+{
+  if (config == nullptr || config->channel >= RMT_CHANNEL_MAX || config->clk_div == 0)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  channels[config->channel].configured = true;
+  channels[config->channel].clockDivider = config->clk_div;
+  return ESP_OK;
+}
+
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBufferSize, int interruptFlags)
+{
+  (void)rxBufferSize;
+  (void)interruptFlags;
+  if (channel >= RMT_CHANNEL_MAX || !channels[channel].configured)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  channels[channel].installed = true;
+  return ESP_OK;
+}
+
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *items, int itemCount, bool waitTxDone)
+{
+  if (channel >= RMT_CHANNEL_MAX || !channels[channel].installed || items == nullptr || itemCount <= 0)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  Channel &c = channels[channel];
+
+  // Ticks of 12.5 ns * divider
+  uint64_t ticks = 0;
+  for (int i = 0; i < itemCount; i++)
+  {
+    ticks += items[i].duration0 + items[i].duration1;
+  }
+  uint64_t wireMicros = ticks * c.clockDivider / 80;
+
+  {
+    sim::HeapAccountingPause pause;
+    c.lastItems.assign(items, items + itemCount);
+  }
+  c.busyUntil = sim::nowMicros() + wireMicros;
+  stats.writes++;
+  stats.items += itemCount;
+  stats.wireMicros += wireMicros;
+
+  if (waitTxDone)
+  {
+    sim::advanceMicros(wireMicros);
+  }
+  return ESP_OK;
+}
+
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, uint32_t waitTicks)
+{
+  if (channel >= RMT_CHANNEL_MAX)
+  {
+    return ESP_ERR_INVALID_ARG;
+  }
+  Channel &c = channels[channel];
+  uint64_t now = sim::nowMicros();
+  if (now >= c.busyUntil)
+  {
+    return ESP_OK;
+  }
+  uint64_t waitMicros = (uint64_t)waitTicks * 1000ULL;
+  if (waitMicros < c.busyUntil - now)
+  {
+    sim::advanceMicros(waitMicros);
+    return ESP_ERR_TIMEOUT;
+  }
+  sim::advanceMicros(c.busyUntil - now);
+  return ESP_OK;
+}
+
+namespace sim
+{
+  RmtStats rmtStats()
+  {
+    return stats;
+  }
+
+  void resetRmtStats()
+  {
+    stats = RmtStats();
+  }
+
+  size_t rmtLastFrame(rmt_channel_t channel, uint32_t *colors, size_t maxLeds)
+  {
+    const std::vector<rmt_item32_t> &items = channels[channel].lastItems;
+    size_t leds = items.size() / 24;
+    if (leds > maxLeds)
+    {
+      leds = maxLeds;
+    }
+    for (size_t led = 0; led < leds; led++)
+    {
+      uint8_t grb[3] = {0, 0, 0};
+      for (size_t bit = 0; bit < 24; bit++)
+      {
+        const rmt_item32_t &item = items[led * 24 + bit];
+        if (item.duration0 > item.duration1) // Long high half = 1
+        {
+          grb[bit / 8] |= 0x80 >> (bit % 8);
+        }
+      }
+      colors[led] = ((uint32_t)grb[1] << 16) | ((uint32_t)grb[0] << 8) | grb[2];
+    }
+    return leds;
+  }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Host-side simulation harness.
+//
+// Time is virtual: millis()/micros() only move when the harness (or delay())
+// advances the clock, so hours of device time can be replayed in milliseconds.
+// Pin levels are virtual too: setPin() updates the level seen by digitalRead()
+// and fires any interrupt attached with attachInterrupt().
+namespace sim
+{
+  // --- Virtual clock ---
+  uint64_t nowMicros();
+  void advanceMicros(uint64_t us);
+  inline void advanceMillis(uint64_t ms) { advanceMicros(ms * 1000ULL); }
+
+  // --- Virtual GPIO ---
+  void setPin(uint8_t pin, int level);
+  int getPin(uint8_t pin);
+
+  // Queue a level change at an absolute virtual time. It fires, interrupt
+  // included, as soon as the clock passes it, even in the middle of an OLED
+  // flush or a scheduler sleep, which is how edge traces are replayed.
+  void schedulePin(uint64_t atMicros, uint8_t pin, int level);
+  uint64_t nextPinEventMicros(); // UINT64_MAX when nothing is queued
+
+  // --- Tasks ---
+  // xTaskCreate*() only registers a task unless its name was passed here
+  // first; those run, one thread at a time with the loop (see FreeRTOS.cpp).
+  void runTask(const char *name);
+  bool inTask();                  // Called from a scheduled task rather than the loop
+  uint64_t nextTaskEventMicros(); // UINT64_MAX when no task is due or waiting on the clock
+  void runDueTasks();             // From the loop: run tasks that were notified or whose time came
+  void blockTaskUntil(uint64_t atMicros); // From a task: give way to the loop until then, as a driver wait would
+
+  // --- Network ---
+  const char *sntpServer(); // Server of the last configTime(), nullptr before any
+
+  // --- Serial ---
+  void setSerialEcho(bool enabled); // Serial output goes to stdout when enabled (default)
+  void serialInput(const char *text); // Queue bytes for Serial.read(), as if typed on the console
+
+  // --- Heap accounting (global operator new/delete) ---
+  struct HeapStats
+  {
+    size_t allocations;
+    size_t frees;
+    size_t bytesAllocated;
+    size_t liveBytes;
+    size_t peakLiveBytes;
+  };
+  HeapStats heapStats();
+  void resetHeapStats();
+
+  // Scoped guard used by shims whose own bookkeeping (e.g. the emulated NVS
+  // store) should not show up as firmware heap churn
+  struct HeapAccountingPause
+  {
+    HeapAccountingPause();
+    ~HeapAccountingPause();
+  };
+}
@@ -0,0 +1,146 @@
+#include "SimDevice.h"
+
+#include <Preferences.h>
+#include <chrono>
+#include "Config.h"
+#include "StateMachine.h"
+#include "drivers/BufferedSSD1306.h"
+
+void setup();
+void loop();
+
+static uint64_t loopCostMicros = 100;
+static sim::LoopObserver loopObserver = nullptr;
+
+bool sim::bootDevice(int timerMinutes)
+{
+  Preferences seed;
+  seed.begin("network", false);
+  seed.putString("ssid", "sim-network");
+  seed.end();
+  seed.begin("focusdial", false);
+  seed.putInt("timer", timerMinutes);
+  seed.end();
+
+  setHttpResponder(acceptWebhook);
+  // Panel updates go out from their own task, as on the device
+  runTask("OLED Flush");
+
+  setup();
+  setWiFiConnected(true);
+  return runUntil(&StateMachine::idleState, (SPLASH_DURATION + 5) * 1000);
+}
+
+int sim::acceptWebhook(const HttpExchange &request, String &responseBody)
+{
+  (void)request;
+  responseBody = "{\"ok\":true}";
+  return 200;
+}
+
+void sim::setLoopCost(uint64_t micros)
+{
+  loopCostMicros = micros;
+}
+
+void sim::setLoopObserver(LoopObserver observer)
+{
+  loopObserver = observer;
+}
+
+void sim::step()
+{
+  uint64_t virtualStart = nowMicros();
+  auto wallStart = std::chrono::steady_clock::now();
+
+  loop();
+
+  auto wallEnd = std::chrono::steady_clock::now();
+  advanceMicros(loopCostMicros);
+
+  if (loopObserver)
+  {
+    HeapAccountingPause pause;
+    loopObserver(std::chrono::duration<float, std::micro>(wallEnd - wallStart).count(), nowMicros() - virtualStart);
+  }
+}
+
+void sim::runForMs(uint64_t ms)
+{
+  uint64_t end = nowMicros() + ms * 1000ULL;
+  while (nowMicros() < end)
+    step();
+}
+
+bool sim::runUntil(State *target, uint64_t timeoutMs)
+{
+  uint64_t end = nowMicros() + timeoutMs * 1000ULL;
+  while (stateMachine.getCurrentState() != target)
+  {
+    if (nowMicros() >= end)
+      return false;
+    step();
+  }
+  return true;
+}
+
+void sim::click()
+{
+  setPin(BUTTON_PIN, LOW);
+  runForMs(80);
+  setPin(BUTTON_PIN, HIGH);
+  runForMs(400);
+}
+
+void sim::doubleClick()
+{
+  setPin(BUTTON_PIN, LOW);
+  runForMs(60);
+  setPin(BUTTON_PIN, HIGH);
+  runForMs(80);
+  setPin(BUTTON_PIN, LOW);
+  runForMs(60);
+  setPin(BUTTON_PIN, HIGH);
+  runForMs(400);
+}
+
+uint64_t sim::queueEncoderTrace(int detents, uint32_t detentHz, int bounces)
+{
+  // Gray code in the decoder's (B << 1 | A) order; latches at 11 and 00
+  static const uint8_t forward[] = {1, 0, 2, 3};
+  uint64_t edgeMicros = 1000000ULL / (2ULL * detentHz);
+  uint64_t t = nowMicros() + edgeMicros;
+  uint8_t state = (getPin(ENCODER_A_PIN) ? 1 : 0) | (getPin(ENCODER_B_PIN) ? 2 : 0);
+  int index = 0;
+  while (forward[index] != state)
+    index++;
+
+  int steps = abs(detents) * 2;
+  for (int i = 0; i < steps; i++)
+  {
+    index = (index + (detents > 0 ? 1 : 3)) % 4;
+    uint8_t next = forward[index];
+    uint8_t pin = ((next ^ state) & 1) ? ENCODER_A_PIN : ENCODER_B_PIN;
+    int level = (pin == ENCODER_A_PIN) ? (next & 1) : (next >> 1);
+    for (int b = 0; b < bounces; b++)
+    {
+      schedulePin(t + 2 * b, pin, (b % 2 == 0) ? level : !level);
+    }
+    schedulePin(t + 2 * bounces, pin, level);
+    state = next;
+    t += edgeMicros;
+  }
+  return t - nowMicros();
+}
+
+void sim::settleFlush(BufferedSSD1306 &oled)
+{
+  for (;;)
+  {
+    OledFlushStats stats = oled.getFlushStats();
+    if (!oled.isBuffered() || stats.presented - stats.dropped <= stats.flushes)
+      return;
+    oled.service();
+    advanceMicros(100);
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include "Sim.h"
+
+class State;
+class BufferedSSD1306;
+
+// Runs the firmware itself (setup() and loop() from firmware/src/main.cpp)
+// on the virtual clock and works its controls, for SimMain's session and the
+// test suites in firmware/test that need a whole device.
+namespace sim
+{
+  // --- Booting ---
+  // A provisioned device set to timerMinutes, with webhooks answered by
+  // acceptWebhook and the OLED flush task running as on the device: runs
+  // setup(), connects WiFi and waits for the Idle screen. False if it never
+  // got there.
+  bool bootDevice(int timerMinutes);
+  int acceptWebhook(const HttpExchange &request, String &responseBody); // 200 {"ok":true}
+
+  // --- Loop ---
+  void setLoopCost(uint64_t micros); // Virtual CPU time charged per loop() on top of its sleeps (default 100)
+  // Called after every loop() with the host time it took and the virtual time it covered
+  typedef void (*LoopObserver)(float wallMicros, uint64_t virtualMicros);
+  void setLoopObserver(LoopObserver observer);
+  void step(); // One loop()
+  void runForMs(uint64_t ms);
+  bool runUntil(State *target, uint64_t timeoutMs); // False if the state machine isn't there in time
+
+  // --- Controls ---
+  void click();       // Press and release the encoder button, then wait out the double-click window
+  void doubleClick(); // Two presses inside the double-click window
+  // Queue `detents` quadrature detents starting now, with `bounces` extra
+  // chatter transitions (2 us apart) on every edge. Returns the trace length.
+  uint64_t queueEncoderTrace(int detents, uint32_t detentHz, int bounces);
+
+  // --- Display ---
+  void settleFlush(BufferedSSD1306 &oled); // Runs the flush task until every presented frame is on the panel
+}
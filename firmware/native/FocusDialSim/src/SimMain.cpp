@@ -0,0 +1,1450 @@
+// Session and benchmark runner for the `native` PlatformIO environment
+// (`pio run -e native`). Pass/fail checks of single subsystems live in
+// firmware/test (`pio test -e native`).
+//
+// Boots the firmware against the host shims (SimDevice.h) and plays a focus
+// session on the virtual clock: splash -> idle -> project select -> a full
+// countdown -> done, stalling the loop once a minute and checking the LED
+// ring still matches the remaining time. It prints what the session cost:
+// host CPU per loop(), heap churn, OLED and LED bus time, and the time the
+// loop task spent asleep in the scheduler.
+//
+// Then it benchmarks, one "===" section each and against the code each
+// replaced where there was one: webhook POSTs on a kept-alive connection,
+// the project catalog (migration, boot load, flash per edit, memory and
+// lookups up to 5000 projects), the project select screen, /api/projects and
+// its ETag and ?since= sync, the web UI assets, color previews and timer
+// frames over the WebSocket, and the display: timer digits, animation
+// frames, windowed updates and the flush task. A section fails the run when
+// its result regresses.
+//
+// Usage: program [--minutes N] [--step-us N] [--project-dir DIR] [--verbose]
+//   --minutes       Timer length to run (default 240, the MAX_TIMER)
+//   --step-us       Virtual CPU time charged per loop() on top of bus time and scheduler sleeps (default 100)
+//   --project-dir   Repository root, for firmware/tools/build_web.py (default: the current directory)
+//   --verbose       Echo the firmware's Serial output
+
+#ifndef PIO_UNIT_TESTING // The test suites bring their own main()
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <HTTPClient.h>
+#include <driver/rmt.h>
+#include <Preferences.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+#include <algorithm>
+#include "Config.h"
+#include "Controllers.h"
+#include "Metrics.h"
+#include "StateMachine.h"
+#include "states/ProjectSelectState.h"
+#include "managers/WebhookOutbox.h"
+#include "managers/WebhookConnection.h"
+#include "managers/ProjectManager.h"
+#include "fonts/Org_01.h"
+#include "fonts/Org_01_digits.h"
+#include "Animation.h"
+#include "drivers/BufferedSSD1306.h"
+#include "animations.h"
+#include "SimDevice.h"
+
+namespace
+{
+  std::string projectDir = "."; // Holds firmware/tools/build_web.py
+
+  struct LoopProfile
+  {
+    std::vector<float> wallMicros; // Host time per loop() call
+    uint64_t virtualMicros;        // Device time covered by the profiled loops
+  };
+
+  LoopProfile profile;
+  uint32_t framesRenderedAtStart = 0;
+  uint32_t framesSkippedAtStart = 0;
+  SchedulerStats schedulerAtStart = {};
+  uint32_t ledFramesShownAtStart = 0;
+  uint32_t ledFramesSkippedAtStart = 0;
+  OledFlushStats flushAtStart = {};
+
+  const uint64_t RING_STALL_MS = 3000; // A stuck loop pass, e.g. a TLS handshake on the loop task
+
+  struct RingCheck
+  {
+    uint32_t checks;
+    int maxError; // LEDs off from what the remaining time calls for
+  };
+  RingCheck ringCheck = {};
+
+  void profileLoop(float wallMicros, uint64_t virtualMicros)
+  {
+    profile.wallMicros.push_back(wallMicros);
+    profile.virtualMicros += virtualMicros;
+  }
+
+  // LEDs lit on the wire against the share of the countdown still to run
+  void checkRing(uint64_t timerStartMicros, int minutes)
+  {
+    uint32_t colors[NUM_LEDS];
+    size_t leds = sim::rmtLastFrame(NEOPIXEL_RMT_CHANNEL, colors, NUM_LEDS);
+    int lit = 0;
+    for (size_t i = 0; i < leds; i++)
+    {
+      if (colors[i] != 0)
+        lit++;
+    }
+    double durationMicros = minutes * 60e6;
+    double remaining = 1.0 - (sim::nowMicros() - timerStartMicros) / durationMicros;
+    int expected = (int)ceil(remaining * NUM_LEDS);
+    ringCheck.checks++;
+    ringCheck.maxError = std::max(ringCheck.maxError, abs(lit - expected));
+  }
+
+  // A burst of webhook POSTs (an outbox backlog) with the server dropping
+  // idle connections half way, against a new connection per POST as before
+  bool benchmarkWebhookConnection()
+  {
+    printf("\n=== Webhook connection ===\n");
+    const char *url = "https://tracker.example/api/webhook";
+    const char *body = "{\"action\":\"start_timer\"}";
+    const int burst = 20;
+
+    sim::resetHttpStats();
+    uint64_t start = sim::nowMicros();
+    for (int i = 0; i < burst; i++)
+    {
+      WebhookConnection fresh;
+      fresh.post(url, "key", body, strlen(body));
+    }
+    uint64_t freshMicros = sim::nowMicros() - start;
+    uint32_t freshHandshakes = sim::httpStats().tlsHandshakes;
+
+    sim::resetHttpStats();
+    WebhookConnection connection;
+    start = sim::nowMicros();
+    for (int i = 0; i < burst; i++)
+    {
+      if (i == burst / 2)
+        sim::closeHttpConnections(); // Server keep-alive timeout
+      if (connection.post(url, "key", body, strlen(body)) != 200)
+        return false;
+    }
+    uint64_t keptMicros = sim::nowMicros() - start;
+    const WebhookConnectionStats &stats = connection.getStats();
+    const LatencyHistogram &latency = connection.getLatency();
+
+    printf("New connection each : %d POSTs, %u TLS handshakes, %.1f ms per POST\n",
+           burst, freshHandshakes, freshMicros / 1000.0 / burst);
+    printf("Kept-alive          : %d POSTs, %u TLS handshakes (%u stale), reuse %.0f%%, %.1f ms per POST\n",
+           burst, sim::httpStats().tlsHandshakes, stats.staleRetries, 100.0f * connection.getReuseRatio(), keptMicros / 1000.0 / burst);
+    printf("Latency (ms)        : p50 %.1f, p99 %.1f, max %.1f\n",
+           latency.getPercentile(0.50f) / 1000.0, latency.getPercentile(0.99f) / 1000.0, latency.getMax() / 1000.0);
+
+    connection.close();
+    return stats.handshakes == 2 && stats.reused == (uint32_t)burst - 2;
+  }
+
+  double percentile(std::vector<float> &samples, double p)
+  {
+    if (samples.empty())
+      return 0;
+    size_t index = (size_t)(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+  }
+
+  // The largest project list the JSON store held: migrated into the catalog
+  // by a fresh ProjectManager, loaded again, then edited. The old loader's
+  // work (getString, parse, build the list) is repeated here as the baseline,
+  // and an old-style edit rewrote the whole JSON string.
+  bool benchmarkProjectStore()
+  {
+    printf("\n=== Project store ===\n");
+    const int legacyCount = 20;
+    JsonDocument seed;
+    JsonArray list = seed.to<JsonArray>();
+    for (int i = 0; i < legacyCount; i++)
+    {
+      char name[32], color[8], id[24];
+      snprintf(name, sizeof(name), "Client project %d", i + 1);
+      snprintf(color, sizeof(color), "#%06x", (unsigned)(0x1f3a5c * (i + 1)) & 0xffffff);
+      snprintf(id, sizeof(id), "A1B2C3D4E5F6-%d", i + 1);
+      JsonObject project = list.add<JsonObject>();
+      project["name"] = name;
+      project["color"] = color;
+      project["device_project_id"] = id;
+    }
+    String json;
+    serializeJson(seed, json);
+    Preferences nvs;
+    nvs.begin("projects", false);
+    nvs.clear();
+    nvs.putString(NVS_PROJECTS_KEY, json);
+    nvs.end();
+
+    sim::resetFsStats();
+    ProjectManager migrated;
+    bool ok = migrated.begin() && migrated.count() == legacyCount;
+    size_t migrationFlash = sim::fsStats().bytesWritten;
+    ProjectCursor cursor(migrated);
+    for (int i = 0; ok && i < legacyCount; i++)
+    {
+      ok = cursor.seek(i) && cursor.current().name == list[i]["name"].as<String>() &&
+           cursor.current().color == list[i]["color"].as<String>() &&
+           cursor.current().device_project_id == list[i]["device_project_id"].as<String>();
+    }
+    nvs.begin("projects", true);
+    ok = ok && !nvs.isKey(NVS_PROJECTS_KEY);
+    nvs.end();
+
+    // Boot-time load, host time and heap per load
+    const int runs = 200;
+    std::vector<float> jsonMicros, catalogMicros;
+    size_t jsonAllocs = 0, catalogAllocs = 0;
+    for (int run = 0; run < runs; run++)
+    {
+      size_t allocs = sim::heapStats().allocations;
+      auto start = std::chrono::steady_clock::now();
+      {
+        ProjectList loaded;
+        JsonDocument doc;
+        deserializeJson(doc, json);
+        for (JsonObject obj : doc.as<JsonArray>())
+          loaded.push_back({obj["name"].as<String>(), obj["color"].as<String>(), obj["device_project_id"].as<String>()});
+      }
+      jsonMicros.push_back(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+      jsonAllocs += sim::heapStats().allocations - allocs;
+
+      allocs = sim::heapStats().allocations;
+      start = std::chrono::steady_clock::now();
+      {
+        ProjectManager loaded;
+        ok = loaded.begin() && loaded.count() == legacyCount && ok;
+      }
+      catalogMicros.push_back(std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count());
+      catalogAllocs += sim::heapStats().allocations - allocs;
+    }
+
+    // Flash per edit
+    ok = cursor.seek(7) && ok;
+    Project renamed = cursor.current();
+    renamed.name = "Renamed project";
+    renamed.color = "#00ff88";
+    sim::resetFsStats();
+    ok = migrated.updateProject(7, renamed) && ok;
+    size_t updateFlash = sim::fsStats().bytesWritten;
+    sim::resetFsStats();
+    ok = migrated.deleteProject(3) && ok;
+    size_t deleteFlash = sim::fsStats().bytesWritten;
+    JsonDocument added;
+    added["name"] = "New project";
+    added["color"] = "#112233";
+    sim::resetFsStats();
+    ok = migrated.addProject(added.as<JsonObject>()) && ok;
+    size_t addFlash = sim::fsStats().bytesWritten;
+    size_t jsonEditFlash = 32 * (1 + (json.length() + 1 + 31) / 32);
+
+    ProjectManager reloaded;
+    ProjectCursor check(reloaded);
+    ok = reloaded.begin() && reloaded.count() == legacyCount && check.seek(6) &&
+         check.current().name == "Renamed project" && check.current().color == "#00ff88" &&
+         check.seek(legacyCount - 1) && check.current().name == "New project" && ok;
+
+    printf("Migration           : %d projects, %zu bytes of JSON -> %zu bytes of catalog files\n", legacyCount, (size_t)json.length(), migrationFlash);
+    printf("Boot load (host)    : JSON p50 %.1f us, %.0f allocs; catalog p50 %.1f us, %.0f allocs\n",
+           percentile(jsonMicros, 0.5), (double)jsonAllocs / runs, percentile(catalogMicros, 0.5), (double)catalogAllocs / runs);
+    printf("Flash per edit      : JSON %zu bytes any edit; catalog update %zu, delete %zu, add %zu\n",
+           jsonEditFlash, updateFlash, deleteFlash, addFlash);
+    return ok;
+  }
+
+  // Grows a catalog to 5000 projects (about 700 KB of the 2.8 MB data
+  // partition). At each size: heap held by a freshly booted ProjectManager
+  // and by a cursor walked over every project, and the cost of finding a
+  // project by id, through the index and (the old way) by scanning the list.
+  bool benchmarkProjectCatalog()
+  {
+    printf("\n=== Project catalog ===\n");
+    Preferences nvs;
+    nvs.begin("projects", false);
+    nvs.clear();
+    nvs.end();
+    DataFS.remove(PROJECT_CATALOG_DIRECTORY_PATH);
+
+    ProjectManager manager;
+    bool ok = manager.begin() && manager.count() == 0;
+    const int sizes[] = {10, 100, 1000, 5000};
+    size_t bootHeap[4] = {}, walkHeap[4] = {};
+    JsonDocument added;
+    added["color"] = "#336699";
+    printf("Projects            : heap after boot / walking all, findById us + reads, scan us + pages\n");
+    for (int s = 0; ok && s < 4; s++)
+    {
+      while (ok && manager.count() < sizes[s])
+      {
+        added["name"] = "Client " + String(manager.count() + 1);
+        ok = manager.addProject(added.as<JsonObject>());
+      }
+
+      // A fresh boot: only the page directory and id log stay in RAM
+      size_t before = sim::heapStats().liveBytes;
+      ProjectManager *booted = new ProjectManager();
+      ok = ok && booted->begin() && booted->count() == sizes[s];
+      bootHeap[s] = sim::heapStats().liveBytes - before - sizeof(ProjectManager);
+
+      sim::resetHeapStats();
+      size_t walkBase = sim::heapStats().liveBytes;
+      {
+        ProjectCursor cursor(*booted);
+        int walked = 0;
+        for (bool more = cursor.seek(0); more; more = cursor.next())
+          walked++;
+        ok = ok && walked == sizes[s];
+      }
+      walkHeap[s] = sim::heapStats().peakLiveBytes - walkBase;
+
+      // Lookups by id spread over the whole catalog
+      const int lookups = 200;
+      ProjectCatalogStats statsBefore = booted->getCatalogStats();
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; ok && i < lookups; i++)
+      {
+        ProjectCursor probe(*booted);
+        int index = (int)((uint64_t)i * 7919 % sizes[s]);
+        String id = probe.seek(index) ? probe.current().device_project_id : String();
+        ok = booted->indexOf(booted->findById(id)) == index;
+      }
+      double findMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / lookups;
+      ProjectCatalogStats statsAfter = booted->getCatalogStats();
+      // Each lookup also seeked a probe cursor to learn the id: one page read
+      double findReads = (double)(statsAfter.indexReads - statsBefore.indexReads + statsAfter.pageReads - statsBefore.pageReads - lookups) / lookups;
+
+      const int scans = 20;
+      statsBefore = booted->getCatalogStats();
+      start = std::chrono::steady_clock::now();
+      for (int i = 0; ok && i < scans; i++)
+      {
+        String id = "missing-" + String(i); // The worst case walks everything
+        ProjectCursor cursor(*booted);
+        for (bool more = cursor.seek(0); more; more = cursor.next())
+        {
+          if (cursor.current().device_project_id == id)
+            break;
+        }
+      }
+      double scanMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / scans;
+      double scanPages = (double)(booted->getCatalogStats().pageReads - statsBefore.pageReads) / scans;
+      delete booted;
+
+      printf("  %4d              : %5zu B / %5zu B, %5.1f us + %.1f reads, %7.1f us + %.0f pages\n",
+             sizes[s], bootHeap[s], walkHeap[s], findMicros, findReads, scanMicros, scanPages);
+    }
+    // Flat: a cursor's page does not grow with the catalog; the directory adds 8 bytes per 32 projects
+    bool flat = walkHeap[3] <= walkHeap[2] + 64 && bootHeap[3] - bootHeap[0] <= (5000 / PROJECT_PAGE_SLOTS + 1) * sizeof(CatalogPage) * 2;
+    printf("Memory              : %s\n", flat ? "flat" : "GROWS");
+    ok = ok && flat;
+    printf("Cursor              : %zu bytes (one page of %d projects)\n", sizeof(ProjectCursor), PROJECT_PAGE_SLOTS);
+    return ok;
+  }
+
+  // Heap cost of entering the project selection screen (enter, first draw,
+  // exit) as the catalog grows, against copying the list with a "No Project"
+  // entry in front the way the screen used to. The first visit decodes one
+  // page into the view's cursor; later visits reuse it.
+  bool benchmarkProjectSelect()
+  {
+    printf("\n=== Project select ===\n");
+    DataFS.remove(PROJECT_CATALOG_DIRECTORY_PATH);
+    ProjectManager manager;
+    bool ok = manager.begin();
+    JsonDocument added;
+    added["color"] = "#336699";
+    const int sizes[] = {0, 20, 1000, 5000};
+    size_t firstAllocs[4] = {};
+    printf("Projects            : allocs (bytes held) copying the list / first visit / next visit\n");
+    for (int s = 0; ok && s < 4; s++)
+    {
+      while (ok && manager.count() < sizes[s])
+      {
+        added["name"] = "Client " + String(manager.count() + 1);
+        ok = manager.addProject(added.as<JsonObject>());
+      }
+      manager.setLastProjectIndex(sizes[s] / 2 - 1); // Open on a page in the middle
+
+      size_t allocs = sim::heapStats().allocations;
+      size_t live = sim::heapStats().liveBytes;
+      size_t copyAllocs, copyHeld;
+      {
+        ProjectList copy;
+        copy.push_back({"No Project", "#FF0000", ""});
+        ProjectCursor cursor(manager);
+        for (bool more = cursor.seek(0); more; more = cursor.next())
+          copy.push_back(cursor.current());
+        copyAllocs = sim::heapStats().allocations - allocs;
+        copyHeld = sim::heapStats().liveBytes - live;
+      }
+
+      ProjectSelectState select(stateMachine, displayController, ledController, inputController, manager);
+      size_t visitAllocs[2], visitHeld[2];
+      for (int visit = 0; visit < 2; visit++)
+      {
+        allocs = sim::heapStats().allocations;
+        live = sim::heapStats().liveBytes;
+        select.enter();
+        select.update();
+        visitAllocs[visit] = sim::heapStats().allocations - allocs;
+        visitHeld[visit] = sim::heapStats().liveBytes - live;
+        select.exit();
+      }
+      firstAllocs[s] = visitAllocs[0];
+      ok = ok && visitAllocs[1] == 0;
+      printf("  %4d              : %6zu (%6zu B) / %3zu (%4zu B) / %zu (%zu B)\n", sizes[s], copyAllocs, copyHeld,
+             visitAllocs[0], visitHeld[0], visitAllocs[1], visitHeld[1]);
+    }
+    // Bounded by one page, whatever the catalog size
+    ok = ok && firstAllocs[3] <= firstAllocs[2] && firstAllocs[3] <= 3 * PROJECT_PAGE_SLOTS + 8;
+    return ok;
+  }
+
+  // GET /api/projects as the web UI issues it, on the device's own catalog:
+  // heap held while the list streams out (the old handler held the list as a
+  // JsonDocument, then as a String, then as the response's copy of it), and a
+  // repeat fetch answered from the ETag.
+  bool benchmarkProjectList()
+  {
+    printf("\n=== Project list endpoint ===\n");
+    DataFS.remove(PROJECT_CATALOG_DIRECTORY_PATH);
+    bool ok = projectManager.begin() && projectManager.count() == 0;
+    JsonDocument added;
+    added["color"] = "#336699";
+    const int sizes[] = {0, 20, 1000, 5000};
+    printf("Projects            : body bytes, peak heap streaming (old: >= 2x body + document), host us; 304 bytes, peak heap\n");
+    for (int size : sizes)
+    {
+      while (ok && projectManager.count() < size)
+      {
+        added["name"] = "Client \"" + String(projectManager.count() + 1) + "\"";
+        ok = projectManager.addProject(added.as<JsonObject>());
+      }
+
+      size_t live = sim::heapStats().liveBytes;
+      sim::resetHeapStats();
+      auto start = std::chrono::steady_clock::now();
+      sim::HttpResponse full = sim::httpRequest(HTTP_GET, "/api/projects");
+      float micros = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+      size_t streamPeak = sim::heapStats().peakLiveBytes - live;
+
+      JsonDocument list;
+      ok = ok && full.code == 200 && !deserializeJson(list, full.body) && (int)list.as<JsonArray>().size() == size;
+      ok = ok && (size == 0 || list[size - 1]["name"].as<String>() == "Client \"" + String(size) + "\"");
+      String etag = full.header("ETag");
+
+      live = sim::heapStats().liveBytes;
+      sim::resetHeapStats();
+      String conditional = "If-None-Match: " + etag;
+      sim::HttpResponse cached = sim::httpRequest(HTTP_GET, "/api/projects", String(), nullptr, conditional.c_str());
+      size_t cachedPeak = sim::heapStats().peakLiveBytes - live;
+      ok = ok && !etag.isEmpty() && cached.code == 304 && cached.body.isEmpty() && cached.header("ETag") == etag;
+
+      printf("  %4d              : %7u B, %5zu B (old >= %7u B), %8.1f us; %u B, %zu B\n", size, (unsigned)full.body.length(),
+             streamPeak, 2 * (unsigned)full.body.length(), micros, (unsigned)cached.body.length(), cachedPeak);
+    }
+
+    // Any edit moves the tag; the 201 carries the new list and its tag
+    String before = sim::httpRequest(HTTP_GET, "/api/projects").header("ETag");
+    sim::HttpResponse created = sim::httpRequest(HTTP_POST, "/api/projects", "{\"name\":\"Streamed\",\"color\":\"#00ff00\"}");
+    JsonDocument afterAdd;
+    ok = ok && created.code == 201 && created.header("ETag") != before && !deserializeJson(afterAdd, created.body) &&
+         (int)afterAdd.as<JsonArray>().size() == projectManager.count();
+    String conditional = "If-None-Match: " + before;
+    ok = ok && sim::httpRequest(HTTP_GET, "/api/projects", String(), nullptr, conditional.c_str()).code == 200;
+
+    // The revision outlives a reboot, so the tag does too; a lost journal
+    // starts a new epoch, so an old tag can't match a rebuilt list
+    String lastTag = created.header("ETag");
+    ok = ok && projectManager.begin();
+    conditional = "If-None-Match: " + lastTag;
+    ok = ok && sim::httpRequest(HTTP_GET, "/api/projects", String(), nullptr, conditional.c_str()).code == 304;
+    DataFS.remove(PROJECT_JOURNAL_PATH);
+    ok = ok && projectManager.begin();
+    ok = ok && sim::httpRequest(HTTP_GET, "/api/projects", String(), nullptr, conditional.c_str()).code == 200;
+    printf("ETag                : %s\n", ok ? "moves on edits and a new journal, kept across reboots" : "BROKEN");
+    return ok;
+  }
+
+  typedef std::vector<std::pair<std::string, std::string>> WebImage; // Device path, contents
+
+  // Runs firmware/tools/build_web.py into a scratch directory and returns the
+  // files it wrote by their path in the web partition; empty if it failed
+  WebImage buildWebImage()
+  {
+    namespace stdfs = std::filesystem;
+    WebImage image;
+    char scratch[] = "/tmp/focusdial-web-XXXXXX";
+    if (mkdtemp(scratch) == nullptr)
+      return image;
+    std::string data = std::string(scratch) + "/data";
+    std::string command = "python3 \"" + projectDir + "/firmware/tools/build_web.py\" --data \"" + data + "\" > /dev/null";
+    if (system(command.c_str()) == 0)
+    {
+      for (const stdfs::directory_entry &entry : stdfs::recursive_directory_iterator(data))
+      {
+        if (!entry.is_regular_file())
+          continue;
+        std::ifstream in(entry.path(), std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        image.push_back({"/" + entry.path().lexically_relative(data).generic_string(), bytes});
+      }
+      std::sort(image.begin(), image.end());
+    }
+    std::error_code ignored;
+    stdfs::remove_all(scratch, ignored);
+    return image;
+  }
+
+  // What the web UI costs a browser, served from the files build_web.py puts
+  // in the filesystem image (it also prints a modeled load time)
+  bool checkWebAssets()
+  {
+    printf("\n=== Web UI assets ===\n");
+    WebImage image = buildWebImage();
+    const std::string *index = nullptr;
+    std::vector<std::pair<std::string, const std::string *>> assets; // URL, gzipped body
+    for (const auto &file : image)
+    {
+      if (file.first == "/index.html.gz")
+        index = &file.second;
+      else if (file.first.rfind("/assets/", 0) == 0)
+        assets.push_back({file.first.substr(0, file.first.size() - 3), &file.second});
+    }
+    if (index == nullptr || assets.size() != 2)
+    {
+      printf("build_web.py        : FAILED (run from the project directory, or pass --project-dir)\n");
+      return false;
+    }
+
+    // Uploading the UI (uploadfs) replaces the web partition; the catalog on
+    // the data partition is left as it was
+    size_t catalogBytes = DataFS.open(PROJECT_CATALOG_DIRECTORY_PATH, "r").size();
+    bool kept = LittleFS.format() && catalogBytes > 0 && DataFS.open(PROJECT_CATALOG_DIRECTORY_PATH, "r").size() == catalogBytes;
+    for (const auto &file : image)
+    {
+      File out = LittleFS.open(file.first.c_str(), "w");
+      out.write((const uint8_t *)file.second.data(), file.second.size());
+      out.close();
+    }
+
+    sim::HttpResponse page = sim::httpRequest(HTTP_GET, "/");
+    String etag = page.header("ETag");
+    bool ok = page.code == 200 && page.contentType == "text/html" && page.header("Content-Encoding") == "gzip" &&
+              page.header("Cache-Control") == "no-cache" && !etag.isEmpty() && std::string(page.body.c_str(), page.body.length()) == *index;
+    sim::HttpResponse app, style;
+    bool immutable = true;
+    for (const auto &asset : assets)
+    {
+      sim::HttpResponse response = sim::httpRequest(HTTP_GET, asset.first.c_str());
+      immutable = immutable && response.code == 200 && response.header("Content-Encoding") == "gzip" &&
+                  response.header("Cache-Control").indexOf("immutable") >= 0 &&
+                  std::string(response.body.c_str(), response.body.length()) == *asset.second;
+      (asset.first.find(".js") != std::string::npos ? app : style) = response;
+    }
+    ok = ok && immutable && app.contentType == "application/javascript" && style.contentType == "text/css";
+
+    // A repeat visit only revalidates the page; the assets come from the cache
+    String conditional = "If-None-Match: " + etag;
+    sim::HttpResponse repeat = sim::httpRequest(HTTP_GET, "/", String(), nullptr, conditional.c_str());
+    ok = ok && repeat.code == 304 && repeat.body.isEmpty() && repeat.header("ETag") == etag;
+
+    // Only the page and its assets are served, not the rest of the filesystem
+    bool hidden = sim::httpRequest(HTTP_GET, PROJECT_CATALOG_DIRECTORY_PATH).code == 404 &&
+                    sim::httpRequest(HTTP_GET, WEBHOOK_OUTBOX_PATH).code == 404;
+    ok = ok && hidden && kept;
+
+    printf("First visit         : %u B (page %u, app %u, style %u), all gzip; assets %s\n",
+           (unsigned)(page.body.length() + app.body.length() + style.body.length()), (unsigned)page.body.length(),
+           (unsigned)app.body.length(), (unsigned)style.body.length(), immutable ? "immutable" : "NOT immutable");
+    printf("Repeat visit        : %u B, page %d\n", (unsigned)repeat.body.length(), repeat.code);
+    printf("Catalog and outbox  : %s, %s by uploadfs\n", hidden ? "not served" : "SERVED", kept ? "kept" : "LOST");
+    return ok;
+  }
+
+  // Syncs the project list the way the time tracker would: all of it once,
+  // then only what changed since the revision it saw last
+  bool benchmarkProjectSync()
+  {
+    printf("\n=== Project sync ===\n");
+    JsonDocument doc;
+    sim::HttpResponse first = sim::httpRequest(HTTP_GET, "/api/projects?since=0");
+    bool ok = first.code == 200 && !deserializeJson(doc, first.body) && doc["full"].as<bool>() &&
+              (int)doc["projects"].as<JsonArray>().size() == projectManager.count() && doc["deleted"].as<JsonArray>().size() == 0;
+    uint32_t revision = doc["revision"].as<uint32_t>();
+    String journal = doc["journal"].as<String>();
+    int listed = projectManager.count();
+
+    // Two added (one renamed after), one edited, one deleted
+    JsonDocument added;
+    added["color"] = "#123456";
+    added["name"] = "Synced A";
+    ok = ok && projectManager.addProject(added.as<JsonObject>());
+    added["name"] = "Synced B";
+    ok = ok && projectManager.addProject(added.as<JsonObject>());
+    Project edit;
+    edit.name = "Renamed";
+    edit.color = "#654321";
+    ok = ok && projectManager.updateProject(projectManager.count() - 1, edit) && projectManager.updateProject(0, edit);
+    ProjectCursor cursor(projectManager);
+    String goneId = cursor.seek(1) ? cursor.current().device_project_id : String();
+    ok = ok && projectManager.deleteProject(1);
+
+    String url = "/api/projects?since=" + String(revision) + "&journal=" + journal;
+    sim::HttpResponse delta = sim::httpRequest(HTTP_GET, url.c_str());
+    ok = ok && delta.code == 200 && !deserializeJson(doc, delta.body) && !doc["full"].as<bool>() &&
+         doc["revision"].as<uint32_t>() == revision + 5 && doc["projects"].as<JsonArray>().size() == 3 && doc["deleted"].as<JsonArray>().size() == 1 &&
+         doc["deleted"].as<JsonArray>()[0].as<String>() == goneId && doc["projects"].as<JsonArray>()[1]["name"].as<String>() == "Renamed";
+    revision = doc["revision"].as<uint32_t>();
+    printf("Full list           : %u B for %d projects\n", (unsigned)first.body.length(), listed);
+    printf("Delta               : %u B for 3 changed, 1 deleted (of 5 edits)\n", (unsigned)delta.body.length());
+
+    // Nothing changed, across a reboot too
+    ok = ok && projectManager.begin();
+    url = "/api/projects?since=" + String(revision) + "&journal=" + journal;
+    sim::HttpResponse idle = sim::httpRequest(HTTP_GET, url.c_str());
+    ok = ok && idle.code == 200 && !deserializeJson(doc, idle.body) && !doc["full"].as<bool>() &&
+         doc["revision"].as<uint32_t>() == revision && doc["projects"].as<JsonArray>().size() == 0 && doc["deleted"].as<JsonArray>().size() == 0;
+    printf("No changes          : %u B, after a reboot\n", (unsigned)idle.body.length());
+
+    // Another journal's revision, or one the journal has dropped, gets the whole list
+    sim::HttpResponse foreign = sim::httpRequest(HTTP_GET, ("/api/projects?since=" + String(revision) + "&journal=0").c_str());
+    ok = ok && !deserializeJson(doc, foreign.body) && doc["full"].as<bool>();
+    for (int i = 0; ok && i < PROJECT_JOURNAL_MAX_ENTRIES; i++)
+    {
+      edit.name = "Edit " + String(i);
+      ok = projectManager.updateProject(0, edit);
+    }
+    url = "/api/projects?since=" + String(revision) + "&journal=" + journal;
+    sim::HttpResponse stale = sim::httpRequest(HTTP_GET, url.c_str());
+    ok = ok && !deserializeJson(doc, stale.body) && doc["full"].as<bool>() && (int)doc["projects"].as<JsonArray>().size() == projectManager.count();
+    url = "/api/projects?since=" + String(doc["revision"].as<uint32_t>() - 10) + "&journal=" + journal;
+    sim::HttpResponse recent = sim::httpRequest(HTTP_GET, url.c_str());
+    ok = ok && !deserializeJson(doc, recent.body) && !doc["full"].as<bool>() && doc["projects"].as<JsonArray>().size() == 1;
+    size_t journalBytes = DataFS.open(PROJECT_JOURNAL_PATH, "r").size();
+    printf("Journal             : %zu B on flash after %d more edits; older revisions get the full list\n",
+           journalBytes, PROJECT_JOURNAL_MAX_ENTRIES);
+
+    // A delete while the whole list streams shifts every project after it
+    // down an index: the response must be cut off, not sent without the
+    // project that moved into the place the stream had reached
+    int listedBefore = projectManager.count();
+    bool removed = false;
+    sim::setChunkHook([&]()
+                      {
+                        if (!removed)
+                        {
+                          removed = projectManager.deleteProject(0);
+                        } });
+    sim::HttpResponse moving = sim::httpRequest(HTTP_GET, "/api/projects?since=0");
+    sim::setChunkHook(nullptr);
+    sim::HttpResponse retried = sim::httpRequest(HTTP_GET, "/api/projects?since=0");
+    ok = ok && removed && moving.closed && !moving.body.endsWith("]}") && !retried.closed &&
+         !deserializeJson(doc, retried.body) && (int)doc["projects"].as<JsonArray>().size() == listedBefore - 1;
+    printf("Delete mid-list     : %s after %u B, then %d projects\n", moving.closed ? "aborted" : "NOT aborted",
+           (unsigned)moving.body.length(), (int)doc["projects"].as<JsonArray>().size());
+
+    ok = ok && sim::httpRequest(HTTP_GET, "/api/projects?since=abc").code == 400;
+    printf("Sync                : %s\n", ok ? "deltas match the edits" : "BROKEN");
+    return ok;
+  }
+
+  // A color picker drag from the web UI while the device sleeps: the web
+  // server's task must not block or allocate, and the loop shows only the
+  // newest color
+  bool checkColorPreviews()
+  {
+    printf("\n=== Color preview ===\n");
+    stateMachine.changeState(&StateMachine::sleepState);
+    sim::runForMs(100);
+    uint32_t client = sim::wsConnect("/ws");
+    const int drag = 100;
+    std::vector<String> messages;
+    char message[24];
+    for (int i = 0; i < drag; i++)
+    {
+      snprintf(message, sizeof(message), "preview-color:#%02x%02x%02x", i, 255 - i, 128);
+      messages.push_back(message);
+    }
+    // The last color as the ring shows it, scaled to LED_BRIGHTNESS the way NeoPixelRmt does
+    auto dim = [](uint32_t level)
+    { return level * (LED_BRIGHTNESS + 1) >> 8; };
+    uint32_t last = dim(drag - 1) << 16 | dim(256 - drag) << 8 | dim(128);
+
+    uint32_t posted = networkController.getColorPreviewsPosted();
+    uint32_t dropped = networkController.getColorPreviewsDropped();
+    size_t allocations = sim::heapStats().allocations;
+    uint64_t start = sim::nowMicros();
+    for (const String &m : messages)
+      sim::wsSend("/ws", client, m);
+    uint64_t blocked = sim::nowMicros() - start;
+    allocations = sim::heapStats().allocations - allocations;
+    posted = networkController.getColorPreviewsPosted() - posted;
+    dropped = networkController.getColorPreviewsDropped() - dropped;
+
+    sim::runForMs(50);
+    uint32_t colors[NUM_LEDS];
+    size_t leds = sim::rmtLastFrame(NEOPIXEL_RMT_CHANNEL, colors, NUM_LEDS);
+    bool shown = stateMachine.getCurrentState() == &StateMachine::idleState && ledController.isInPreviewMode() &&
+                 leds == NUM_LEDS && colors[0] == last && colors[NUM_LEDS - 1] == last;
+
+    sim::wsSend("/ws", client, "reset-color:");
+    sim::wsSend("/ws", client, "bogus");
+    sim::runForMs(50);
+    bool reset = !ledController.isInPreviewMode();
+    sim::wsDisconnect("/ws", client);
+
+    printf("Drag                : %d previews, %zu allocs and %llu us on the web task\n", drag, allocations, (unsigned long long)blocked);
+    printf("Mailbox             : %u posted, %u superseded; woke from sleep and showed the last: %s\n",
+           posted, dropped, shown ? "yes" : "NO");
+    printf("Reset               : %s\n", reset ? "restored" : "STUCK IN PREVIEW");
+    return allocations == 0 && blocked == 0 && posted == (uint32_t)drag && dropped == (uint32_t)drag - 1 && shown && reset;
+  }
+
+  // The web UI following a timer over the WebSocket: one client reads every
+  // frame as it is sent, one never reads at all. Frames must go out on each
+  // transition and at most once a second while the timer runs, and the
+  // stuck client must be closed before its queue grows past a few frames.
+  bool checkTimerFrames()
+  {
+    printf("\n=== Timer state frames ===\n");
+    stateMachine.changeState(&StateMachine::idleState);
+    sim::runForMs(100);
+
+    struct Frame
+    {
+      uint64_t atMs;
+      char state[16];
+      uint32_t elapsed;
+      size_t bytes;
+    };
+    std::vector<Frame> frames;
+    uint32_t sentBefore = networkController.getStateFramesSent();
+    uint32_t droppedBefore = networkController.getWebSocketClientsDropped();
+    uint32_t fast = sim::wsConnect("/ws");
+    uint32_t slow = sim::wsConnect("/ws");
+    bool parsed = true;
+    auto drain = [&]()
+    {
+      for (const String &text : sim::wsReceive("/ws", fast))
+      {
+        Frame frame = {sim::nowMicros() / 1000, "", 0, (size_t)text.length()};
+        const char *elapsed = strstr(text.c_str(), ",\"elapsed\":");
+        parsed = parsed && sscanf(text.c_str(), "{\"state\":\"%15[^\"]\"", frame.state) == 1 && elapsed;
+        frame.elapsed = elapsed ? strtoul(elapsed + 11, nullptr, 10) : 0;
+        frames.push_back(frame);
+      }
+    };
+    auto run = [&](uint64_t ms, State *until = nullptr)
+    {
+      uint64_t end = sim::nowMicros() + ms * 1000ULL;
+      while (sim::nowMicros() < end && stateMachine.getCurrentState() != until)
+      {
+        sim::step();
+        drain();
+      }
+      return stateMachine.getCurrentState() == until;
+    };
+    auto press = [&]()
+    {
+      sim::setPin(BUTTON_PIN, LOW);
+      run(80);
+      sim::setPin(BUTTON_PIN, HIGH);
+      run(400);
+    };
+
+    // A one-minute countdown, paused for a few seconds halfway
+    run(500);
+    StateMachine::timerState.setTimer(1, 0);
+    stateMachine.setPendingProjectId("sim-project");
+    stateMachine.changeState(&StateMachine::timerState);
+    uint64_t timerStart = sim::nowMicros() / 1000;
+    run(30000);
+    press(); // Pause
+    run(5000);
+    press(); // Resume
+    bool done = run(40000, &StateMachine::doneState);
+    run(1000);
+    uint64_t timerEnd = sim::nowMicros() / 1000;
+
+    // Every state in order, and the ticks between consecutive Timer frames.
+    // Received times include the pass's bus time and sleep, so the spacing is
+    // checked by elapsed second: exactly one frame for each.
+    std::vector<String> states;
+    uint64_t minTickGap = UINT64_MAX;
+    uint64_t maxTickGap = 0;
+    uint32_t timerFrames = 0;
+    bool everySecond = true;
+    size_t bytes = 0;
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+      bytes += frames[i].bytes;
+      if (states.empty() || states.back() != frames[i].state)
+        states.push_back(frames[i].state);
+      if (strcmp(frames[i].state, "Timer") != 0)
+        continue;
+      timerFrames++;
+      if (i > 0 && strcmp(frames[i - 1].state, "Timer") == 0)
+      {
+        minTickGap = std::min(minTickGap, frames[i].atMs - frames[i - 1].atMs);
+        maxTickGap = std::max(maxTickGap, frames[i].atMs - frames[i - 1].atMs);
+        everySecond = everySecond && frames[i].elapsed == frames[i - 1].elapsed + 1;
+      }
+    }
+    String sequence;
+    for (const String &state : states)
+      sequence += (sequence.isEmpty() ? "" : " > ") + state;
+    bool transitions = sequence == "Idle > Timer > Paused > Timer > Done";
+
+    bool slowClosed = !sim::wsIsConnected("/ws", slow);
+    uint32_t dropped = networkController.getWebSocketClientsDropped() - droppedBefore;
+    uint32_t sent = networkController.getStateFramesSent() - sentBefore;
+    double seconds = (timerEnd - timerStart) / 1000.0;
+    sim::wsDisconnect("/ws", fast);
+
+    printf("Frames              : %u sent, %zu received over %.1f s (%.2f/s), %zu bytes avg\n",
+           sent, frames.size(), seconds, frames.size() / seconds, frames.empty() ? (size_t)0 : bytes / frames.size());
+    printf("States              : %s\n", sequence.c_str());
+    printf("Timer ticks         : %u frames, one per elapsed second: %s; received %llu-%llu ms apart\n",
+           timerFrames, everySecond ? "yes" : "NO", (unsigned long long)minTickGap, (unsigned long long)maxTickGap);
+    printf("Stuck client        : %s after %d queued; %u dropped\n",
+           slowClosed ? "closed" : "STILL OPEN", WS_MAX_QUEUED_MESSAGES, dropped);
+    return parsed && done && transitions && everySecond && timerFrames >= 55 &&
+           slowClosed && dropped == 1 && sent == frames.size();
+  }
+
+  // The big timer digits blitted from the prerendered atlas against printing
+  // them in Org_01 at text size 5, as every screen with a time did: every
+  // MM:SS value at both baselines must come out pixel for pixel the same,
+  // and the host time per frame's digits is compared.
+  bool benchmarkLargeDigits()
+  {
+    printf("\n=== Large digits ===\n");
+    Adafruit_SSD1306 printed(OLED_WIDTH, OLED_HEIGHT, &Wire, -1);
+    Adafruit_SSD1306 blitted(OLED_WIDTH, OLED_HEIGHT, &Wire, -1);
+    {
+      sim::HeapAccountingPause pause;
+      printed.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+      blitted.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+    }
+    const size_t bufferBytes = OLED_WIDTH * OLED_HEIGHT / 8;
+
+    // The two groups of one frame, placed the way drawTimerScreen() places them
+    struct Frame
+    {
+      char left[3];
+      char right[3];
+      int16_t xLeft;
+      int16_t xRight;
+      int16_t baseline;
+    };
+    std::vector<Frame> frames;
+    const int16_t baselines[] = {36, 40};
+    for (int16_t baseline : baselines)
+    {
+      for (int t = 0; t < 6000; t++)
+      {
+        Frame frame;
+        snprintf(frame.left, sizeof(frame.left), "%02d", t / 60);
+        snprintf(frame.right, sizeof(frame.right), "%02d", t % 60);
+        frame.xLeft = frame.left[0] == '1' ? 21 : 1;
+        frame.xRight = frame.right[0] == '1' ? 93 : 73;
+        frame.baseline = baseline;
+        frames.push_back(frame);
+      }
+    }
+
+    auto print = [&](const Frame &frame)
+    {
+      printed.setTextColor(1);
+      printed.setTextSize(5);
+      printed.setFont(&Org_01);
+      printed.setCursor(frame.xLeft, frame.baseline);
+      printed.print(frame.left);
+      printed.setCursor(frame.xRight, frame.baseline);
+      printed.print(frame.right);
+    };
+    auto blit = [&](const Frame &frame)
+    {
+      return DisplayController::blitLargeDigits(blitted, frame.left, frame.xLeft, frame.baseline) &&
+             DisplayController::blitLargeDigits(blitted, frame.right, frame.xRight, frame.baseline);
+    };
+
+    size_t mismatches = 0;
+    bool blitAll = true;
+    for (const Frame &frame : frames)
+    {
+      printed.clearDisplay();
+      blitted.clearDisplay();
+      print(frame);
+      blitAll = blit(frame) && blitAll;
+      if (memcmp(printed.getBuffer(), blitted.getBuffer(), bufferBytes) != 0)
+        mismatches++;
+    }
+
+    // Best of a few passes over every frame, digits only (no clear, no flush)
+    const int passes = 5;
+    double printMicros = 1e9;
+    double blitMicros = 1e9;
+    for (int pass = 0; pass < passes; pass++)
+    {
+      auto start = std::chrono::steady_clock::now();
+      for (const Frame &frame : frames)
+        print(frame);
+      auto middle = std::chrono::steady_clock::now();
+      for (const Frame &frame : frames)
+        blit(frame);
+      auto end = std::chrono::steady_clock::now();
+      printMicros = std::min(printMicros, std::chrono::duration<double, std::micro>(middle - start).count() / frames.size());
+      blitMicros = std::min(blitMicros, std::chrono::duration<double, std::micro>(end - middle).count() / frames.size());
+    }
+
+    printf("Pixel check         : %zu frames (MM:SS at y=36 and y=40), %zu differ from print()\n", frames.size(), mismatches);
+    printf("Digits per frame    : print() %.2f us, atlas blit %.3f us (%.0fx), atlas %d bytes of flash\n",
+           printMicros, blitMicros, blitMicros > 0 ? printMicros / blitMicros : 0.0, DIGIT_ATLAS_SHIFTS * DIGIT_ATLAS_BYTES);
+    return blitAll && mismatches == 0;
+  }
+
+  // Every packed animation played through Animation, looping three times
+  // each way: after every frame the framebuffer, drawn from changed rows
+  // only, must equal the frame redrawn in full on a cleared buffer, as each
+  // frame used to be. Reports flash against the raw 288-byte frames, the
+  // rows a frame actually changes, and the host time to decode a frame.
+  bool benchmarkAnimations()
+  {
+    printf("\n=== Packed animations ===\n");
+    BufferedSSD1306 played(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, OLED_I2C_CLOCK); // No flush task: presents block
+    Adafruit_SSD1306 redrawn(OLED_WIDTH, OLED_HEIGHT, &Wire, -1);
+    {
+      sim::HeapAccountingPause pause;
+      redrawn.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+      played.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR); // Last, so it gets the windowed updates
+    }
+    const size_t bufferBytes = OLED_WIDTH * OLED_HEIGHT / 8;
+
+    struct Entry
+    {
+      const char *name;
+      const PackedAnimation *frames;
+    };
+    const Entry entries[] = {{"tick", &animation_tick}, {"cancel", &animation_cancel}, {"reset", &animation_reset}, {"wifi", &animation_wifi}, {"timer_start", &animation_timer_start}, {"resume", &animation_resume}};
+    const int laps = 3;
+
+    size_t mismatches = 0;
+    size_t rawBytes = 0;
+    size_t packedBytes = 0;
+    uint64_t steps = 0;
+    uint64_t rowsChanged = 0;
+    uint64_t rowsTotal = 0;
+    uint32_t unchanged = 0;
+    uint32_t flushesBefore = Adafruit_SSD1306::simStats().flushes + Adafruit_SSD1306::simStats().windows;
+    printf("%-12s %6s %6s %6s %10s\n", "Animation", "Frames", "Raw B", "Packed", "Rows/frame");
+    for (const Entry &entry : entries)
+    {
+      const PackedAnimation &frames = *entry.frames;
+      int count = frames.frameCount;
+      size_t packed = pgm_read_word(&frames.deltas[count + 1]) + (count + 2) * sizeof(uint16_t);
+      rawBytes += count * frames.width / 8 * frames.height;
+      packedBytes += packed;
+      uint64_t entryRows = 0;
+
+      for (int reverse = 0; reverse < 2; reverse++)
+      {
+        Animation animation(&played);
+        AnimationDecoder reference;
+        reference.begin(&frames);
+        if (reverse)
+          reference.last();
+        int16_t x = (OLED_WIDTH - frames.width) / 2;
+        int16_t y = (OLED_HEIGHT - frames.height) / 2;
+        int expected = reverse ? count - 1 : 0;
+
+        // Flushes take virtual bus time too, so the duration only has to outlast the laps
+        animation.start(frames, true, reverse, 60000);
+        for (int i = 0; i < laps * count; i++)
+        {
+          redrawn.clearDisplay();
+          redrawn.drawBitmap(x, y, reference.row(0), frames.width, frames.height, 1);
+          if (reference.frame() != expected || memcmp(played.getBuffer(), redrawn.getBuffer(), bufferBytes) != 0)
+            mismatches++;
+
+          sim::advanceMicros(DEFAULT_FRAME_DELAY * 1000);
+          animation.update();
+          if (reverse)
+            reference.previous();
+          else
+            reference.next();
+          expected = reverse ? (expected + count - 1) % count : (expected + 1) % count;
+          int rows = __builtin_popcountll(reference.changedRows());
+          entryRows += rows;
+          rowsTotal += frames.height;
+          unchanged += rows == 0;
+          steps++;
+        }
+        if (!animation.isRunning())
+          mismatches++;
+      }
+      rowsChanged += entryRows;
+      printf("%-12s %6d %6d %6zu %7.1f/%d\n", entry.name, count, count * frames.width / 8 * frames.height, packed,
+             (double)entryRows / (2 * laps * count), frames.height);
+    }
+
+    uint32_t flushes = Adafruit_SSD1306::simStats().flushes + Adafruit_SSD1306::simStats().windows - flushesBefore;
+
+    // Decode time alone: best of a few passes stepping every animation around once
+    double decodeMicros = 1e9;
+    for (int pass = 0; pass < 5; pass++)
+    {
+      uint64_t decoded = 0;
+      auto start = std::chrono::steady_clock::now();
+      for (const Entry &entry : entries)
+      {
+        AnimationDecoder decoder;
+        decoder.begin(entry.frames);
+        for (int i = 0; i < entry.frames->frameCount; i++, decoded++)
+          decoder.next();
+      }
+      auto end = std::chrono::steady_clock::now();
+      decodeMicros = std::min(decodeMicros, std::chrono::duration<double, std::micro>(end - start).count() / decoded);
+    }
+
+    printf("Flash               : %zu bytes raw, %zu packed (%.0f%%)\n", rawBytes, packedBytes, 100.0 * packedBytes / rawBytes);
+    printf("Rows drawn per frame: %.1f of 48 (%.0f%%) instead of clearing and redrawing all of them\n",
+           (double)rowsChanged / steps, 100.0 * rowsChanged / rowsTotal);
+    printf("Panel updates       : %u for %llu frames and %d starts; %u frames changed nothing and were not sent\n",
+           flushes, (unsigned long long)steps, 2 * (int)(sizeof(entries) / sizeof(entries[0])), unchanged);
+    printf("Pixel check         : %llu frames forward and reverse across %d laps, %zu differ from a full redraw\n",
+           (unsigned long long)steps, laps, mismatches);
+    printf("Decode per frame    : %.3f us\n", decodeMicros);
+    return mismatches == 0 && packedBytes < rawBytes;
+  }
+
+  // Partial panel updates through COLUMNADDR/PAGEADDR windows: animation
+  // frames send the pages their changed rows span within the frame's
+  // columns, and the idle screen only its WiFi corner when that is all that
+  // blinked. Each is compared with the full display() it replaces, and after
+  // every update the panel must match the framebuffer.
+  bool benchmarkDisplayWindows()
+  {
+    printf("\n=== Display windows ===\n");
+    const size_t bufferBytes = OLED_WIDTH * OLED_HEIGHT / 8;
+    struct Cost
+    {
+      uint64_t bytes = 0;
+      uint64_t micros = 0; // Virtual, so the bus time of the update
+      uint32_t updates = 0;
+      uint32_t sent = 0; // Updates that put anything on the bus
+      uint64_t maxBytes = 0;
+    };
+    size_t mismatches = 0;
+    auto measure = [&](Cost &cost, Adafruit_SSD1306 &oled, const std::function<void()> &update)
+    {
+      uint64_t bytesBefore = Adafruit_SSD1306::simStats().bytesOnBus;
+      unsigned long start = micros();
+      update();
+      uint64_t bytes = Adafruit_SSD1306::simStats().bytesOnBus - bytesBefore;
+      cost.bytes += bytes;
+      cost.micros += micros() - start;
+      cost.updates++;
+      cost.sent += bytes > 0;
+      cost.maxBytes = std::max(cost.maxBytes, bytes);
+      if (memcmp(oled.panel(), oled.getBuffer(), bufferBytes) != 0)
+        mismatches++;
+    };
+
+    Cost full;
+    Cost frames;
+    uint32_t windowsBefore = Adafruit_SSD1306::simStats().windows;
+    {
+      BufferedSSD1306 oled(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, OLED_I2C_CLOCK); // No flush task: presents block
+      {
+        sim::HeapAccountingPause pause;
+        oled.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+      }
+      measure(full, oled, [&]()
+              { oled.display(); });
+
+      const PackedAnimation *animations[] = {&animation_tick, &animation_cancel, &animation_reset, &animation_wifi, &animation_timer_start, &animation_resume};
+      for (const PackedAnimation *packed : animations)
+      {
+        for (int reverse = 0; reverse < 2; reverse++)
+        {
+          Animation animation(&oled);
+          animation.start(*packed, false, reverse, 60000);
+          for (int i = 1; i < packed->frameCount; i++)
+          {
+            sim::advanceMicros(DEFAULT_FRAME_DELAY * 1000);
+            measure(frames, oled, [&]()
+                    { animation.update(); });
+          }
+        }
+      }
+    }
+    uint32_t windows = Adafruit_SSD1306::simStats().windows - windowsBefore;
+
+    // The idle screen while WiFi is down, its icon blinking every 500 ms, then
+    // back up. DisplayController hands its frames to the flush task, so each
+    // update runs until the task has sent it.
+    Cost blinks;
+    {
+      DisplayController display(OLED_WIDTH, OLED_HEIGHT, OLED_ADDR);
+      {
+        sim::HeapAccountingPause pause;
+        display.begin();
+      }
+      BufferedSSD1306 &oled = static_cast<BufferedSSD1306 &>(*Adafruit_SSD1306::simAttached());
+      display.drawIdleScreen(25, false);
+      sim::settleFlush(oled);
+      for (int i = 0; i < 20; i++)
+      {
+        sim::advanceMicros(500000);
+        measure(blinks, oled, [&]()
+                {
+                  display.drawIdleScreen(25, i == 19);
+                  sim::settleFlush(oled); });
+      }
+    }
+
+    auto average = [](uint64_t total, uint32_t count)
+    { return count ? (double)total / count : 0.0; };
+    printf("Full display()      : %llu bytes, %.2f ms on the bus\n", (unsigned long long)full.bytes, full.micros / 1000.0);
+    printf("Animation frames    : %u, %u sent as %u windows: %.0f bytes (max %llu), %.2f ms per frame sent, was %llu bytes, %.2f ms\n",
+           frames.updates, frames.sent, windows, average(frames.bytes, frames.sent), (unsigned long long)frames.maxBytes,
+           average(frames.micros, frames.sent) / 1000.0, (unsigned long long)full.bytes, full.micros / 1000.0);
+    printf("Idle WiFi blinks    : %u: %.0f bytes, %.2f ms each, was %llu bytes, %.2f ms\n",
+           blinks.updates, average(blinks.bytes, blinks.updates), average(blinks.micros, blinks.updates) / 1000.0,
+           (unsigned long long)full.bytes, full.micros / 1000.0);
+    printf("Panel check         : %u updates, %zu left the panel different from the framebuffer\n",
+           full.updates + frames.updates + blinks.updates, mismatches);
+    return mismatches == 0 && frames.maxBytes < full.bytes && blinks.maxBytes < full.bytes && blinks.sent == blinks.updates;
+  }
+
+  // Panel updates handed to the flush task against sent from the loop. For
+  // every animation frame and for full-screen redraws, the virtual time
+  // present() holds the loop, and the task's flush times at 400 kHz and at
+  // 1 MHz. (test_flush_task covers frames faster than the bus and a panel
+  // that stops answering.)
+  bool benchmarkFlushTask()
+  {
+    printf("\n=== Display flush task ===\n");
+    const size_t bufferBytes = OLED_WIDTH * OLED_HEIGHT / 8;
+    struct Run
+    {
+      uint64_t blockedMicros = 0; // In present(), virtual
+      uint32_t maxBlockedMicros = 0;
+      uint64_t fullMicros = 0; // Flushes of whole frames: bus time, in the loop or the task
+      uint32_t fulls = 0;
+      size_t mismatches = 0;
+      OledFlushStats flush = {};
+    };
+
+    // Each animation once each way, then a full redraw a second
+    auto play = [&](uint32_t clock, bool buffered, Run &run)
+    {
+      BufferedSSD1306 oled(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, clock);
+      {
+        sim::HeapAccountingPause pause;
+        oled.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR);
+        if (buffered && !oled.startFlushTask())
+          run.mismatches++;
+      }
+      auto timed = [&](const std::function<void()> &update)
+      {
+        uint64_t start = sim::nowMicros();
+        update();
+        uint32_t blocked = sim::nowMicros() - start;
+        run.blockedMicros += blocked;
+        run.maxBlockedMicros = std::max(run.maxBlockedMicros, blocked);
+      };
+
+      const PackedAnimation *animations[] = {&animation_tick, &animation_cancel, &animation_reset, &animation_wifi, &animation_timer_start, &animation_resume};
+      for (const PackedAnimation *packed : animations)
+      {
+        for (int reverse = 0; reverse < 2; reverse++)
+        {
+          Animation animation(&oled);
+          timed([&]()
+                { animation.start(*packed, false, reverse, 60000); });
+          for (int i = 1; i < packed->frameCount; i++)
+          {
+            sim::advanceMicros(DEFAULT_FRAME_DELAY * 1000);
+            oled.service();
+            timed([&]()
+                  { animation.update(); });
+          }
+          sim::settleFlush(oled);
+          if (memcmp(oled.panel(), oled.getBuffer(), bufferBytes) != 0)
+            run.mismatches++;
+        }
+      }
+
+      for (int i = 0; i < 20; i++)
+      {
+        oled.clearDisplay();
+        oled.fillRect(i * 6, 0, 8, OLED_HEIGHT, SSD1306_WHITE);
+        uint64_t start = sim::nowMicros();
+        timed([&]()
+              { oled.present(); });
+        sim::settleFlush(oled);
+        run.fullMicros += sim::nowMicros() - start;
+        run.fulls++;
+        if (memcmp(oled.panel(), oled.getBuffer(), bufferBytes) != 0)
+          run.mismatches++;
+        sim::advanceMicros(1000000);
+      }
+      run.flush = oled.getFlushStats();
+    };
+
+    Run blocking;
+    Run tasked;
+    Run fastPlus;
+    play(OLED_I2C_CLOCK, false, blocking);
+    play(OLED_I2C_CLOCK, true, tasked);
+    play(1000000, true, fastPlus);
+
+    auto average = [](uint64_t total, uint32_t count)
+    { return count ? (double)total / count : 0.0; };
+    printf("Loop in present()   : from the loop avg %.2f ms max %.2f ms; with the task avg %.3f ms max %.3f ms (%u presents)\n",
+           average(blocking.blockedMicros, blocking.flush.presented) / 1000.0, blocking.maxBlockedMicros / 1000.0,
+           average(tasked.blockedMicros, tasked.flush.presented) / 1000.0, tasked.maxBlockedMicros / 1000.0, tasked.flush.presented);
+    printf("Full frame on bus   : display() %.2f ms; task at 400 kHz %.2f ms, at 1 MHz %.2f ms\n",
+           average(blocking.fullMicros, blocking.fulls) / 1000.0, average(tasked.fullMicros, tasked.fulls) / 1000.0,
+           average(fastPlus.fullMicros, fastPlus.fulls) / 1000.0);
+    printf("Task flushes        : 400 kHz avg %.2f ms max %.2f ms, 1 MHz avg %.2f ms max %.2f ms; %u found busy, %u errors\n",
+           average(tasked.flush.flushMicrosTotal, tasked.flush.flushes) / 1000.0, tasked.flush.flushMicrosMax / 1000.0,
+           average(fastPlus.flush.flushMicrosTotal, fastPlus.flush.flushes) / 1000.0, fastPlus.flush.flushMicrosMax / 1000.0,
+           tasked.flush.foundBusy + fastPlus.flush.foundBusy, tasked.flush.errors + fastPlus.flush.errors);
+    printf("Panel check         : %zu frames left the panel different from the framebuffer\n",
+           blocking.mismatches + tasked.mismatches + fastPlus.mismatches);
+
+    bool panels = blocking.mismatches + tasked.mismatches + fastPlus.mismatches == 0;
+    bool unblocked = tasked.maxBlockedMicros * 10 < blocking.maxBlockedMicros;
+    bool faster = fastPlus.flush.flushMicrosTotal < tasked.flush.flushMicrosTotal;
+    return panels && unblocked && faster && tasked.flush.errors == 0 && fastPlus.flush.errors == 0;
+  }
+
+  void printReport(int minutes)
+  {
+    const Adafruit_SSD1306::Stats &oled = Adafruit_SSD1306::simStats();
+    sim::RmtStats rmt = sim::rmtStats();
+    sim::HeapStats heap = sim::heapStats();
+    sim::NvsStats nvs = sim::nvsStats();
+    SchedulerStats sched = scheduler.getStats();
+    uint64_t idleMicros = sched.idleMicros - schedulerAtStart.idleMicros;
+    uint64_t busyMicros = sched.busyMicros - schedulerAtStart.busyMicros;
+    uint32_t timedWakeups = sched.timedWakeups - schedulerAtStart.timedWakeups;
+    uint32_t eventWakeups = sched.eventWakeups - schedulerAtStart.eventWakeups;
+    uint64_t jitterTotal = sched.jitterTotalUs - schedulerAtStart.jitterTotalUs;
+    double seconds = profile.virtualMicros / 1e6;
+    size_t loops = profile.wallMicros.size();
+
+    double wallTotal = 0;
+    for (float us : profile.wallMicros)
+      wallTotal += us;
+
+    printf("\n=== Focus Dial simulation: %d min timer ===\n", minutes);
+    printf("Virtual time        : %.1f s\n", seconds);
+    printf("Host time           : %.1f ms\n", wallTotal / 1000.0);
+    printf("loop() calls        : %zu (%.1f/s)\n", loops, loops / seconds);
+    printf("loop() host cost    : p50 %.2f us, p99 %.2f us, max %.2f us\n",
+           percentile(profile.wallMicros, 0.50), percentile(profile.wallMicros, 0.99), percentile(profile.wallMicros, 1.0));
+    printf("Heap                : %zu allocs, %zu frees, %zu bytes, %.1f allocs/loop, peak live %zu\n",
+           heap.allocations, heap.frees, heap.bytesAllocated, loops ? (double)heap.allocations / loops : 0.0, heap.peakLiveBytes);
+    printf("OLED                : %u flushes (%.1f/s), %u windows, %u clears, %llu bytes on bus, %.1f%% of time on bus\n",
+           oled.flushes, oled.flushes / seconds, oled.windows, oled.clears, (unsigned long long)oled.bytesOnBus, 100.0 * oled.busMicros / profile.virtualMicros);
+    OledFlushStats flush = displayController.getFlushStats();
+    uint32_t flushes = flush.flushes - flushAtStart.flushes;
+    printf("OLED flush task     : %u presented, %u flushes avg %.2f ms (max %.2f ms since boot), %u found the bus busy, %u dropped, %u errors\n",
+           flush.presented - flushAtStart.presented, flushes,
+           flushes ? (flush.flushMicrosTotal - flushAtStart.flushMicrosTotal) / 1000.0 / flushes : 0.0, flush.flushMicrosMax / 1000.0,
+           flush.foundBusy - flushAtStart.foundBusy, flush.dropped - flushAtStart.dropped, flush.errors - flushAtStart.errors);
+    printf("Frames              : %u rendered, %u skipped as unchanged\n",
+           displayController.getFramesRendered() - framesRenderedAtStart, displayController.getFramesSkipped() - framesSkippedAtStart);
+    printf("LED frames          : %u shown (%.1f/s), %u identical skipped, %u RMT writes, %.2f%% of time on the wire (CPU free)\n",
+           ledController.getFramesShown() - ledFramesShownAtStart, (ledController.getFramesShown() - ledFramesShownAtStart) / seconds,
+           ledController.getFramesSkipped() - ledFramesSkippedAtStart, rmt.writes, 100.0 * rmt.wireMicros / profile.virtualMicros);
+    printf("LED ring vs timer   : %u checks after %llu ms stalls, worst %d LED(s) off\n",
+           ringCheck.checks, (unsigned long long)RING_STALL_MS, ringCheck.maxError);
+    printf("NVS                 : %zu opens, %zu writes, %zu bytes written\n", nvs.opens, nvs.writes, nvs.bytesWritten);
+    printf("Scheduler           : %.2f%% idle, %u timed / %u event wake-ups, jitter avg %llu us max %u us\n",
+           (idleMicros + busyMicros) ? 100.0 * idleMicros / (idleMicros + busyMicros) : 0.0, timedWakeups, eventWakeups,
+           (unsigned long long)(timedWakeups ? jitterTotal / timedWakeups : 0), sched.jitterMaxUs);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  int minutes = MAX_TIMER;
+  bool verbose = false;
+
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "--minutes") == 0 && i + 1 < argc)
+      minutes = atoi(argv[++i]);
+    else if (strcmp(argv[i], "--step-us") == 0 && i + 1 < argc)
+      sim::setLoopCost(strtoull(argv[++i], nullptr, 10));
+    else if (strcmp(argv[i], "--project-dir") == 0 && i + 1 < argc)
+      projectDir = argv[++i];
+    else if (strcmp(argv[i], "--verbose") == 0)
+      verbose = true;
+  }
+  sim::setSerialEcho(verbose);
+
+  // A provisioned device with the requested default duration
+  if (!sim::bootDevice(minutes))
+  {
+    printf("Simulation failed: never reached Idle\n");
+    return 1;
+  }
+
+  sim::resetHeapStats();
+  sim::resetNvsStats();
+  Adafruit_SSD1306::resetSimStats();
+  sim::resetRmtStats();
+  framesRenderedAtStart = displayController.getFramesRendered();
+  framesSkippedAtStart = displayController.getFramesSkipped();
+  schedulerAtStart = scheduler.getStats();
+  ledFramesShownAtStart = ledController.getFramesShown();
+  ledFramesSkippedAtStart = ledController.getFramesSkipped();
+  flushAtStart = displayController.getFlushStats();
+  metrics.reset();
+  sim::setLoopObserver(profileLoop);
+
+  sim::runForMs(2000); // Idle screen
+  sim::click();        // -> Project select
+  if (!sim::runUntil(&StateMachine::projectSelectState, 1000))
+  {
+    printf("Simulation failed: never reached Project Select\n");
+    return 1;
+  }
+  sim::runForMs(1000);
+  sim::click(); // -> Timer
+  if (!sim::runUntil(&StateMachine::timerState, 1000))
+  {
+    printf("Simulation failed: never reached Timer\n");
+    return 1;
+  }
+
+  // Stall the loop once a minute; the ring must still match the countdown
+  uint64_t timerStart = sim::nowMicros();
+  for (int minute = 1; minute < minutes; minute++)
+  {
+    sim::runForMs(timerStart / 1000 + minute * 60000ULL - RING_STALL_MS - sim::nowMicros() / 1000);
+    sim::advanceMicros(RING_STALL_MS * 1000);
+    sim::step();
+    checkRing(timerStart, minutes);
+  }
+  if (!sim::runUntil(&StateMachine::doneState, 2 * 60 * 1000))
+  {
+    printf("Simulation failed: timer did not finish\n");
+    return 1;
+  }
+  sim::runForMs(2000); // Done screen
+
+  sim::setLoopObserver(nullptr);
+  printReport(minutes);
+  if (ringCheck.maxError > 1)
+  {
+    printf("Simulation failed: LED ring fell behind the countdown\n");
+    return 1;
+  }
+
+  // The same histograms the firmware dumps on 'm' and serves on /api/metrics
+  sim::setSerialEcho(true);
+  sim::serialInput("m");
+  sim::step();
+  sim::setSerialEcho(verbose);
+  sim::HttpResponse metricsResponse = sim::httpRequest(HTTP_GET, "/api/metrics");
+  printf("GET /api/metrics   : %d, %zu bytes\n", metricsResponse.code, (size_t)metricsResponse.body.length());
+  if (metricsResponse.code != 200)
+  {
+    printf("Simulation failed: /api/metrics did not answer\n");
+    return 1;
+  }
+
+  // The benchmarks start from Idle
+  if (!sim::runUntil(&StateMachine::idleState, (CHANGE_TIMEOUT + 5) * 1000))
+  {
+    printf("Simulation failed: never returned to Idle\n");
+    return 1;
+  }
+  if (!benchmarkWebhookConnection())
+  {
+    printf("Simulation failed: webhook connection was not reused\n");
+    return 1;
+  }
+  if (!benchmarkProjectStore())
+  {
+    printf("Simulation failed: project store did not round-trip\n");
+    return 1;
+  }
+  if (!benchmarkProjectCatalog())
+  {
+    printf("Simulation failed: project catalog lookups or memory grew with its size\n");
+    return 1;
+  }
+  if (!benchmarkProjectSelect())
+  {
+    printf("Simulation failed: entering project select allocated per project or per visit\n");
+    return 1;
+  }
+  if (!benchmarkProjectList())
+  {
+    printf("Simulation failed: /api/projects did not stream the list or honor its ETag\n");
+    return 1;
+  }
+  if (!checkWebAssets())
+  {
+    printf("Simulation failed: web UI was not served precompressed and cached\n");
+    return 1;
+  }
+  if (!benchmarkProjectSync())
+  {
+    printf("Simulation failed: /api/projects?since= did not return the changes\n");
+    return 1;
+  }
+  if (!checkColorPreviews())
+  {
+    printf("Simulation failed: color previews blocked the web task or showed a stale color\n");
+    return 1;
+  }
+  if (!checkTimerFrames())
+  {
+    printf("Simulation failed: timer state frames were missed, too frequent or queued for a stuck client\n");
+    return 1;
+  }
+  if (!benchmarkLargeDigits())
+  {
+    printf("Simulation failed: blitted digits differ from printed ones\n");
+    return 1;
+  }
+  if (!benchmarkAnimations())
+  {
+    printf("Simulation failed: packed animation frames differ from full redraws\n");
+    return 1;
+  }
+  if (!benchmarkDisplayWindows())
+  {
+    printf("Simulation failed: windowed updates left the panel stale or sent as much as display()\n");
+    return 1;
+  }
+  if (!benchmarkFlushTask())
+  {
+    printf("Simulation failed: the flush task blocked the loop or left the panel stale\n");
+    return 1;
+  }
+  return 0;
+}
+
+#endif // PIO_UNIT_TESTING
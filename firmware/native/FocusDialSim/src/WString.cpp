@@ -0,0 +1,161 @@
+#include "WString.h"
+
+#include <algorithm>
+#include <ctype.h>
+#include <stdio.h>
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base)
+{
+  if (base < 2 || base > 36)
+  {
+    base = 10;
+  }
+  char buf[72];
+  int pos = sizeof(buf) - 1;
+  buf[pos] = '\0';
+  do
+  {
+    int digit = value % base;
+    buf[--pos] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value != 0);
+  if (negative)
+  {
+    buf[--pos] = '-';
+  }
+  return std::string(&buf[pos]);
+}
+
+String::String(int value, unsigned char base)
+    : _s(base == 10 ? formatInteger(value < 0 ? -(long long)value : value, value < 0, base)
+                    : formatInteger((unsigned int)value, false, base)) {}
+
+String::String(unsigned int value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+
+String::String(long value, unsigned char base)
+    : _s(base == 10 ? formatInteger(value < 0 ? -(long long)value : value, value < 0, base)
+                    : formatInteger((unsigned long)value, false, base)) {}
+
+String::String(unsigned long value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces)
+{
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+  _s = buf;
+}
+
+int String::indexOf(char c, unsigned int fromIndex) const
+{
+  size_t pos = _s.find(c, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String &s, unsigned int fromIndex) const
+{
+  size_t pos = _s.find(s._s, fromIndex);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const
+{
+  size_t pos = _s.rfind(c);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int beginIndex) const
+{
+  return substring(beginIndex, length());
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+  if (beginIndex > endIndex)
+  {
+    std::swap(beginIndex, endIndex);
+  }
+  if (beginIndex >= _s.size())
+  {
+    return String();
+  }
+  if (endIndex > _s.size())
+  {
+    endIndex = _s.size();
+  }
+  return String(_s.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::replace(const String &find, const String &replacement)
+{
+  if (find._s.empty())
+  {
+    return;
+  }
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos)
+  {
+    _s.replace(pos, find._s.size(), replacement._s);
+    pos += replacement._s.size();
+  }
+}
+
+void String::toLowerCase()
+{
+  for (auto &c : _s)
+  {
+    c = tolower((unsigned char)c);
+  }
+}
+
+void String::toUpperCase()
+{
+  for (auto &c : _s)
+  {
+    c = toupper((unsigned char)c);
+  }
+}
+
+void String::trim()
+{
+  size_t begin = 0;
+  while (begin < _s.size() && isspace((unsigned char)_s[begin]))
+  {
+    begin++;
+  }
+  size_t end = _s.size();
+  while (end > begin && isspace((unsigned char)_s[end - 1]))
+  {
+    end--;
+  }
+  _s = _s.substr(begin, end - begin);
+}
+
+String operator+(const String &lhs, const String &rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+String operator+(const String &lhs, const char *rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+String operator+(const char *lhs, const String &rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
+
+String operator+(const String &lhs, char rhs)
+{
+  String result(lhs);
+  result.concat(rhs);
+  return result;
+}
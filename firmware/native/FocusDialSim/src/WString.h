@@ -0,0 +1,126 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <ctype.h>
+#include <string>
+
+// Host replacement for the Arduino String class, backed by std::string.
+// Only the subset of the API used by the firmware is provided.
+class String
+{
+public:
+  String() {}
+  String(const char *cstr) : _s(cstr ? cstr : "") {}
+  String(const char *cstr, unsigned int length) : _s(cstr ? std::string(cstr, length) : std::string()) {}
+  String(const std::string &s) : _s(s) {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimalPlaces = 2);
+  explicit String(double value, unsigned int decimalPlaces = 2);
+
+  unsigned int length() const { return (unsigned int)_s.size(); }
+  bool isEmpty() const { return _s.empty(); }
+  const char *c_str() const { return _s.c_str(); }
+  bool reserve(unsigned int size)
+  {
+    _s.reserve(size);
+    return true;
+  }
+
+  // Arduino Strings are "true" when their buffer is valid, which is always
+  explicit operator bool() const { return true; }
+
+  char operator[](unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+  char &operator[](unsigned int index) { return _s[index]; }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+
+  bool concat(const String &s)
+  {
+    _s += s._s;
+    return true;
+  }
+  bool concat(const char *cstr)
+  {
+    if (cstr)
+      _s += cstr;
+    return cstr != nullptr;
+  }
+  bool concat(const char *cstr, unsigned int length)
+  {
+    if (cstr)
+      _s.append(cstr, length);
+    return cstr != nullptr;
+  }
+  bool concat(char c)
+  {
+    _s += c;
+    return true;
+  }
+
+  String &operator+=(const String &rhs)
+  {
+    concat(rhs);
+    return *this;
+  }
+  String &operator+=(const char *rhs)
+  {
+    concat(rhs);
+    return *this;
+  }
+  String &operator+=(char rhs)
+  {
+    concat(rhs);
+    return *this;
+  }
+
+  bool equals(const String &s) const { return _s == s._s; }
+  bool equals(const char *cstr) const { return _s == (cstr ? cstr : ""); }
+  bool equalsIgnoreCase(const String &s) const
+  {
+    return _s.size() == s._s.size() &&
+           std::equal(_s.begin(), _s.end(), s._s.begin(), [](char a, char b)
+                      { return tolower((unsigned char)a) == tolower((unsigned char)b); });
+  }
+  bool operator==(const String &rhs) const { return equals(rhs); }
+  bool operator==(const char *rhs) const { return equals(rhs); }
+  bool operator!=(const String &rhs) const { return !equals(rhs); }
+  bool operator!=(const char *rhs) const { return !equals(rhs); }
+  bool operator<(const String &rhs) const { return _s < rhs._s; }
+
+  bool startsWith(const String &prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+  bool endsWith(const String &suffix) const
+  {
+    return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+  }
+
+  int indexOf(char c, unsigned int fromIndex = 0) const;
+  int indexOf(const String &s, unsigned int fromIndex = 0) const;
+  int lastIndexOf(char c) const;
+  String substring(unsigned int beginIndex) const;
+  String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+  void replace(const String &find, const String &replacement);
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+  long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_s.c_str(), nullptr); }
+
+private:
+  std::string _s;
+};
+
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+
+// Flash-string helper; on the host every string already lives in RAM
+class __FlashStringHelper;
+#define F(string_literal) (string_literal)
@@ -0,0 +1,244 @@
+#include "WiFi.h"
+#include "WiFiClientSecure.h"
+#include "HTTPClient.h"
+#include "ESPmDNS.h"
+
+WiFiClass WiFi;
+MDNSResponder MDNS;
+
+namespace
+{
+  sim::HttpResponder responder;
+  sim::HttpStats httpCounters;
+  std::vector<std::pair<String, String>> responseHeaders;
+  uint32_t connectionEpoch = 1;
+}
+
+// --- WiFiClass ---
+
+int WiFiClass::onEvent(WiFiEventCb cb, arduino_event_id_t event)
+{
+  (void)event;
+  if (_callbackCount >= sizeof(_callbacks) / sizeof(_callbacks[0]))
+    return -1;
+  _callbacks[_callbackCount] = cb;
+  return _callbackCount++;
+}
+
+const char *WiFiClass::eventName(arduino_event_id_t id)
+{
+  switch (id)
+  {
+  case ARDUINO_EVENT_WIFI_READY:
+    return "WIFI_READY";
+  case ARDUINO_EVENT_WIFI_STA_START:
+    return "STA_START";
+  case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+    return "STA_CONNECTED";
+  case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    return "STA_DISCONNECTED";
+  case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+    return "STA_GOT_IP";
+  default:
+    return "UNKNOWN";
+  }
+}
+
+void WiFiClass::simSetConnected(bool connected)
+{
+  if (_connected == connected)
+    return;
+
+  _connected = connected;
+  arduino_event_id_t event = connected ? ARDUINO_EVENT_WIFI_STA_GOT_IP : ARDUINO_EVENT_WIFI_STA_DISCONNECTED;
+  for (uint8_t i = 0; i < _callbackCount; i++)
+    _callbacks[i](event);
+}
+
+namespace sim
+{
+  void setWiFiConnected(bool connected)
+  {
+    WiFi.simSetConnected(connected);
+  }
+
+  void setHttpResponder(HttpResponder r)
+  {
+    HeapAccountingPause pause;
+    responder = r;
+  }
+
+  void setHttpResponseHeader(const String &name, const String &value)
+  {
+    HeapAccountingPause pause;
+    for (auto it = responseHeaders.begin(); it != responseHeaders.end(); ++it)
+    {
+      if (it->first.equalsIgnoreCase(name))
+      {
+        responseHeaders.erase(it);
+        break;
+      }
+    }
+    if (!value.isEmpty())
+      responseHeaders.push_back({name, value});
+  }
+
+  HttpStats httpStats()
+  {
+    return httpCounters;
+  }
+
+  void resetHttpStats()
+  {
+    httpCounters = HttpStats();
+  }
+
+  void closeHttpConnections()
+  {
+    connectionEpoch++;
+  }
+}
+
+// --- Clients ---
+
+int WiFiClient::connect(const char *host, uint16_t port)
+{
+  (void)host;
+  (void)port;
+  _connected = WiFi.status() == WL_CONNECTED;
+  if (_connected)
+  {
+    httpCounters.tcpConnects++;
+    _epoch = connectionEpoch;
+    sim::advanceMicros(sim::HTTP_TCP_CONNECT_US);
+  }
+  return _connected;
+}
+
+uint8_t WiFiClient::connected()
+{
+  if (_connected && (_epoch != connectionEpoch || WiFi.status() != WL_CONNECTED))
+    _connected = false; // The peer's FIN has arrived
+  return _connected;
+}
+
+int WiFiClientSecure::connect(const char *host, uint16_t port)
+{
+  if (!WiFiClient::connect(host, port))
+    return 0;
+  httpCounters.tlsHandshakes++;
+  sim::advanceMicros(sim::HTTP_TLS_HANDSHAKE_US);
+  return 1;
+}
+
+// --- HTTPClient ---
+
+bool HTTPClient::begin(WiFiClient &client, const String &url)
+{
+  _client = &client;
+  _url = url;
+  _headers = String();
+  _response = String();
+  return url.startsWith("http://") || url.startsWith("https://");
+}
+
+bool HTTPClient::begin(const String &url)
+{
+  _client = nullptr;
+  _url = url;
+  _headers = String();
+  _response = String();
+  return url.startsWith("http://") || url.startsWith("https://");
+}
+
+void HTTPClient::end()
+{
+  if (_client && !_reuse)
+    _client->stop();
+  _headers = String();
+}
+
+void HTTPClient::addHeader(const String &name, const String &value)
+{
+  _headers += name;
+  _headers += ": ";
+  _headers += value;
+  _headers += '\n';
+}
+
+void HTTPClient::collectHeaders(const char *headerKeys[], size_t headerKeysCount)
+{
+  _collected.assign(headerKeys, headerKeys + headerKeysCount);
+}
+
+String HTTPClient::header(const char *name) const
+{
+  bool collected = false;
+  for (const String &key : _collected)
+    collected |= key.equalsIgnoreCase(name);
+  if (!collected)
+    return String();
+  for (const auto &entry : responseHeaders)
+    if (entry.first.equalsIgnoreCase(name))
+      return entry.second;
+  return String();
+}
+
+int HTTPClient::GET()
+{
+  return _send("GET", String());
+}
+
+int HTTPClient::POST(const String &payload)
+{
+  return _send("POST", payload);
+}
+
+int HTTPClient::POST(const uint8_t *payload, size_t size)
+{
+  return _send("POST", String((const char *)payload, size));
+}
+
+int HTTPClient::_send(const char *method, const String &payload)
+{
+  httpCounters.requests++;
+  _response = String();
+
+  if (WiFi.status() != WL_CONNECTED || !responder)
+  {
+    httpCounters.failures++;
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  if (_client && !_client->connected())
+  {
+    // "https://host[:port]/..." -> host and port, as HTTPClient::begin() parses them
+    int hostStart = _url.indexOf("://") + 3;
+    int hostEnd = hostStart;
+    while (hostEnd < (int)_url.length() && _url[hostEnd] != '/' && _url[hostEnd] != ':')
+      hostEnd++;
+    String host = _url.substring(hostStart, hostEnd);
+    uint16_t port = _url.startsWith("https://") ? 443 : 80;
+    if (hostEnd < (int)_url.length() && _url[hostEnd] == ':')
+      port = atoi(_url.c_str() + hostEnd + 1);
+    if (!_client->connect(host.c_str(), port))
+    {
+      httpCounters.failures++;
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+  }
+  sim::advanceMicros(sim::HTTP_REQUEST_US);
+
+  sim::HttpExchange exchange;
+  exchange.method = method;
+  exchange.url = _url;
+  exchange.headers = _headers;
+  exchange.body = payload;
+
+  int code = responder(exchange, _response);
+  if (code < 0)
+    httpCounters.failures++;
+  if (_client && !_reuse)
+    _client->stop();
+  return code;
+}
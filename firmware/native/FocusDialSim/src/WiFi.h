@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include <functional>
+
+typedef enum
+{
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum
+{
+  ARDUINO_EVENT_WIFI_READY = 0,
+  ARDUINO_EVENT_WIFI_STA_START,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP,
+  ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef arduino_event_id_t WiFiEvent_t;
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+
+// Host stand-in for the ESP32 WiFi station. The link only comes up when the
+// harness calls sim::setWiFiConnected(true), which also fires the events.
+class WiFiClass
+{
+public:
+  wl_status_t status() const { return _connected ? WL_CONNECTED : WL_DISCONNECTED; }
+  wl_status_t begin() { return status(); }
+  bool disconnect() { return true; }
+  IPAddress localIP() const { return _connected ? IPAddress(192, 168, 1, 50) : IPAddress(); }
+  int8_t RSSI() const { return _connected ? -55 : 0; }
+  int onEvent(WiFiEventCb cb, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+  static const char *eventName(arduino_event_id_t id);
+
+  void simSetConnected(bool connected);
+
+private:
+  bool _connected;
+  WiFiEventCb _callbacks[4];
+  uint8_t _callbackCount;
+};
+
+extern WiFiClass WiFi;
+
+namespace sim
+{
+  void setWiFiConnected(bool connected);
+}
+
+// --- TCP client ---
+
+// Connecting charges a modelled TCP round trip to the virtual clock. The
+// connection stays up until stop(), WiFi drops or the "server" closes it
+// with sim::closeHttpConnections().
+class WiFiClient : public Stream
+{
+public:
+  virtual ~WiFiClient() {}
+  virtual int connect(const char *host, uint16_t port);
+  virtual void stop() { _connected = false; }
+  virtual uint8_t connected();
+  size_t write(uint8_t c) override { return connected() ? 1 : 0; }
+  size_t write(const uint8_t *buf, size_t size) override { return connected() ? size : 0; }
+  using Print::write;
+  void setTimeout(uint32_t ms) { (void)ms; }
+
+protected:
+  bool _connected = false;
+  uint32_t _epoch = 0; // Connection generation it was opened in
+};
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Arduino.h>
+
+namespace WiFiProvisioner
+{
+  // Host stand-in for the captive-portal provisioner. The simulator treats
+  // the device as already provisioned, so the portal never starts.
+  class WiFiProvisioner
+  {
+  public:
+    typedef bool (*InputCheckCallback)(const String &);
+    typedef void (*FactoryResetCallback)();
+
+    const char *AP_NAME = "";
+    const char *SVG_LOGO = "";
+    const char *HTML_TITLE = "";
+    const char *PROJECT_TITLE = "";
+    const char *PROJECT_INFO = "";
+    const char *FOOTER_INFO = "";
+    const char *CONNECTION_SUCCESSFUL = "";
+    const char *RESET_CONFIRMATION_TEXT = "";
+    const char *INPUT_TEXT = "";
+    const char *INPUT_PLACEHOLDER = "";
+    const char *INPUT_INVALID_LENGTH = "";
+    const char *INPUT_NOT_VALID = "";
+
+    void enableSerialDebug(bool enable) { (void)enable; }
+    void setShowInputField(bool show) { (void)show; }
+    void setInputCheckCallback(InputCheckCallback callback) { _inputCheck = callback; }
+    void setFactoryResetCallback(FactoryResetCallback callback) { _factoryReset = callback; }
+    bool setupAccessPointAndServer()
+    {
+      Serial.println("[sim] Provisioning portal is not available in the simulator");
+      return false;
+    }
+    void resetCredentials() {}
+
+  private:
+    InputCheckCallback _inputCheck = nullptr;
+    FactoryResetCallback _factoryReset = nullptr;
+  };
+}
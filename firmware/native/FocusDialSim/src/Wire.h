@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define I2C_BUFFER_LENGTH 128 // As arduino-esp32's Wire
+#define WIRE_MAX_DEVICES 4
+
+// A device on the simulated bus; gets each transmission's bytes after the address
+class TwoWireDevice
+{
+public:
+  virtual ~TwoWireDevice() {}
+  virtual void receive(const uint8_t *data, size_t length) = 0;
+};
+
+// Host stand-in for the I2C bus. It tracks the configured clock so the
+// display shim can charge realistic transfer times to the virtual clock, and
+// hands transmissions to the device attached at their address.
+class TwoWire
+{
+public:
+  bool begin() { return true; }
+  void setClock(uint32_t frequency) { _clock = frequency; }
+  uint32_t getClock() const { return _clock ? _clock : 400000; }
+
+  void attach(uint8_t address, TwoWireDevice *device)
+  {
+    detach(device);
+    if (_deviceCount < WIRE_MAX_DEVICES)
+      _devices[_deviceCount++] = {address, device};
+  }
+  void detach(TwoWireDevice *device)
+  {
+    for (size_t i = 0; i < _deviceCount; i++)
+    {
+      if (_devices[i].device == device)
+      {
+        memmove(&_devices[i], &_devices[i + 1], (_deviceCount - i - 1) * sizeof(Attached));
+        _deviceCount--;
+        return;
+      }
+    }
+  }
+
+  void beginTransmission(uint8_t address)
+  {
+    _address = address;
+    _length = 0;
+  }
+  size_t write(uint8_t data)
+  {
+    if (_length >= I2C_BUFFER_LENGTH)
+      return 0;
+    _buffer[_length++] = data;
+    return 1;
+  }
+  size_t write(const uint8_t *data, size_t length)
+  {
+    size_t written = 0;
+    while (written < length && write(data[written]))
+      written++;
+    return written;
+  }
+  uint8_t endTransmission(bool stop = true)
+  {
+    (void)stop;
+    TwoWireDevice *device = deviceAt(_address);
+    if (device == nullptr)
+      return 2; // NACK on the address
+    device->receive(_buffer, _length);
+    return 0;
+  }
+
+  // Also how the driver/i2c.h shim reaches the bus
+  TwoWireDevice *deviceAt(uint8_t address) const
+  {
+    for (size_t i = _deviceCount; i-- > 0;)
+    {
+      if (_devices[i].address == address)
+        return _devices[i].device;
+    }
+    return nullptr;
+  }
+
+private:
+  uint32_t _clock;
+  uint8_t _address;
+  uint8_t _buffer[I2C_BUFFER_LENGTH];
+  size_t _length;
+  struct Attached
+  {
+    uint8_t address;
+    TwoWireDevice *device;
+  };
+  Attached _devices[WIRE_MAX_DEVICES]; // The last one attached at an address answers
+  size_t _deviceCount;
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,45 @@
+#pragma once
+
+// Host replacement for the ESP-IDF legacy I2C master driver, command links
+// only. i2c_master_cmd_begin() hands each start..stop transaction to the
+// TwoWireDevice attached to Wire at its address, which charges the bus time
+// at Wire's clock: from the loop that advances the virtual clock, from a
+// scheduled task (sim::runTask()) the task waits it out while the loop runs.
+// Port I2C_NUM_0 is Wire, as arduino-esp32 installs it.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_system.h>
+#include <freertos/FreeRTOS.h>
+
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_TIMEOUT 0x107
+
+typedef enum
+{
+  I2C_NUM_0,
+  I2C_NUM_1,
+  I2C_NUM_MAX
+} i2c_port_t;
+
+typedef enum
+{
+  I2C_MASTER_WRITE,
+  I2C_MASTER_READ
+} i2c_rw_t;
+
+typedef void *i2c_cmd_handle_t;
+
+// As IDF: room for the link and five commands per transaction
+#define I2C_INTERNAL_STRUCT_SIZE 24
+#define I2C_LINK_RECOMMENDED_SIZE(TRANSACTIONS) \
+  (2 * I2C_INTERNAL_STRUCT_SIZE + I2C_INTERNAL_STRUCT_SIZE * (5 * (TRANSACTIONS)))
+
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t *buffer, uint32_t size);
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_start(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t cmd, uint8_t data, bool ackEnable);
+esp_err_t i2c_master_write(i2c_cmd_handle_t cmd, const uint8_t *data, size_t length, bool ackEnable);
+esp_err_t i2c_master_stop(i2c_cmd_handle_t cmd);
+esp_err_t i2c_master_cmd_begin(i2c_port_t port, i2c_cmd_handle_t cmd, TickType_t ticksToWait);
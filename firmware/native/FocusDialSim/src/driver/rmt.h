@@ -0,0 +1,85 @@
+#pragma once
+
+// Host replacement for the ESP-IDF legacy RMT driver, transmit side only.
+//
+// rmt_write_items() does not block, like the real peripheral: it records the
+// frame and marks the channel busy until the items would have been clocked
+// out on the virtual clock. Nothing is charged to the CPU.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_system.h>
+
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_TIMEOUT 0x107
+
+typedef int gpio_num_t;
+
+typedef enum
+{
+  RMT_CHANNEL_0,
+  RMT_CHANNEL_1,
+  RMT_CHANNEL_2,
+  RMT_CHANNEL_3,
+  RMT_CHANNEL_4,
+  RMT_CHANNEL_5,
+  RMT_CHANNEL_6,
+  RMT_CHANNEL_7,
+  RMT_CHANNEL_MAX
+} rmt_channel_t;
+
+typedef enum
+{
+  RMT_MODE_TX,
+  RMT_MODE_RX
+} rmt_mode_t;
+
+typedef struct
+{
+  union
+  {
+    struct
+    {
+      uint32_t duration0 : 15;
+      uint32_t level0 : 1;
+      uint32_t duration1 : 15;
+      uint32_t level1 : 1;
+    };
+    uint32_t val;
+  };
+} rmt_item32_t;
+
+typedef struct
+{
+  rmt_mode_t rmt_mode;
+  rmt_channel_t channel;
+  gpio_num_t gpio_num;
+  uint8_t clk_div;
+  uint8_t mem_block_num;
+  uint32_t flags;
+} rmt_config_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id) \
+  {                                             \
+    RMT_MODE_TX, channel_id, gpio, 80, 1, 0     \
+  }
+
+esp_err_t rmt_config(const rmt_config_t *config);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBufferSize, int interruptFlags);
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *items, int itemCount, bool waitTxDone);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, uint32_t waitTicks);
+
+namespace sim
+{
+  struct RmtStats
+  {
+    uint32_t writes;     // Frames handed to the peripheral
+    uint32_t items;      // Bits sent
+    uint64_t wireMicros; // Time the line was busy (not CPU time)
+  };
+  RmtStats rmtStats();
+  void resetRmtStats();
+
+  // Decode the last frame sent on a channel as WS2812 GRB bytes into 0x00RRGGBB
+  size_t rmtLastFrame(rmt_channel_t channel, uint32_t *colors, size_t maxLeds);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+// Fixed, recognisable MAC so device project IDs are reproducible in the simulator
+esp_err_t esp_efuse_mac_get_default(uint8_t *mac);
+
+uint32_t esp_get_free_heap_size();
+
+uint32_t esp_random();
+
+class EspClass
+{
+public:
+  void restart();
+  uint32_t getFreeHeap() { return esp_get_free_heap_size(); }
+  uint32_t getCycleCount(); // Virtual plus host time at 240 MHz: modelled bus time and real CPU cost
+  uint32_t getCpuFreqMHz() { return 240; }
+};
+
+extern EspClass ESP;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Flash and RAM share one address space on the host
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr) (*(void *const *)(addr))
+#define pgm_read_pointer(addr) ((void *)pgm_read_ptr(addr))
+
+#define memcpy_P memcpy
+#define strlen_P strlen
@@ -1,19 +1,25 @@
 #include "Animation.h"
+#include "Metrics.h"
 
-Animation::Animation(Adafruit_SSD1306* display) : oled(display), animationRunning(false), playInReverse(false) {}
+Animation::Animation(BufferedSSD1306* display) : oled(display), animationRunning(false), playInReverse(false) {}
 
-void Animation::start(const byte* frames, int frameCount, bool loop, bool reverse, unsigned long durationMs, int width, int height) {
-    animationFrames = frames;
-    totalFrames = frameCount;
+void Animation::start(const PackedAnimation& frames, bool loop, bool reverse, unsigned long durationMs) {
+    if (!decoder.begin(&frames)) {
+        animationRunning = false;
+        return;
+    }
+    totalFrames = frames.frameCount;
     loopAnimation = loop;
     playInReverse = reverse; // Set reverse playback flag
     animationRunning = true;
 
     // Initialize current frame correctly based on direction
-    currentFrame = playInReverse ? totalFrames - 1 : 0;
+    if (playInReverse) {
+        decoder.last();
+    }
 
-    frameWidth = width;
-    frameHeight = height;
+    frameWidth = frames.width;
+    frameHeight = frames.height;
     frameDelay = DEFAULT_FRAME_DELAY;
 
     if (durationMs == 0) {
@@ -28,9 +34,10 @@ void Animation::start(const byte* frames, int frameCount, bool loop, bool revers
     frameX = (oled->width() - frameWidth) / 2;
     frameY = (oled->height() - frameHeight) / 2;
 
+    // Rows the first frame leaves blank are already clear
     oled->clearDisplay();
-    oled->drawBitmap(frameX, frameY, &animationFrames[currentFrame * 288], frameWidth, frameHeight, 1);
-    oled->display();
+    drawChangedRows();
+    flush();
 }
 
 void Animation::update() {
@@ -47,36 +54,57 @@ void Animation::update() {
     if (currentTime - lastFrameTime >= frameDelay) {
         lastFrameTime = currentTime;
 
-        // Adjust current frame based on direction
+        // Adjust current frame based on direction; the decoder wraps around
+        int lastFrame = playInReverse ? 0 : totalFrames - 1;
+        if (decoder.frame() == lastFrame && !loopAnimation) {
+            animationRunning = false;
+            return;
+        }
         if (playInReverse) {
-            currentFrame--;
-            if (currentFrame < 0) { 
-                if (loopAnimation) {
-                    currentFrame = totalFrames - 1; // Wrap around to last frame
-                } else {
-                    animationRunning = false;
-                    return;
-                }
-            }
+            decoder.previous();
         } else {
-            currentFrame++;
-            if (currentFrame >= totalFrames) {
-                if (loopAnimation) {
-                    currentFrame = 0; // Wrap around to first frame
-                } else {
-                    animationRunning = false;
-                    return;
-                }
-            }
+            decoder.next();
+        }
+
+        // Display the current frame: only its rows that differ from the last one,
+        // and only the band of the panel they fall in
+        uint64_t rows = decoder.changedRows();
+        if (rows != 0) {
+            drawChangedRows();
+            int first = __builtin_ctzll(rows);
+            int last = 63 - __builtin_clzll(rows);
+            flushWindow(frameY + first, last - first + 1);
         }
+    }
+}
 
-        // Display the current frame
-        oled->clearDisplay();
-        oled->drawBitmap(frameX, frameY, &animationFrames[currentFrame * 288], frameWidth, frameHeight, 1);
-        oled->display();
+void Animation::drawChangedRows() {
+    uint64_t rows = decoder.changedRows();
+    for (int y = 0; y < frameHeight; y++) {
+        if (!(rows >> y & 1)) continue;
+        const uint8_t* bits = decoder.row(y);
+        for (int x = 0; x < frameWidth; x++) {
+            oled->drawPixel(frameX + x, frameY + y, (bits[x >> 3] & (0x80 >> (x & 7))) ? 1 : 0);
+        }
     }
 }
 
+void Animation::flush() {
+    MetricScope scope(Metric::OledFlush);
+    oled->present();
+}
+
+void Animation::flushWindow(int y, int height) {
+    MetricScope scope(Metric::OledFlush);
+    oled->present(frameX, y, frameWidth, height);
+}
+
 bool Animation::isRunning() {
     return animationRunning;
 }
+
+unsigned long Animation::nextFrameTime() const {
+    unsigned long nextFrame = lastFrameTime + frameDelay;
+    unsigned long end = animationStartTime + animationDuration;
+    return (long)(end - nextFrame) < 0 ? end : nextFrame;
+}
@@ -0,0 +1,102 @@
+#include "AnimationDecoder.h"
+
+AnimationDecoder::AnimationDecoder() : animation(nullptr), rowBytes(0), current(0), changed(0) {}
+
+bool AnimationDecoder::begin(const PackedAnimation *packed)
+{
+  if (packed->width > ANIMATION_MAX_WIDTH || packed->height > ANIMATION_MAX_HEIGHT || packed->width % 8 ||
+      packed->frameCount == 0)
+  {
+    Serial.println("AnimationDecoder: Unsupported animation size");
+    animation = nullptr;
+    return false;
+  }
+  animation = packed;
+  rowBytes = packed->width / 8;
+  first();
+  return true;
+}
+
+void AnimationDecoder::first()
+{
+  memset(pixels, 0, sizeof(pixels));
+  changed = 0;
+  apply(0);
+  current = 0;
+}
+
+void AnimationDecoder::last()
+{
+  first();
+  apply(animation->frameCount); // Keeps delta 0's rows too
+  current = animation->frameCount - 1;
+}
+
+void AnimationDecoder::next()
+{
+  changed = 0;
+  if (current == animation->frameCount - 1)
+  {
+    apply(animation->frameCount);
+    current = 0;
+  }
+  else
+  {
+    current++;
+    apply(current);
+  }
+}
+
+void AnimationDecoder::previous()
+{
+  changed = 0;
+  if (current == 0)
+  {
+    apply(animation->frameCount);
+    current = animation->frameCount - 1;
+  }
+  else
+  {
+    apply(current);
+    current--;
+  }
+}
+
+void AnimationDecoder::apply(int delta)
+{
+  const uint8_t *in = animation->data + pgm_read_word(&animation->deltas[delta]);
+  uint64_t mask = 0;
+  for (int i = 0; i < (animation->height + 7) / 8; i++)
+  {
+    mask |= (uint64_t)pgm_read_byte(in++) << (i * 8);
+  }
+  changed |= mask;
+
+  // One PackBits stream runs across all the changed rows
+  int run = 0;
+  bool literal = false;
+  uint8_t value = 0;
+  for (int y = 0; y < animation->height; y++)
+  {
+    if (!(mask >> y & 1))
+    {
+      continue;
+    }
+    uint8_t *out = pixels + y * rowBytes;
+    for (int x = 0; x < rowBytes; x++)
+    {
+      if (run == 0)
+      {
+        uint8_t control = pgm_read_byte(in++);
+        literal = control < 0x80;
+        run = literal ? control + 1 : control - 0x80 + 2;
+        if (!literal)
+        {
+          value = pgm_read_byte(in++);
+        }
+      }
+      out[x] ^= literal ? pgm_read_byte(in++) : value;
+      run--;
+    }
+  }
+}
@@ -0,0 +1,13 @@
+#include "DataFS.h"
+
+fs::LittleFSFS DataFS;
+
+bool mountDataFS()
+{
+  if (!DataFS.begin(true, DATA_FS_BASE_PATH, 10, DATA_FS_PARTITION_LABEL))
+  {
+    Serial.println("DataFS: Failed to mount the data partition!");
+    return false;
+  }
+  return true;
+}
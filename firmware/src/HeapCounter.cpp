@@ -0,0 +1,52 @@
+#include "Metrics.h"
+
+// Counts only in the adafruit_qtpy_esp32_diag env (platformio.ini), which
+// defines FOCUS_DIAL_HEAP_COUNTER and links with
+// -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc, so every call site, the core
+// and prebuilt libraries included, lands here first. Heap calls can come from
+// ISRs and with the flash cache disabled, hence IRAM and an atomic add. Other
+// builds report 0. The native simulator counts through its own heap accounting
+// instead and leaves this file out.
+
+#ifdef FOCUS_DIAL_HEAP_COUNTER
+
+static volatile uint32_t allocationCount = 0;
+
+extern "C"
+{
+  void *__real_malloc(size_t size);
+  void *__real_calloc(size_t count, size_t size);
+  void *__real_realloc(void *ptr, size_t size);
+
+  void *IRAM_ATTR __wrap_malloc(size_t size)
+  {
+    __atomic_fetch_add(&allocationCount, 1, __ATOMIC_RELAXED);
+    return __real_malloc(size);
+  }
+
+  void *IRAM_ATTR __wrap_calloc(size_t count, size_t size)
+  {
+    __atomic_fetch_add(&allocationCount, 1, __ATOMIC_RELAXED);
+    return __real_calloc(count, size);
+  }
+
+  void *IRAM_ATTR __wrap_realloc(void *ptr, size_t size)
+  {
+    __atomic_fetch_add(&allocationCount, 1, __ATOMIC_RELAXED);
+    return __real_realloc(ptr, size);
+  }
+}
+
+uint32_t heapAllocationCount()
+{
+  return allocationCount;
+}
+
+#else
+
+uint32_t heapAllocationCount()
+{
+  return 0;
+}
+
+#endif
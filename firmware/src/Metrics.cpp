@@ -0,0 +1,191 @@
+#include "Metrics.h"
+
+// Global metrics instance
+Metrics metrics;
+
+// --- LatencyHistogram ---
+
+LatencyHistogram::LatencyHistogram()
+{
+  reset();
+}
+
+void LatencyHistogram::reset()
+{
+  memset(buckets, 0, sizeof(buckets));
+  count = 0;
+  max = 0;
+}
+
+void LatencyHistogram::record(uint32_t micros)
+{
+  buckets[bucketFor(micros)]++;
+  count++;
+  if (micros > max)
+  {
+    max = micros;
+  }
+}
+
+uint8_t LatencyHistogram::bucketFor(uint32_t micros)
+{
+  if (micros < 4)
+  {
+    return micros;
+  }
+  uint8_t msb = 31 - __builtin_clz(micros);
+  uint8_t sub = (micros >> (msb - 2)) & 3;
+  uint16_t bucket = 4 * (msb - 1) + sub;
+  return bucket < METRICS_BUCKETS ? bucket : METRICS_BUCKETS - 1;
+}
+
+uint32_t LatencyHistogram::bucketUpperBound(uint8_t bucket)
+{
+  if (bucket < 4)
+  {
+    return bucket;
+  }
+  uint8_t msb = bucket / 4 + 1;
+  uint8_t sub = bucket % 4;
+  uint32_t lower = (uint32_t)(4 + sub) << (msb - 2);
+  return lower + (1UL << (msb - 2)) - 1;
+}
+
+uint32_t LatencyHistogram::getPercentile(float fraction) const
+{
+  if (count == 0)
+  {
+    return 0;
+  }
+  uint32_t rank = (uint32_t)(fraction * (count - 1)) + 1;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < METRICS_BUCKETS; i++)
+  {
+    seen += buckets[i];
+    if (seen >= rank)
+    {
+      return min(bucketUpperBound(i), max);
+    }
+  }
+  return max;
+}
+
+// --- Metrics ---
+
+Metrics::Metrics() : cyclesPerMicro(240), stateNames{}, stateCount(0) {}
+
+void Metrics::begin()
+{
+  cyclesPerMicro = ESP.getCpuFreqMHz();
+}
+
+uint32_t Metrics::elapsedMicros(uint32_t startCycles) const
+{
+  // Unsigned subtraction copes with the counter wrapping (every ~18 s at 240 MHz)
+  return (cycles() - startCycles) / cyclesPerMicro;
+}
+
+void Metrics::record(Metric metric, uint32_t startCycles)
+{
+  controllers[(size_t)metric].record(elapsedMicros(startCycles));
+}
+
+void Metrics::recordState(const char *stateName, uint32_t startCycles)
+{
+  uint32_t micros = elapsedMicros(startCycles);
+
+  // Names are string literals, so the pointer identifies the state
+  for (uint8_t i = 0; i < stateCount; i++)
+  {
+    if (stateNames[i] == stateName)
+    {
+      states[i].record(micros);
+      return;
+    }
+  }
+  if (stateCount < METRICS_MAX_STATES)
+  {
+    stateNames[stateCount] = stateName;
+    states[stateCount++].record(micros);
+  }
+}
+
+void Metrics::reset()
+{
+  for (LatencyHistogram &histogram : controllers)
+  {
+    histogram.reset();
+  }
+  for (uint8_t i = 0; i < stateCount; i++)
+  {
+    states[i].reset();
+  }
+}
+
+const char *Metrics::metricName(Metric metric)
+{
+  switch (metric)
+  {
+  case Metric::Input:
+    return "input";
+  case Metric::Leds:
+    return "leds";
+  case Metric::LedShow:
+    return "led_show";
+  case Metric::Display:
+    return "display";
+  case Metric::OledFlush:
+    return "oled_flush";
+  case Metric::Network:
+    return "network";
+  default:
+    return "unknown";
+  }
+}
+
+void Metrics::writeHistogram(JsonObject object, const char *name, const LatencyHistogram &histogram)
+{
+  object["name"] = name;
+  object["count"] = histogram.getCount();
+  object["p50_us"] = histogram.getPercentile(0.50f);
+  object["p99_us"] = histogram.getPercentile(0.99f);
+  object["max_us"] = histogram.getMax();
+}
+
+void Metrics::writeJson(JsonObject root) const
+{
+  root["cpu_mhz"] = cyclesPerMicro;
+  root["heap_allocs"] = heapAllocationCount();
+
+  JsonArray stateArray = root["states"].to<JsonArray>();
+  for (uint8_t i = 0; i < stateCount; i++)
+  {
+    writeHistogram(stateArray.add<JsonObject>(), stateNames[i], states[i]);
+  }
+
+  JsonArray controllerArray = root["controllers"].to<JsonArray>();
+  for (size_t i = 0; i < (size_t)Metric::Count; i++)
+  {
+    writeHistogram(controllerArray.add<JsonObject>(), metricName((Metric)i), controllers[i]);
+  }
+}
+
+void Metrics::printHistogram(const char *kind, const char *name, const LatencyHistogram &histogram)
+{
+  Serial.printf("  %-10s %-14s %10u %8u %8u %8u\n", kind, name, histogram.getCount(),
+                histogram.getPercentile(0.50f), histogram.getPercentile(0.99f), histogram.getMax());
+}
+
+void Metrics::printReport() const
+{
+  Serial.println("Loop latency (us):");
+  Serial.printf("  %-10s %-14s %10s %8s %8s %8s\n", "", "", "count", "p50", "p99", "max");
+  for (uint8_t i = 0; i < stateCount; i++)
+  {
+    printHistogram("state", stateNames[i], states[i]);
+  }
+  for (size_t i = 0; i < (size_t)Metric::Count; i++)
+  {
+    printHistogram("controller", metricName((Metric)i), controllers[i]);
+  }
+}
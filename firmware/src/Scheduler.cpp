@@ -0,0 +1,129 @@
+#include "Scheduler.h"
+
+// Global scheduler instance
+Scheduler scheduler;
+
+TaskHandle_t Scheduler::loopTask = nullptr;
+
+Scheduler::Scheduler()
+    : nextDeadline(0),
+      hasDeadline(false),
+      passStartMicros(0),
+      lastReportTime(0),
+      stats{}
+{
+}
+
+void Scheduler::begin()
+{
+  loopTask = xTaskGetCurrentTaskHandle();
+  passStartMicros = micros();
+  lastReportTime = millis();
+}
+
+void Scheduler::wakeAt(unsigned long deadlineMs)
+{
+  // Wrap-safe "earlier than"
+  if (!hasDeadline || (long)(deadlineMs - nextDeadline) < 0)
+  {
+    nextDeadline = deadlineMs;
+    hasDeadline = true;
+  }
+}
+
+void Scheduler::wakeIn(unsigned long delayMs)
+{
+  wakeAt(millis() + delayMs);
+}
+
+void Scheduler::wake()
+{
+  if (loopTask != nullptr)
+  {
+    xTaskNotifyGive(loopTask);
+  }
+}
+
+void IRAM_ATTR Scheduler::wakeFromISR()
+{
+  if (loopTask != nullptr)
+  {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTask, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+  }
+}
+
+void Scheduler::sleep()
+{
+  unsigned long now = millis();
+  long waitMs = hasDeadline ? (long)(nextDeadline - now) : SCHEDULER_MAX_SLEEP_MS;
+  hasDeadline = false;
+  if (waitMs > SCHEDULER_MAX_SLEEP_MS)
+  {
+    waitMs = SCHEDULER_MAX_SLEEP_MS;
+  }
+
+  unsigned long passEndMicros = micros();
+  stats.passes++;
+  stats.busyMicros += passEndMicros - passStartMicros;
+
+  if (now - lastReportTime >= SCHEDULER_REPORT_INTERVAL_MS)
+  {
+    lastReportTime = now;
+    printStats();
+  }
+
+  // Already due (or not started yet): go straight into the next pass
+  if (waitMs <= 0 || loopTask == nullptr)
+  {
+    passStartMicros = passEndMicros;
+    return;
+  }
+
+  TickType_t ticks = pdMS_TO_TICKS(waitMs);
+  if (ticks == 0)
+  {
+    ticks = 1;
+  }
+  unsigned long targetMicros = passEndMicros + (unsigned long)waitMs * 1000UL;
+
+  uint32_t notified = ulTaskNotifyTake(pdTRUE, ticks);
+
+  unsigned long wokeMicros = micros();
+  stats.idleMicros += wokeMicros - passEndMicros;
+  passStartMicros = wokeMicros;
+
+  if (notified > 0)
+  {
+    stats.eventWakeups++;
+    return;
+  }
+
+  long jitter = (long)(wokeMicros - targetMicros);
+  uint32_t jitterUs = jitter < 0 ? -jitter : jitter;
+  stats.timedWakeups++;
+  stats.jitterTotalUs += jitterUs;
+  if (jitterUs > stats.jitterMaxUs)
+  {
+    stats.jitterMaxUs = jitterUs;
+  }
+}
+
+SchedulerStats Scheduler::getStats() const
+{
+  return stats;
+}
+
+float Scheduler::getIdlePercent() const
+{
+  uint64_t total = stats.idleMicros + stats.busyMicros;
+  return total > 0 ? 100.0f * stats.idleMicros / total : 0.0f;
+}
+
+void Scheduler::printStats()
+{
+  uint32_t jitterAvg = stats.timedWakeups > 0 ? stats.jitterTotalUs / stats.timedWakeups : 0;
+  Serial.printf("Scheduler: %.1f%% idle, %u passes, %u timed / %u event wake-ups, jitter avg %u us max %u us\n",
+                getIdlePercent(), stats.passes, stats.timedWakeups, stats.eventWakeups, jitterAvg, stats.jitterMaxUs);
+}
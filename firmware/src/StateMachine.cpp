@@ -1,4 +1,6 @@
 #include "StateMachine.h"
+#include "Scheduler.h"
+#include "Metrics.h"
 
 // Global state machine instance
 StateMachine stateMachine;
@@ -45,7 +47,9 @@ void StateMachine::update()
   // Restore original update logic (check transition flag?)
   if (!transition && currentState != nullptr)
   {
+    uint32_t start = Metrics::cycles();
     currentState->update(); // Call update on the current state
+    metrics.recordState(getStateName(currentState), start);
   }
 }
 
@@ -78,6 +82,9 @@ void StateMachine::changeState(State *newState)
     transition = false; // Clear original transition flag
 
     xSemaphoreGive(stateMutex); // Release the mutex
+
+    // The new state renders on its first update; don't wait out the old deadline
+    scheduler.wake();
   }
   else
   {
@@ -112,7 +119,7 @@ void StateMachine::setPendingProjectId(const String &projectId)
   pendingProjectId = projectId;
 }
 
-String StateMachine::getPendingProjectId() const
+const String &StateMachine::getPendingProjectId() const
 {
   return pendingProjectId;
 }
@@ -122,6 +129,33 @@ void StateMachine::clearPendingProject()
   pendingProjectId = ""; // Reset pending project ID
 }
 
+bool StateMachine::getTimerProgress(uint32_t &durationSeconds, uint32_t &elapsedSeconds) const
+{
+  if (currentState == &timerState)
+  {
+    durationSeconds = timerState.getDuration() * 60;
+    elapsedSeconds = timerState.getElapsedTime();
+  }
+  else if (currentState == &pausedState)
+  {
+    durationSeconds = pausedState.getDuration() * 60;
+    elapsedSeconds = pausedState.getElapsedTime();
+  }
+  else if (currentState == &doneState)
+  {
+    // TimerState keeps the finished timer's length; the final time was handed over
+    durationSeconds = timerState.getDuration() * 60;
+    elapsedSeconds = pendingElapsedTime;
+  }
+  else
+  {
+    durationSeconds = 0;
+    elapsedSeconds = 0;
+    return false;
+  }
+  return true;
+}
+
 // Check if the current state is IdleState
 bool StateMachine::isInIdleState() const
 {
@@ -141,4 +175,30 @@ void StateMachine::resetLEDColor()
 State *StateMachine::getCurrentState() const
 {
   return currentState;
+}
+
+// Name of one of the static states, for logs and metrics
+const char *StateMachine::getStateName(const State *state)
+{
+  if (state == &adjustState)
+    return "Adjust";
+  if (state == &sleepState)
+    return "Sleep";
+  if (state == &doneState)
+    return "Done";
+  if (state == &idleState)
+    return "Idle";
+  if (state == &pausedState)
+    return "Paused";
+  if (state == &projectSelectState)
+    return "ProjectSelect";
+  if (state == &provisionState)
+    return "Provision";
+  if (state == &resetState)
+    return "Reset";
+  if (state == &startupState)
+    return "Startup";
+  if (state == &timerState)
+    return "Timer";
+  return "Unknown";
 }
\ No newline at end of file
@@ -1,12 +1,26 @@
 #include "controllers/DisplayController.h"
+#include "Config.h"
+#include "Scheduler.h"
+#include "Metrics.h"
+#include <Wire.h>
 
 #include "fonts/Picopixel.h"
 #include "fonts/Org_01.h"
+#include "fonts/Org_01_digits.h"
 #include "bitmaps.h"
+#include "animations.h"
 #include <Fonts/FreeSansBold9pt7b.h>
 
+// The WiFi icon and label in the top right of the idle screen, all in page 0
+#define IDLE_STATUS_X 54
+#define IDLE_STATUS_Y 0
+#define IDLE_STATUS_WIDTH 21
+#define IDLE_STATUS_HEIGHT 8
+
+#define PROJECT_SELECT_MAX_DOTS 16 // Pagination dots that fit across the panel; a counter beyond
+
 DisplayController::DisplayController(uint8_t oledWidth, uint8_t oledHeight, uint8_t oledAddress)
-    : oled(oledWidth, oledHeight, &Wire, -1), animation(&oled) {}
+    : oled(oledWidth, oledHeight, &Wire, oledAddress, OLED_I2C_CLOCK), animation(&oled), lastRender{Screen::None, 0, 0, 0}, framesRendered(0), framesSkipped(0) {}
 
 void DisplayController::begin()
 {
@@ -24,12 +38,124 @@ void DisplayController::begin()
   oled.ssd1306_command(0xFF); // Use 0xFF (255) for max contrast/brightness
 
   oled.clearDisplay();
-  oled.display();
+  flush();
+  // Frames go out from here on while the loop carries on
+  if (oled.startFlushTask())
+  {
+    Serial.printf("Display flush task started, I2C at %lu kHz.\n", (unsigned long)(OLED_I2C_CLOCK / 1000));
+  }
+  invalidate();
   Serial.println("DisplayController initialized.");
 }
 
+// Returns false (and counts a skipped frame) when the panel already shows this
+// screen with these inputs; otherwise records them as the current frame
+bool DisplayController::needsRender(Screen screen, int32_t a, int32_t b, int32_t c)
+{
+  if (lastRender.screen == screen && lastRender.a == a && lastRender.b == b && lastRender.c == c)
+  {
+    framesSkipped++;
+    return false;
+  }
+
+  lastRender = {screen, a, b, c};
+  framesRendered++;
+  return true;
+}
+
+void DisplayController::flush()
+{
+  MetricScope scope(Metric::OledFlush);
+  oled.present();
+}
+
+void DisplayController::flushWindow(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  MetricScope scope(Metric::OledFlush);
+  oled.present(x, y, w, h);
+}
+
+void DisplayController::printFlushStats()
+{
+  OledFlushStats stats = oled.getFlushStats();
+  if (!oled.isBuffered())
+  {
+    Serial.printf("Display: %u frames presented, flushed synchronously\n", stats.presented);
+    return;
+  }
+  Serial.printf("Display: %u frames presented, %u flushes (avg %lu us, max %lu us), %u found the bus busy, %u dropped, %u errors\n",
+                stats.presented, stats.flushes,
+                (unsigned long)(stats.flushes > 0 ? stats.flushMicrosTotal / stats.flushes : 0),
+                (unsigned long)stats.flushMicrosMax, stats.foundBusy, stats.dropped, stats.errors);
+}
+
+void DisplayController::invalidate()
+{
+  lastRender.screen = Screen::None;
+}
+
+bool DisplayController::blitLargeDigits(Adafruit_SSD1306 &oled, const char *text, int16_t x, int16_t baseline)
+{
+  int16_t top = baseline + DIGIT_ATLAS_TOP;
+  if (top < 0 || (top >> 3) + DIGIT_ATLAS_PAGES > oled.height() / 8)
+  {
+    return false;
+  }
+  const uint8_t *bitmap = nullptr;
+  for (int i = 0; i < DIGIT_ATLAS_SHIFTS; i++)
+  {
+    if (digitAtlasShifts[i] == (top & 7))
+    {
+      bitmap = digitAtlasBitmaps[i];
+    }
+  }
+  if (bitmap == nullptr)
+  {
+    return false;
+  }
+  for (const char *c = text; *c; c++)
+  {
+    if (*c < '0' || *c > '9')
+    {
+      return false;
+    }
+  }
+
+  // One row of the framebuffer per page, so each page of a glyph is one copy
+  uint8_t *pages = oled.getBuffer() + (top >> 3) * oled.width();
+  for (; *text; text++)
+  {
+    const DigitAtlasGlyph &glyph = digitAtlasGlyphs[*text - '0'];
+    int16_t first = x < 0 ? -x : 0;                                           // Columns clipped on the left
+    int16_t last = min((int16_t)glyph.width, (int16_t)(oled.width() - x)); // ... and on the right
+    for (int page = 0; page < DIGIT_ATLAS_PAGES && first < last; page++)
+    {
+      memcpy(pages + page * oled.width() + x + first, bitmap + glyph.offset + page * glyph.width + first, last - first);
+    }
+    x += glyph.advance;
+  }
+  return true;
+}
+
+void DisplayController::drawLargeDigits(const char *text, int16_t x, int16_t baseline)
+{
+  if (blitLargeDigits(oled, text, x, baseline))
+  {
+    return;
+  }
+  oled.setTextColor(1);
+  oled.setTextSize(5);
+  oled.setFont(&Org_01);
+  oled.setCursor(x, baseline);
+  oled.print(text);
+}
+
 void DisplayController::drawSplashScreen()
 {
+  MetricScope scope(Metric::Display);
+  if (!needsRender(Screen::Splash))
+    return;
+
   oled.clearDisplay();
 
   oled.drawBitmap(16, 3, focusdial_logo, 99, 45, 1);
@@ -39,11 +165,12 @@ void DisplayController::drawSplashScreen()
   oled.setCursor(21, 60);
   oled.print("YOUTUBE/ @SALIMBENBOUZ");
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::drawIdleScreen(int durationMinutes, bool wifi)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
 
@@ -56,6 +183,15 @@ void DisplayController::drawIdleScreen(int durationMinutes, bool wifi)
     blinkState = !blinkState;
     lastBlinkTime = currentTime;
   }
+  if (!wifi)
+  {
+    scheduler.wakeAt(lastBlinkTime + 500);
+  }
+
+  // When only the WiFi status changed (it blinks while disconnected), only its corner is sent
+  bool statusOnly = lastRender.screen == Screen::Idle && lastRender.a == durationMinutes;
+  if (!needsRender(Screen::Idle, durationMinutes, wifi, wifi || blinkState))
+    return;
 
   oled.clearDisplay();
 
@@ -110,13 +246,8 @@ void DisplayController::drawIdleScreen(int durationMinutes, bool wifi)
     }
     // Right side is always "00", no need to check '1'
 
-    oled.setTextSize(5);
-    oled.setFont(&Org_01);
-    oled.setCursor(xLeft, 36);
-    oled.print(left);
-
-    oled.setCursor(xRight, 36);
-    oled.print(right);
+    drawLargeDigits(left, xLeft, 36);
+    drawLargeDigits(right, xRight, 36);
 
     // Restore original separator dots
     oled.fillRect(62, 21, 5, 5, 1);
@@ -131,16 +262,22 @@ void DisplayController::drawIdleScreen(int durationMinutes, bool wifi)
     // oled.print("S");
   }
 
-  oled.display();
+  if (statusOnly)
+  {
+    flushWindow(IDLE_STATUS_X, IDLE_STATUS_Y, IDLE_STATUS_WIDTH, IDLE_STATUS_HEIGHT);
+  }
+  else
+  {
+    flush();
+  }
 }
 
 void DisplayController::drawTimerScreen(int timeValue, bool isCountUp)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
 
-  oled.clearDisplay();
-
   int displaySeconds = timeValue;
   if (!isCountUp && displaySeconds < 0) // Ensure remainingSeconds doesn't go below 0 for countdown display
   {
@@ -151,6 +288,11 @@ void DisplayController::drawTimerScreen(int timeValue, bool isCountUp)
     displaySeconds = 0;
   }
 
+  if (!needsRender(Screen::Timer, displaySeconds, isCountUp))
+    return;
+
+  oled.clearDisplay();
+
   // Calculate H, M, S based on the time value (which is either elapsed or remaining)
   int hours = displaySeconds / 3600;
   int minutes = (displaySeconds % 3600) / 60;
@@ -187,12 +329,8 @@ void DisplayController::drawTimerScreen(int timeValue, bool isCountUp)
 
   // Draw the large digits
   oled.setTextColor(1);
-  oled.setTextSize(5);
-  oled.setFont(&Org_01);
-  oled.setCursor(xLeft, yPos);
-  oled.print(left);
-  oled.setCursor(xRight, yPos);
-  oled.print(right);
+  drawLargeDigits(left, xLeft, yPos);
+  drawLargeDigits(right, xRight, yPos);
 
   // Draw separator dots
   oled.fillRect(62, yPos - 15, 5, 5, 1); // Upper dot
@@ -220,21 +358,27 @@ void DisplayController::drawTimerScreen(int timeValue, bool isCountUp)
     // if (isCountUp) { oled.drawBitmap(61, 3, icon_up_arrow, 7, 7, 1); }
   }
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::drawPausedScreen(int remainingSeconds)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
 
-  oled.clearDisplay();
-
   if (remainingSeconds < 0)
   {
     remainingSeconds = 0;
   }
 
+  bool digitsVisible = (millis() / 400) % 2 == 0;
+  scheduler.wakeAt((millis() / 400 + 1) * 400);
+  if (!needsRender(Screen::Paused, remainingSeconds, digitsVisible))
+    return;
+
+  oled.clearDisplay();
+
   int hours = remainingSeconds / 3600;
   int minutes = (remainingSeconds % 3600) / 60;
   int seconds = remainingSeconds % 60;
@@ -265,15 +409,11 @@ void DisplayController::drawPausedScreen(int remainingSeconds)
     xRight += 20;
   }
 
-  if ((millis() / 400) % 2 == 0)
+  if (digitsVisible)
   {
     oled.setTextColor(1);
-    oled.setTextSize(5);
-    oled.setFont(&Org_01);
-    oled.setCursor(xLeft, 36);
-    oled.print(left);
-    oled.setCursor(xRight, 36);
-    oled.print(right);
+    drawLargeDigits(left, xLeft, 36);
+    drawLargeDigits(right, xRight, 36);
 
     oled.fillRect(62, 31, 5, 5, 1);
     oled.fillRect(62, 22, 5, 5, 1);
@@ -295,13 +435,17 @@ void DisplayController::drawPausedScreen(int remainingSeconds)
   oled.print("PAUSED");
   oled.drawBitmap(60, 2, icon_pause, 9, 9, 1);
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::drawResetScreen(bool resetSelected)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
+  if (!needsRender(Screen::Reset, resetSelected))
+    return;
+
   oled.clearDisplay();
 
   // Static UI elements
@@ -345,13 +489,16 @@ void DisplayController::drawResetScreen(bool resetSelected)
     oled.print("RESET");
   }
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::drawDoneScreen(unsigned long finalElapsedTime)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
+  if (!needsRender(Screen::Done, (int32_t)finalElapsedTime))
+    return;
 
   oled.clearDisplay();
 
@@ -390,12 +537,8 @@ void DisplayController::drawDoneScreen(unsigned long finalElapsedTime)
 
   // Draw the large digits
   oled.setTextColor(1);
-  oled.setTextSize(5);
-  oled.setFont(&Org_01);
-  oled.setCursor(xLeft, yPos);
-  oled.print(left);
-  oled.setCursor(xRight, yPos);
-  oled.print(right);
+  drawLargeDigits(left, xLeft, yPos);
+  drawLargeDigits(right, xRight, yPos);
 
   // Draw separator dots
   oled.fillRect(62, yPos - 15, 5, 5, 1); // Upper dot
@@ -428,13 +571,16 @@ void DisplayController::drawDoneScreen(unsigned long finalElapsedTime)
   oled.print("DONE");
   // oled.drawBitmap(61, 3, icon_star, 7, 7, 1); // Remove star, keep it clean
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::drawAdjustScreen(int duration, bool wifi)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
+  if (!needsRender(Screen::Adjust, duration, wifi))
+    return;
 
   oled.clearDisplay();
 
@@ -486,13 +632,8 @@ void DisplayController::drawAdjustScreen(int duration, bool wifi)
       xRight += 20;
     }
 
-    oled.setTextSize(5);
-    oled.setFont(&Org_01);
-    oled.setCursor(xLeft, 36);
-    oled.print(left);
-
-    oled.setCursor(xRight, 36);
-    oled.print(right);
+    drawLargeDigits(left, xLeft, 36);
+    drawLargeDigits(right, xRight, 36);
 
     // Restore original separator dots
     oled.fillRect(62, 21, 5, 5, 1);
@@ -504,13 +645,16 @@ void DisplayController::drawAdjustScreen(int duration, bool wifi)
     // if (duration >= 60) { ... } else { ... }
   }
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::drawProvisionScreen()
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
+  if (!needsRender(Screen::Provision))
+    return;
 
   oled.clearDisplay();
 
@@ -525,23 +669,32 @@ void DisplayController::drawProvisionScreen()
   oled.print("TO PROVISION WIFI");
   oled.drawBitmap(39, 4, provision_logo, 51, 23, 1);
 
-  oled.display();
+  flush();
 }
 
 void DisplayController::clear()
 {
   oled.clearDisplay();
-  oled.display();
+  flush();
+  invalidate();
 }
 
-void DisplayController::showAnimation(const byte frames[][288], int frameCount, bool loop, bool reverse, unsigned long durationMs, int width, int height)
+void DisplayController::showAnimation(const PackedAnimation &frames, bool loop, bool reverse, unsigned long durationMs)
 {
-  animation.start(&frames[0][0], frameCount, loop, reverse, durationMs, width, height); // Pass array as pointer
+  MetricScope scope(Metric::Display);
+  animation.start(frames, loop, reverse, durationMs);
+  invalidate(); // Animation frames overwrite the panel
 }
 
 void DisplayController::updateAnimation()
 {
+  MetricScope scope(Metric::Display);
+  oled.service();
   animation.update();
+  if (animation.isRunning())
+  {
+    scheduler.wakeAt(animation.nextFrameTime());
+  }
 }
 
 bool DisplayController::isAnimationRunning()
@@ -551,49 +704,57 @@ bool DisplayController::isAnimationRunning()
 
 void DisplayController::showConfirmation()
 {
-  showAnimation(animation_tick, 20);
+  showAnimation(animation_tick);
 }
 
 void DisplayController::showCancel()
 {
-  showAnimation(animation_cancel, 18, false, true);
+  showAnimation(animation_cancel, false, true);
 }
 
 void DisplayController::showReset()
 {
-  showAnimation(animation_reset, 28, true, false);
+  showAnimation(animation_reset, true, false);
 }
 
 void DisplayController::showConnected()
 {
-  showAnimation(animation_wifi, 28);
+  showAnimation(animation_wifi);
 }
 
 void DisplayController::showTimerStart()
 {
-  showAnimation(animation_timer_start, 20, false, true);
+  showAnimation(animation_timer_start, false, true);
 }
 
 void DisplayController::showTimerDone()
 {
-  showAnimation(animation_timer_start, 20);
+  showAnimation(animation_timer_start);
 }
 
 void DisplayController::showTimerPause()
 {
-  showAnimation(animation_resume, 18, false, true);
+  showAnimation(animation_resume, false, true);
 }
 
 void DisplayController::showTimerResume()
 {
-  showAnimation(animation_resume, 18);
+  showAnimation(animation_resume);
 }
 
 // Draw the project selection screen - Title in box, centered name with bold font
-void DisplayController::drawProjectSelectionScreen(const ProjectList &projects, int selectedIndex, int topIndex, int numToShow)
+void DisplayController::drawProjectSelectionScreen(const String &projectName, int selectedIndex, int count)
 {
+  MetricScope scope(Metric::Display);
   if (isAnimationRunning())
     return;
+  // The name is read from flash as the selection moves and can be renamed from the web UI
+  // meanwhile, so it is part of the frame's identity along with index and size
+  uint32_t nameHash = 2166136261UL;
+  for (const char *c = projectName.c_str(); *c; c++)
+    nameHash = (nameHash ^ (uint8_t)*c) * 16777619UL;
+  if (!needsRender(Screen::ProjectSelect, selectedIndex, count, (int32_t)nameHash))
+    return;
 
   oled.clearDisplay();
   oled.setTextColor(SSD1306_WHITE);
@@ -618,33 +779,36 @@ void DisplayController::drawProjectSelectionScreen(const ProjectList &projects,
   oled.drawRoundRect(titleX - boxPaddingX, boxY, tw + (2 * boxPaddingX), th + boxPaddingY_Top + boxPaddingY_Bottom + 1, 1, SSD1306_WHITE);
 
   // Check if the selected index is valid
-  if (selectedIndex < 0 || selectedIndex >= projects.size())
+  if (selectedIndex < 0 || selectedIndex >= count)
   {
     oled.setFont(); // Reset to default GFX
     oled.setTextSize(2);
     oled.setCursor(10, 28);
     oled.print("[No Projects]");
-    oled.display();
+    flush();
     return;
   }
 
   // --- Draw Project Name with Bold Font ---
   oled.setFont(&FreeSansBold9pt7b); // Use bold font
   oled.setTextSize(1);              // Size 1 for this font is good
-  String name = projects[selectedIndex].name;
+  // Drawn from the caller's string; only a name that needs truncating is copied
+  const String *name = &projectName;
+  String truncated;
 
   // Truncation Logic
   int16_t x1, y1;
   uint16_t w, h;
-  oled.getTextBounds(name, 0, 0, &x1, &y1, &w, &h);
+  oled.getTextBounds(*name, 0, 0, &x1, &y1, &w, &h);
   int maxWidth = oled.width() - 8; // Slightly more margin for this font
   if (w > maxWidth)
   {
-    int maxChars = (maxWidth / (w / name.length())) - 2;
+    int maxChars = (maxWidth / (w / projectName.length())) - 2;
     if (maxChars < 1)
       maxChars = 1;
-    name = name.substring(0, maxChars) + "...";
-    oled.getTextBounds(name, 0, 0, &x1, &y1, &w, &h);
+    truncated = projectName.substring(0, maxChars) + "...";
+    name = &truncated;
+    oled.getTextBounds(*name, 0, 0, &x1, &y1, &w, &h);
   }
 
   // Center the text horizontally and vertically below the title box
@@ -653,23 +817,23 @@ void DisplayController::drawProjectSelectionScreen(const ProjectList &projects,
   int16_t y = titleBoxBottom + ((oled.height() - titleBoxBottom - 12) / 2) + 8; // Adjusted to make room for pagination dots
 
   oled.setCursor(x, y);
-  oled.print(name);
+  oled.print(*name);
 
   // --- Draw Pagination Dots ---
-  if (projects.size() > 1)
+  if (count > 1 && count <= PROJECT_SELECT_MAX_DOTS)
   {
     // Calculate total width of all dots and spacing
     const int dotRadius = 2;
     const int dotSpacing = 4;
     const int dotDiameter = dotRadius * 2;
-    const int totalWidth = (projects.size() * dotDiameter) + ((projects.size() - 1) * dotSpacing);
+    const int totalWidth = (count * dotDiameter) + ((count - 1) * dotSpacing);
 
     // Calculate starting X position to center the dots
     const int dotsStartX = (oled.width() - totalWidth) / 2;
     const int dotsY = oled.height() - 7; // 7 pixels from bottom
 
     // Draw all dots
-    for (int i = 0; i < projects.size(); i++)
+    for (int i = 0; i < count; i++)
     {
       int dotX = dotsStartX + (i * (dotDiameter + dotSpacing));
 
@@ -685,10 +849,20 @@ void DisplayController::drawProjectSelectionScreen(const ProjectList &projects,
       }
     }
   }
+  else if (count > PROJECT_SELECT_MAX_DOTS)
+  {
+    // Too many for dots: "12/340"
+    char position[24];
+    snprintf(position, sizeof(position), "%d/%d", selectedIndex + 1, count);
+    oled.setFont(&Picopixel);
+    oled.getTextBounds(position, 0, 0, &x1, &y1, &w, &h);
+    oled.setCursor((oled.width() - w) / 2, oled.height() - 4);
+    oled.print(position);
+  }
 
   // Reset font for other screens
   oled.setFont();
 
-  oled.display();
+  flush();
 }
 
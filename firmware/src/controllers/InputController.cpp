@@ -1,31 +1,51 @@
 #include "controllers/InputController.h"
+#include "Scheduler.h"
+#include "Metrics.h"
 #include <Arduino.h>
 
 static InputController *instancePtr = nullptr; // Global pointer for the ISR
 
-void InputController::handleEncoderInterrupt()
+// Quadrature transition table from RotaryEncoder: index is (old << 2) | new
+static const int8_t KNOBDIR[] = {
+    0, -1, 1, 0,
+    1, 0, 0, -1,
+    -1, 0, 0, 1,
+    0, 1, -1, 0};
+
+uint8_t IRAM_ATTR InputController::sampleLevels()
 {
-  if (instancePtr)
-  {
-    instancePtr->encoder.tick();
-  }
+  uint8_t levels = 0;
+  if (digitalRead(instancePtr->encoderPinA))
+    levels |= INPUT_LEVEL_A;
+  if (digitalRead(instancePtr->encoderPinB))
+    levels |= INPUT_LEVEL_B;
+  if (digitalRead(instancePtr->buttonPin) == LOW) // Active low
+    levels |= INPUT_LEVEL_BUTTON;
+  return levels;
 }
 
-void InputController::handleButtonInterrupt()
+// Shared by all three pins: timestamp the levels and leave decoding to update()
+void IRAM_ATTR InputController::handlePinInterrupt()
 {
   if (instancePtr)
   {
-    instancePtr->button.tick();
+    instancePtr->edges.push({(uint32_t)micros(), sampleLevels()});
+    Scheduler::wakeFromISR();
   }
 }
 
 InputController::InputController(uint8_t buttonPin, uint8_t encoderPinA, uint8_t encoderPinB)
     : button(buttonPin, true),
-      encoder(encoderPinA, encoderPinB, RotaryEncoder::LatchMode::TWO03),
-      lastPosition(0),
       buttonPin(buttonPin),
       encoderPinA(encoderPinA),
-      encoderPinB(encoderPinB)
+      encoderPinB(encoderPinB),
+      quadratureState(0),
+      quadratureSteps(0),
+      encoderPosition(0),
+      lastPosition(0),
+      buttonLevel(false),
+      pendingButtonLevel(false),
+      pendingButtonSince(0)
 {
 
   // Attach click, double-click, and long-press handlers using OneButton library
@@ -41,30 +61,47 @@ InputController::InputController(uint8_t buttonPin, uint8_t encoderPinA, uint8_t
 
 void InputController::begin()
 {
-  button.setDebounceMs(20);
+  button.setDebounceMs(0); // Debounced here from the ISR timestamps
   button.setClickMs(150);
   button.setPressMs(400);
-  lastPosition = encoder.getPosition();
 
   pinMode(buttonPin, INPUT_PULLUP);
   pinMode(encoderPinA, INPUT_PULLUP);
   pinMode(encoderPinB, INPUT_PULLUP);
 
-  // Set up interrupts for encoder handling
-  attachInterrupt(digitalPinToInterrupt(encoderPinA), handleEncoderInterrupt, CHANGE);
-  attachInterrupt(digitalPinToInterrupt(encoderPinB), handleEncoderInterrupt, CHANGE);
+  uint8_t levels = sampleLevels();
+  quadratureState = levels & (INPUT_LEVEL_A | INPUT_LEVEL_B);
+  buttonLevel = pendingButtonLevel = levels & INPUT_LEVEL_BUTTON;
+  pendingButtonSince = micros();
+  lastPosition = encoderPosition;
 
-  // Set up interrupt for button handling
-  attachInterrupt(digitalPinToInterrupt(buttonPin), handleButtonInterrupt, CHANGE); // Interrupt on button state change
+  // One handler for every edge on the encoder and the button
+  attachInterrupt(digitalPinToInterrupt(encoderPinA), handlePinInterrupt, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(encoderPinB), handlePinInterrupt, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(buttonPin), handlePinInterrupt, CHANGE);
 }
 
 void InputController::update()
 {
-  button.tick();
-  encoder.tick();
+  MetricScope scope(Metric::Input);
+
+  // Decode every edge in order, so a fast spin during a long OLED flush
+  // still adds up to the right number of detents
+  InputEdge edge;
+  while (edges.pop(edge))
+  {
+    decodeQuadrature(edge.levels);
+    decodeButton(edge);
+  }
+
+  if (pendingButtonLevel != buttonLevel && micros() - pendingButtonSince >= BUTTON_DEBOUNCE_US)
+  {
+    commitButtonLevel(pendingButtonLevel);
+  }
+  button.tick(buttonLevel);
 
   // Check encoder position and calculate delta
-  int currentPosition = encoder.getPosition();
+  int currentPosition = encoderPosition;
   int delta = currentPosition - lastPosition;
 
   if (delta != 0)
@@ -72,6 +109,71 @@ void InputController::update()
     onEncoderRotate(delta);
     lastPosition = currentPosition;
   }
+
+  // OneButton resolves click and long-press timing by polling, and a raw
+  // level change needs a poll to be confirmed once the debounce time passes
+  if (!button.isIdle() || pendingButtonLevel != buttonLevel)
+  {
+    scheduler.wakeIn(INPUT_POLL_INTERVAL_MS);
+  }
+}
+
+void InputController::decodeQuadrature(uint8_t levels)
+{
+  uint8_t state = levels & (INPUT_LEVEL_A | INPUT_LEVEL_B);
+  if (state == quadratureState)
+  {
+    return;
+  }
+  quadratureSteps += KNOBDIR[state | (quadratureState << 2)];
+  quadratureState = state;
+
+  // Two steps per detent, latched at 00 and 11
+  if (state == 0 || state == (INPUT_LEVEL_A | INPUT_LEVEL_B))
+  {
+    encoderPosition = quadratureSteps >> 1;
+  }
+}
+
+void InputController::decodeButton(const InputEdge &edge)
+{
+  bool pressed = edge.levels & INPUT_LEVEL_BUTTON;
+  if (pressed == pendingButtonLevel)
+  {
+    return;
+  }
+
+  // The previous level held long enough before this edge, so it was real
+  if (pendingButtonLevel != buttonLevel && edge.timeMicros - pendingButtonSince >= BUTTON_DEBOUNCE_US)
+  {
+    commitButtonLevel(pendingButtonLevel);
+  }
+  pendingButtonLevel = pressed;
+  pendingButtonSince = edge.timeMicros;
+}
+
+void InputController::commitButtonLevel(bool pressed)
+{
+  buttonLevel = pressed;
+  // The second tick settles OneButton's transitional states (UP -> COUNT),
+  // so a press and release drained together still count as a click
+  button.tick(buttonLevel);
+  button.tick(buttonLevel);
+}
+
+long InputController::getEncoderPosition() const
+{
+  return encoderPosition;
+}
+
+uint32_t InputController::getDroppedEdges() const
+{
+  return edges.getOverflows();
+}
+
+uint32_t InputController::getEdgeHighWater() const
+{
+  return edges.getHighWater();
 }
 
 // Register state-specific handlers
@@ -103,8 +205,8 @@ void InputController::releaseHandlers()
   longPressHandler = nullptr;
   encoderRotateHandler = nullptr;
 
-  button.reset();                       // Reset button state machine
-  lastPosition = encoder.getPosition(); // Reset encoder position tracking
+  button.reset();                  // Reset button state machine
+  lastPosition = encoderPosition;  // Reset encoder position tracking
 }
 
 // Internal event handlers that call the registered state handlers
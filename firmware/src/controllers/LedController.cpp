@@ -1,4 +1,6 @@
-#include "controllers/LEDController.h"
+#include "controllers/LedController.h"
+#include "Scheduler.h"
+#include "Metrics.h"
 #include <Arduino.h> // Ensure Arduino types (min, uint32_t, etc.) are included
 #include <cmath>     // Include for fmodf
 
@@ -8,28 +10,45 @@ const uint8_t RADAR_SWEEP_TAIL_LENGTH = 12; // Longer tail (assuming 16 LEDs tot
 
 #define LED_OFFSET -1 // Offset to align 12 o'clock position
 
+const uint32_t FILL_DURATION_MS = 300;   // Quick fill before a countdown starts to decay
+const uint32_t SPINNER_STEP_MS = 100;    // One LED per step
+const uint16_t BREATH_STEPS = 255;       // Steps in one breath at animationSpeed ms each
+
 LEDController::LEDController(uint8_t ledPin, uint16_t numLeds, uint8_t brightness)
-    : leds(numLeds, ledPin),
-      numLeds(numLeds),
+    : strip(ledPin, numLeds),
+      numLeds(min(numLeds, (uint16_t)NEOPIXEL_MAX_LEDS)),
       brightness(brightness),
       currentAnimation(None),
-      lastUpdateTime(0),
-      currentStep(0),
-      currentCycle(0),
-      decayStarted(false),
+      animationStart(0),
+      fillStart(0),
+      animationColor(0),
+      animationDuration(0),
+      animationSpeed(0),
+      animationCycles(-1),
+      endFilled(false),
       previewMode(false),
       lastColor(0),
-      lastAnimation(None) {}
+      lastAnimation(None),
+      lastAnimationStart(0),
+      frame{},
+      sentFrame{},
+      framePending(false),
+      frameSent(false),
+      lastShowTime(0),
+      framesShown(0),
+      framesSkipped(0) {}
 
 void LEDController::begin()
 {
-  leds.begin();
-  leds.setBrightness(brightness);
-  leds.show();
+  strip.begin();
+  commitFrame(); // All off
+  flush();
 }
 
 void LEDController::update()
 {
+  MetricScope scope(Metric::Leds);
+
   switch (currentAnimation)
   {
   case FillAndDecay:
@@ -47,20 +66,82 @@ void LEDController::update()
   default:
     break;
   }
+
+  if (currentAnimation != None)
+  {
+    // Frames are pure functions of time, so waking later than the next change
+    // just skips straight to the right frame; never wake faster than the tick
+    unsigned long next = nextUpdateTime();
+    if (frameSent && (long)(next - (lastShowTime + LED_FRAME_INTERVAL_MS)) < 0)
+    {
+      next = lastShowTime + LED_FRAME_INTERVAL_MS;
+    }
+    scheduler.wakeAt(next);
+  }
+}
+
+// Smallest n with n * divisor >= value
+static inline uint64_t ceilDiv(uint64_t value, uint64_t divisor)
+{
+  return (value + divisor - 1) / divisor;
+}
+
+// When the running animation next changes what is on the ring
+unsigned long LEDController::nextUpdateTime() const
+{
+  unsigned long elapsed = millis() - animationStart;
+
+  switch (currentAnimation)
+  {
+  case FillAndDecay:
+  {
+    unsigned long next = animationStart + animationDuration; // Ring fully off
+    unsigned long revealed = millis() - fillStart;
+    if (revealed < FILL_DURATION_MS && numLeds > 0)
+    {
+      uint32_t lit = revealed * numLeds / FILL_DURATION_MS;
+      next = fillStart + ceilDiv((uint64_t)(lit + 1) * FILL_DURATION_MS, numLeds);
+    }
+    uint32_t totalSteps = numLeds * brightness;
+    if (animationDuration > FILL_DURATION_MS && totalSteps > 0)
+    {
+      uint32_t decayDuration = animationDuration - FILL_DURATION_MS;
+      uint64_t step = decaySteps(elapsed);
+      unsigned long nextStep = animationStart + FILL_DURATION_MS + ceilDiv((step + 1) * decayDuration, totalSteps);
+      if ((long)(nextStep - next) < 0)
+      {
+        next = nextStep;
+      }
+    }
+    return next;
+  }
+  case Spinner:
+    return animationStart + (elapsed / SPINNER_STEP_MS + 1) * SPINNER_STEP_MS;
+  case Breath:
+  {
+    uint32_t speed = max(animationSpeed, (uint32_t)1);
+    return animationStart + (elapsed / speed + 1) * speed;
+  }
+  case RadarSweep:
+  {
+    // Only the integer lead pixel is drawn, so wake when it moves to the next LED
+    uint32_t stepMs = radarStepMs();
+    return animationStart + (elapsed / stepMs + 1) * stepMs;
+  }
+  default:
+    return millis();
+  }
 }
 
-void LEDController::startFillAndDecay(uint32_t color, uint32_t totalDuration)
+void LEDController::startFillAndDecay(uint32_t color, uint32_t totalDuration, uint32_t elapsedMs)
 {
   stopCurrentAnimation();
   currentAnimation = FillAndDecay;
   animationColor = color;
   animationDuration = totalDuration;
-  currentStep = 0;
-  pixelIndex = 0;
-  brightnessLevel = brightness;
-  decayStarted = false;
-  lastUpdateTime = millis();
-  Serial.printf("LED: Starting FillAndDecay. Color: %06X, Duration: %lu ms\n", color, totalDuration);
+  fillStart = millis();
+  animationStart = fillStart - elapsedMs;
+  Serial.printf("LED: Starting FillAndDecay. Color: %06X, Duration: %lu ms, Elapsed: %lu ms\n", color, (unsigned long)totalDuration, (unsigned long)elapsedMs);
 }
 
 void LEDController::setSpinner(uint32_t color, int cycles)
@@ -69,9 +150,7 @@ void LEDController::setSpinner(uint32_t color, int cycles)
   currentAnimation = Spinner;
   animationColor = color;
   animationCycles = cycles;
-  currentCycle = 0;
-  currentStep = 0;
-  lastUpdateTime = millis();
+  animationStart = millis();
 }
 
 void LEDController::setBreath(uint32_t color, int cycles, bool endFilled, uint32_t speed)
@@ -82,23 +161,96 @@ void LEDController::setBreath(uint32_t color, int cycles, bool endFilled, uint32
   animationCycles = cycles;
   this->endFilled = endFilled;
   animationSpeed = speed;
-  currentCycle = 0;
-  currentStep = 0;
-  lastUpdateTime = millis();
+  animationStart = millis();
 }
 
 void LEDController::setSolid(uint32_t color)
 {
   stopCurrentAnimation();
-  leds.fill(color);
-  leds.show();
+  fillFrame(color);
+  commitFrame();
 }
 
 void LEDController::turnOff()
 {
   stopCurrentAnimation();
-  leds.clear();
-  leds.show();
+  fillFrame(0);
+  commitFrame();
+}
+
+void LEDController::setPixel(uint16_t index, uint32_t color)
+{
+  if (index < numLeds)
+  {
+    frame[index] = color;
+  }
+}
+
+void LEDController::fillFrame(uint32_t color)
+{
+  for (uint16_t i = 0; i < numLeds; i++)
+  {
+    frame[i] = color;
+  }
+}
+
+// Animations finish a frame here; it goes out on the next flush()
+void LEDController::commitFrame()
+{
+  framePending = true;
+}
+
+void LEDController::flush()
+{
+  if (!framePending)
+  {
+    return;
+  }
+
+  // At most one frame per tick; a frame committed sooner waits for the next
+  unsigned long now = millis();
+  if (frameSent && now - lastShowTime < LED_FRAME_INTERVAL_MS)
+  {
+    scheduler.wakeAt(lastShowTime + LED_FRAME_INTERVAL_MS);
+    return;
+  }
+
+  if (frameSent && memcmp(frame, sentFrame, numLeds * sizeof(uint32_t)) == 0)
+  {
+    framePending = false;
+    framesSkipped++;
+    return;
+  }
+
+  MetricScope scope(Metric::LedShow);
+  if (!strip.write(frame, brightness))
+  {
+    // Previous frame still on the wire (or no RMT); retry next tick
+    scheduler.wakeIn(1);
+    return;
+  }
+  memcpy(sentFrame, frame, numLeds * sizeof(uint32_t));
+  frameSent = true;
+  framePending = false;
+  lastShowTime = now;
+  framesShown++;
+}
+
+uint32_t LEDController::getFramesShown() const
+{
+  return framesShown;
+}
+
+uint32_t LEDController::getFramesSkipped() const
+{
+  return framesSkipped;
+}
+
+void LEDController::printFrameStats()
+{
+  unsigned long now = millis();
+  Serial.printf("LEDs: %u frames shown (%.1f/s since boot), %u identical frames skipped\n",
+                framesShown, now > 0 ? framesShown * 1000.0f / now : 0.0f, framesSkipped);
 }
 
 uint32_t LEDController::scaleColor(uint32_t color, uint8_t brightnessLevel)
@@ -106,186 +258,142 @@ uint32_t LEDController::scaleColor(uint32_t color, uint8_t brightnessLevel)
   uint8_t r = (color >> 16 & 0xFF) * brightnessLevel / 255;
   uint8_t g = (color >> 8 & 0xFF) * brightnessLevel / 255;
   uint8_t b = (color & 0xFF) * brightnessLevel / 255;
-  return leds.Color(r, g, b);
+  return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
 }
 
-void LEDController::handleFillAndDecay()
+// Decay steps completed at a point on the countdown timeline. Each LED fades
+// through 'brightness' levels, one LED after another, and the last one goes
+// dark exactly when the countdown ends.
+uint64_t LEDController::decaySteps(unsigned long elapsed) const
 {
-  // Original FillAndDecay Logic
-  uint32_t fillDuration = 300; // Initial quick fill duration in ms
-  // Ensure decayDuration is not negative if animationDuration is very short
-  uint32_t decayDuration = (animationDuration > fillDuration) ? (animationDuration - fillDuration) : 0;
-
-  // Calculate total steps based on number of LEDs and brightness levels
-  // Each LED fades through 'brightness' levels
   uint32_t totalSteps = numLeds * brightness;
-  // Calculate duration per step, avoid division by zero
-  uint32_t stepDuration = (totalSteps > 0) ? (decayDuration / totalSteps) : 0;
-
-  // Phase 1: Quick Fill
-  if (currentStep < numLeds)
+  if (elapsed < FILL_DURATION_MS)
   {
-    // Calculate duration for each LED to turn on during the fill phase
-    uint32_t stepDurationFill = (numLeds > 0) ? (fillDuration / numLeds) : 0;
-
-    // Check if it's time to light up the next LED (or if duration is zero)
-    if (stepDurationFill == 0 || millis() - lastUpdateTime >= stepDurationFill)
-    {
-      // Calculate the index with offset, wrapping around
-      int adjustedIndex = (currentStep + LED_OFFSET + numLeds) % numLeds;
-      // Set the pixel to the full animation color
-      uint32_t setColor = scaleColor(animationColor, brightness);
-      leds.setPixelColor(adjustedIndex, setColor);
-      leds.show();
-      currentStep++;
-      lastUpdateTime = millis();
-    }
+    return 0;
   }
-  // Phase 2: Decay
-  else
+  if (animationDuration <= FILL_DURATION_MS || elapsed >= animationDuration)
   {
-    // Initialize decay phase only once
-    if (!decayStarted)
-    {
-      decayStarted = true;
-      pixelIndex = 0;               // Start decaying from the first pixel
-      brightnessLevel = brightness; // Start at full brightness for decay
-      lastUpdateTime = millis();
-      Serial.println("LED: Decay phase started.");
-    }
+    return totalSteps;
+  }
+  uint32_t decayDuration = animationDuration - FILL_DURATION_MS;
+  return (uint64_t)(elapsed - FILL_DURATION_MS) * totalSteps / decayDuration;
+}
 
-    // Check if it's time for the next decay step (and if decay is needed)
-    if (stepDuration > 0 && millis() - lastUpdateTime >= stepDuration)
-    {
-      lastUpdateTime = millis();
+uint32_t LEDController::radarStepMs() const
+{
+  return (uint32_t)(1000.0f / RADAR_SWEEP_SPEED_LEDS_PER_SEC);
+}
 
-      // If current pixel still has brightness, decrease it
-      if (brightnessLevel > 0)
-      {
-        brightnessLevel--;
-        // Calculate the index of the pixel currently being decayed
-        int adjustedIndex = (pixelIndex + LED_OFFSET + numLeds) % numLeds;
-        uint32_t setColor = scaleColor(animationColor, brightnessLevel);
-        leds.setPixelColor(adjustedIndex, setColor);
-        leds.show();
-      }
-      // If current pixel brightness reached zero, turn it off and move to the next
-      else
-      {
-        int adjustedIndex = (pixelIndex + LED_OFFSET + numLeds) % numLeds;
-        leds.setPixelColor(adjustedIndex, 0); // Turn off the pixel
-        leds.show();
-        pixelIndex++;                    // Move to the next pixel
-        brightnessLevel = brightness; // Reset brightness for the next pixel decay
-      }
+// Every handler below draws the frame for the current time from scratch, so a
+// late or skipped update() never leaves the ring behind.
 
-      // Check if all pixels have completed their decay
-      if (pixelIndex >= numLeds)
-      {
-        Serial.println("LED: FillAndDecay finished.");
-        stopCurrentAnimation(); // Animation complete
-      }
+void LEDController::handleFillAndDecay()
+{
+  unsigned long now = millis();
+  unsigned long elapsed = now - animationStart;
+
+  if (elapsed >= animationDuration)
+  {
+    Serial.println("LED: FillAndDecay finished.");
+    turnOff();
+    return;
+  }
+
+  uint64_t steps = (brightness > 0) ? decaySteps(elapsed) : 0;
+  uint16_t decayingPixel = (brightness > 0) ? steps / brightness : 0;
+  uint8_t decayingLevel = (brightness > 0) ? brightness - steps % brightness : 0;
+
+  // Quick fill: LEDs appear one by one over FILL_DURATION_MS, showing their
+  // decay state (a resumed countdown only lights what is left)
+  unsigned long revealed = now - fillStart;
+  uint16_t lit = (revealed < FILL_DURATION_MS) ? revealed * numLeds / FILL_DURATION_MS : numLeds;
+
+  fillFrame(0);
+  for (uint16_t i = 0; i < lit; i++)
+  {
+    uint8_t level = 0;
+    if (i > decayingPixel)
+    {
+      level = brightness;
     }
-    // Handle cases where decay duration is zero (turn off immediately after fill)
-    else if (stepDuration == 0 && decayStarted && pixelIndex < numLeds)
+    else if (i == decayingPixel)
     {
-       Serial.println("LED: Decay duration is zero, clearing LEDs.");
-       turnOff(); // Use turnOff to clear and stop animation
+      level = decayingLevel;
     }
+    // Calculate the index with offset, wrapping around
+    setPixel((i + LED_OFFSET + numLeds) % numLeds, scaleColor(animationColor, level));
   }
+  commitFrame();
 }
 
 void LEDController::handleSpinner()
 {
-  uint32_t stepDuration = 100;
-  if (millis() - lastUpdateTime >= stepDuration)
+  uint32_t step = (millis() - animationStart) / SPINNER_STEP_MS;
+  bool finished = false;
+  if (animationCycles != -1 && numLeds > 0 && step / numLeds >= (uint32_t)animationCycles)
   {
-    leds.clear();
-    for (int i = 0; i < numLeds; i++)
-    {
-      leds.setPixelColor((i + currentStep) % numLeds, scaleColor(animationColor, i * 255 / numLeds));
-    }
-    leds.show();
-    currentStep++;
-    lastUpdateTime = millis();
+    // Hold the last frame of the final cycle
+    step = (animationCycles > 0) ? animationCycles * numLeds - 1 : 0;
+    finished = true;
+  }
 
-    if (currentStep >= numLeds)
-    {
-      currentStep = 0;
-      currentCycle++;
-      if (animationCycles != -1 && currentCycle >= animationCycles)
-      {
-        stopCurrentAnimation();
-      }
-    }
+  fillFrame(0);
+  for (int i = 0; i < numLeds; i++)
+  {
+    setPixel((i + step) % numLeds, scaleColor(animationColor, i * 255 / numLeds));
+  }
+  commitFrame();
+
+  if (finished)
+  {
+    stopCurrentAnimation();
   }
 }
 
 void LEDController::handleBreath()
 {
-  if (millis() - lastUpdateTime >= animationSpeed)
+  uint32_t stepCount = (millis() - animationStart) / max(animationSpeed, (uint32_t)1);
+  uint32_t cycle = stepCount / BREATH_STEPS;
+
+  // Adjust the number of cycles if `endFilled` is true
+  int effectiveCycles = animationCycles;
+  if (endFilled && effectiveCycles > 0)
   {
-    uint8_t fadeBrightness = (currentStep <= 127) ? currentStep * 2 : (255 - currentStep) * 2;
+    effectiveCycles--;
+  }
 
-    for (int i = 0; i < numLeds; i++)
+  // At least one full breath plays, even when a single cycle ends filled
+  if (effectiveCycles != -1 && cycle >= (uint32_t)max(effectiveCycles, 1))
+  {
+    if (endFilled)
     {
-      leds.setPixelColor(i, scaleColor(animationColor, fadeBrightness));
+      // Additional half cycle to fill the LEDs
+      fillFrame(animationColor);
+      commitFrame();
     }
-    leds.show();
-    currentStep++;
-
-    if (currentStep >= 255)
+    else
     {
-      currentStep = 0;
-      currentCycle++;
-
-      // Adjust the number of cycles if `endFilled` is true
-      int effectiveCycles = animationCycles;
-      if (endFilled && effectiveCycles > 0)
-      {
-        effectiveCycles--;
-      }
-
-      if (effectiveCycles != -1 && currentCycle >= effectiveCycles)
-      {
-        if (endFilled)
-        {
-          // Additional half cycle to fill the LEDs
-          for (int i = 0; i < numLeds; i++)
-          {
-            leds.setPixelColor(i, animationColor);
-          }
-          leds.show();
-        }
-        else
-        {
-          turnOff();
-        }
-        stopCurrentAnimation();
-      }
+      turnOff();
     }
-    lastUpdateTime = millis();
+    stopCurrentAnimation();
+    return;
   }
+
+  uint8_t step = stepCount % BREATH_STEPS;
+  uint8_t fadeBrightness = (step <= 127) ? step * 2 : (255 - step) * 2;
+  fillFrame(scaleColor(animationColor, fadeBrightness));
+  commitFrame();
 }
 
 void LEDController::handleRadarSweep()
 {
-  unsigned long currentTime = millis();
-  unsigned long dt = currentTime - lastUpdateTime;
-
-  // Calculate position increment based on speed and elapsed time
-  float increment = (RADAR_SWEEP_SPEED_LEDS_PER_SEC * dt) / 1000.0f;
   if (numLeds == 0) return;
-  // Use fmodf explicitly for float modulo
-  // sweepPosition = fmodf(sweepPosition + increment, (float)numLeds); // Original CW logical attempt
-  // To achieve visual CW, decrement the logical position
-  sweepPosition = fmodf(sweepPosition - increment + numLeds, (float)numLeds);
-
-  lastUpdateTime = currentTime;
 
-  leds.clear();
+  // The head moves one LED per step; decrementing the logical position gives a visual CW sweep
+  uint32_t travelled = ((millis() - animationStart) / radarStepMs()) % numLeds;
+  int leadPixel = (numLeds - travelled) % numLeds;
 
-  int leadPixel = (int)sweepPosition;
+  fillFrame(0);
 
   // Draw the fading tail
   uint8_t tailLength = min((uint8_t)RADAR_SWEEP_TAIL_LENGTH, (uint8_t)numLeds);
@@ -313,28 +421,22 @@ void LEDController::handleRadarSweep()
         }
     }
 
-    uint32_t dimmedColor = scaleColor(sweepColor, brightnessLevel);
-    leds.setPixelColor(currentPixelIndex, dimmedColor);
+    uint32_t dimmedColor = scaleColor(animationColor, brightnessLevel);
+    setPixel(currentPixelIndex, dimmedColor);
   }
 
-  leds.show();
+  commitFrame();
 }
 
 void LEDController::stopCurrentAnimation()
 {
   currentAnimation = None;
-  currentStep = 0;
-  currentCycle = 0;
-  pixelIndex = 0;
-  brightnessLevel = brightness;
-  decayStarted = false;
-  lastUpdateTime = millis();
 }
 
 void LEDController::printDebugInfo()
 {
-  Serial.printf("Anim: %d, Step: %d, Cycle: %d, PixelIdx: %d, Leds numb: %d, Brightness: %d, Color: 0x%06X, Dur: %lu, Speed: %lu, Cycles: %d, EndFilled: %d\n",
-                currentAnimation, currentStep, currentCycle, pixelIndex, numLeds, brightness, animationColor, animationDuration, animationSpeed, animationCycles, endFilled);
+  Serial.printf("Anim: %d, Elapsed: %lu, Leds numb: %d, Brightness: %d, Color: 0x%06X, Dur: %lu, Speed: %lu, Cycles: %d, EndFilled: %d\n",
+                currentAnimation, millis() - animationStart, numLeds, brightness, animationColor, (unsigned long)animationDuration, (unsigned long)animationSpeed, animationCycles, endFilled);
 }
 
 // Implement preview mode methods
@@ -355,7 +457,7 @@ void LEDController::setPreviewMode(bool enabled)
   }
 }
 
-void LEDController::setPreviewColor(const String &hexColor)
+void LEDController::setPreviewColor(uint32_t color)
 {
   // First, make sure we're in preview mode
   if (!previewMode)
@@ -365,9 +467,8 @@ void LEDController::setPreviewColor(const String &hexColor)
   }
 
   // Set the color on the LEDs
-  uint32_t color = hexColorToUint32(hexColor);
   setSolid(color);
-  Serial.printf("LED preview color set to: %s (0x%06X)\n", hexColor.c_str(), color);
+  Serial.printf("LED preview color set to: 0x%06X\n", color);
 }
 
 void LEDController::resetPreviewColor()
@@ -391,6 +492,7 @@ void LEDController::saveCurrentState()
 {
   lastAnimation = currentAnimation;
   lastColor = animationColor;
+  lastAnimationStart = animationStart;
   Serial.printf("Saved LED state: animation=%d, color=0x%06X\n",
                 lastAnimation, lastColor);
 }
@@ -414,10 +516,19 @@ void LEDController::restoreLastState()
   case Breath:
     setBreath(lastColor, animationCycles, endFilled, animationSpeed);
     break;
+  case RadarSweep:
+    startRadarSweep(lastColor);
+    break;
   default:
     setSolid(lastColor);
     break;
   }
+
+  // Pick the animation up where it would be now rather than restarting it
+  if (lastAnimation != None)
+  {
+    animationStart = lastAnimationStart;
+  }
 }
 
 // New function to start the Radar Sweep animation
@@ -425,8 +536,7 @@ void LEDController::startRadarSweep(uint32_t color)
 {
   stopCurrentAnimation();
   currentAnimation = RadarSweep;
-  sweepColor = color;
-  sweepPosition = 0.0f;
-  lastUpdateTime = millis(); // Use common lastUpdateTime for timing
+  animationColor = color;
+  animationStart = millis();
   Serial.printf("LED: Starting RadarSweep. Color: %06X\n", color);
 }
\ No newline at end of file
@@ -1,26 +1,32 @@
 #include "Config.h"
 #include "controllers/NetworkController.h"
 #include "Controllers.h"
+#include "Scheduler.h"
+#include "Metrics.h"
+#include "JsonWriter.h"
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 
 #include <WiFi.h>
-#include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <BluetoothA2DPSink.h>
 #include <esp_bt.h>
 #include <ESPAsyncWebServer.h>
 #include <ESPmDNS.h>
 
-#include "controllers/LEDController.h"
+#include "controllers/LedController.h"
 #include "managers/ProjectManager.h"
 #include "StateMachine.h"
+#include <memory>
 
 NetworkController *NetworkController::instance = nullptr;
 
 // Define WebSocket path
 #define WS_PATH "/ws"
 
+#define WEB_INDEX_PATH "/index.html" // Stored as index.html.gz; AsyncFileResponse falls back to it
+#define WEB_ASSETS_PATH "/assets/"
+
 // Add explicit extern reference for ledController which is used in handleColorPreview
 extern LEDController ledController;
 
@@ -30,14 +36,21 @@ NetworkController::NetworkController()
       _webServerRunning(false),
       _ws(WS_PATH), // Initialize WebSocket with path
       _lastWsCleanupTime(0),
+      _stateSnapshotWanted(false),
+      _statePublished(nullptr),
+      _elapsedPublished(0),
+      _statePublishedAt(0),
+      _stateFramesSent(0),
+      _wsClientsDropped(0),
       btPaired(false),
       bluetoothActive(false),
       bluetoothAttempted(false),
+      provisioningMode(false),
       lastBluetoothtAttempt(0),
       bluetoothTaskHandle(nullptr),
-      webhookQueue(nullptr),
       webhookTaskHandle(nullptr),
-      provisioningMode(false)
+      webhookCaptureAllocs(0),
+      webhookSerializeAllocs(0)
 {
   instance = this;
 }
@@ -62,10 +75,8 @@ void NetworkController::begin()
     Serial.println("No WiFi credentials stored. Skipping WiFi.begin().");
   }
 
-  // Load bluetooth paired state from nvs
-  preferences.begin("network", true);
-  btPaired = preferences.getBool("bt_paired", false);
-  preferences.end();
+  // Load bluetooth paired state (read from NVS by the settings store)
+  btPaired = settings.getBluetoothPaired();
 
   if (btPaired)
   {
@@ -77,11 +88,9 @@ void NetworkController::begin()
     Serial.println("No previous Bluetooth pairing found. Skipping Bluetooth initialization.");
   }
 
-  // Load Webhook URL from NVS under the "focusdial" namespace
-  preferences.begin("focusdial", true); // Start read-only
-  webhookURL = preferences.getString("webhook_url", "");
-  apiKey = preferences.getString("api_key", ""); // Load API Key
-  preferences.end();
+  // Load Webhook URL and API Key from the settings store
+  webhookURL = settings.getWebhookUrl();
+  apiKey = settings.getApiKey();
 
   // --- Validate loaded URL ---
   bool urlInvalid = false;
@@ -100,11 +109,9 @@ void NetworkController::begin()
 
   if (urlInvalid)
   {
-    webhookURL = "";                       // Clear in memory
-    preferences.begin("focusdial", false); // Re-open read-write
-    preferences.remove("webhook_url");     // Remove from NVS
-    preferences.end();
-    Serial.println("Cleared invalid webhook URL from NVS.");
+    webhookURL = "";            // Clear in memory
+    settings.setWebhookUrl(""); // Removed from NVS on the next commit
+    Serial.println("Cleared invalid webhook URL.");
   }
   // --- End Validation ---
 
@@ -121,10 +128,8 @@ void NetworkController::begin()
     Serial.println("API Key not found in NVS.");
   }
 
-  if (webhookQueue == nullptr)
-  {
-    webhookQueue = xQueueCreate(5, sizeof(char *));
-  }
+  // Replays anything still undelivered from before the reboot, in order
+  webhookOutbox.begin();
 
   if (webhookTaskHandle == nullptr)
   {
@@ -135,6 +140,8 @@ void NetworkController::begin()
 
 void NetworkController::update()
 {
+  MetricScope scope(Metric::Network);
+
   if (_webServerRunning)
   {
     // This cleanup seems to be handled internally by ESPAsyncWebServer library
@@ -147,11 +154,12 @@ void NetworkController::update()
     _cleanupWebSocketClients();
     _lastWsCleanupTime = millis();
   }
+  scheduler.wakeAt(_lastWsCleanupTime + 30000);
 }
 
 bool NetworkController::isWiFiProvisioned()
 {
-  // Check for stored WiFi credentials
+  // Check for stored WiFi credentials (WiFiProvisioner writes them, so ask NVS)
   preferences.begin("network", true);
   String storedSSID = preferences.getString("ssid", "");
   preferences.end();
@@ -195,6 +203,7 @@ void NetworkController::reset()
     a2dp_sink.clean_last_connection();
     saveBluetoothPairedState(false);
   }
+  settings.commit(); // Don't leave a reset waiting in RAM
   Serial.println("Reset complete. WiFi credentials and paired state cleared.");
 }
 
@@ -263,11 +272,9 @@ void NetworkController::btConnectionStateCallback(esp_a2d_connection_state_t sta
 
 void NetworkController::saveBluetoothPairedState(bool paired)
 {
-  preferences.begin("network", false);
-  preferences.putBool("bt_paired", paired);
-  preferences.end();
+  settings.setBluetoothPaired(paired);
   btPaired = paired;
-  Serial.println("Bluetooth pairing state saved in NVS.");
+  Serial.println("Bluetooth pairing state saved.");
 }
 
 void NetworkController::bluetoothTask(void *param)
@@ -318,231 +325,273 @@ void NetworkController::bluetoothTask(void *param)
   }
 }
 
-void NetworkController::sendWebhookAction(const String &action, int durationSetMinutes, unsigned long actualElapsedSeconds)
+void NetworkController::sendWebhookAction(WebhookAction action, int durationSetMinutes, unsigned long actualElapsedSeconds)
 {
-  // Retrieve the pending project ID from the state machine
-  String pendingId = stateMachine.getPendingProjectId();
-  String payloadAction = action; // start, stop
-
-  // Map the firmware action to the webhook action
-  String webhookAction;
-  if (payloadAction == "start")
-  {
-    webhookAction = "start_timer";
-  }
-  else if (payloadAction == "stop") // "done" action is no longer passed here
-  {
-    webhookAction = "stop_timer";
-  }
-  else
-  {
-    Serial.printf("Warning: Unknown action type passed to sendWebhookAction: %s\n", payloadAction.c_str());
-    return;
-  }
-
-  // Find the project details using the ID
-  Project currentProject; // Default empty project
-  bool projectFound = false;
+  // Capture the event by value; nothing from here to the append touches the heap
+  uint32_t allocations = heapAllocationCount();
+  WebhookEvent event = {};
+  event.action = action;
+  event.durationSetMinutes = durationSetMinutes;
+  event.durationActualSeconds = action == WebhookAction::Stop ? actualElapsedSeconds : 0;
+  // Unix time once SNTP has synced (see _onWiFiEvent); before that time()
+  // counts from boot, and the server dates the event by its age instead
+  event.timestamp = time(nullptr);
+  event.uptimeSeconds = millis() / 1000;
+
+  // Copy in the project selected for this timer, if any
+  const String &pendingId = stateMachine.getPendingProjectId();
   if (!pendingId.isEmpty())
   {
-    const auto &allProjects = getProjectManagerInstance().getProjects();
-    for (const auto &p : allProjects)
+    ProjectManager &projects = getProjectManagerInstance();
+    const Project *project = projects.get(projects.findById(pendingId));
+    if (project != nullptr)
     {
-      if (p.device_project_id == pendingId)
-      {
-        currentProject = p;
-        projectFound = true;
-        break;
-      }
+      setWebhookEventProject(event, project->device_project_id.c_str(), project->name.c_str(), project->color.c_str());
     }
-    if (!projectFound)
+    else
     {
       Serial.printf("Warning: Could not find project details for pending ID: %s\n", pendingId.c_str());
-      // Continue without project details? Or return?
-      // Let's proceed but won't include project info in payload.
-      // Alternatively: return;
     }
   }
   else
   {
     Serial.println("No pending project ID found for webhook.");
-    // Proceed without project details if no ID was set (e.g., timer started w/o project)
-  }
-
-  // Create JSON payload
-  JsonDocument doc;
-  doc["action"] = webhookAction;
-
-  // Include project info only if found/relevant
-  if (projectFound)
-  {
-    doc["device_project_id"] = currentProject.device_project_id;
-    doc["project_name"] = currentProject.name;
-    doc["project_color"] = currentProject.color;
   }
+  webhookCaptureAllocs += heapAllocationCount() - allocations;
 
-  // Add duration info based on action
-  doc["duration_set_minutes"] = durationSetMinutes; // Always include set duration
-  if (webhookAction == "stop_timer")
+  // Persist before returning so the event survives a reboot or a WiFi outage
+  if (webhookOutbox.append(event))
   {
-    doc["duration_actual_seconds"] = actualElapsedSeconds; // Include actual duration only for stop
-  }
-
-  String jsonPayload;
-  serializeJson(doc, jsonPayload);
-
-  // Add payload to the queue
-  if (webhookQueue != nullptr)
-  {
-    char *payloadCopy = strdup(jsonPayload.c_str());
-    if (payloadCopy)
+    Serial.printf("Webhook %s added to outbox.\n", webhookActionName(action));
+    if (webhookTaskHandle != nullptr)
     {
-      if (xQueueSend(webhookQueue, &payloadCopy, pdMS_TO_TICKS(100)) != pdPASS)
-      {
-        Serial.println("Failed to send webhook payload to queue.");
-        free(payloadCopy);
-      }
-      else
-      {
-        Serial.println("Webhook payload added to queue.");
-      }
-    }
-    else
-    {
-      Serial.println("Failed to allocate memory for webhook payload copy.");
+      xTaskNotifyGive(webhookTaskHandle);
     }
   }
   else
   {
-    Serial.println("Webhook queue is not initialized.");
+    Serial.println("Failed to add webhook event to outbox.");
   }
 }
 
+// 2xx acknowledges an event. Other 4xx answers will not change on a retry, so
+// the event is dropped rather than blocking everything queued behind it. 409
+// is the server losing a race to create the event's project: it asks for a
+// retry.
+static bool isRetryableStatus(int status)
+{
+  return status < 400 || status >= 500 || status == 408 || status == 409 || status == 429;
+}
+
 void NetworkController::webhookTask(void *param)
 {
   NetworkController *self = static_cast<NetworkController *>(param);
-  char *action;
+  uint8_t attempt = 0;
 
   while (true)
   {
-    // Wait for a webhook action to arrive in the queue
-    if (xQueueReceive(self->webhookQueue, &action, portMAX_DELAY) == pdPASS)
+    // Sleep until sendWebhookAction() appends something, closing the
+    // connection once it has been idle for a while
+    if (self->webhookOutbox.pendingCount() == 0)
     {
-      Serial.println("Processing webhook action: " + String(action));
-
-      // Send the webhook request and check the response
-      bool success = self->sendWebhookRequest(String(action));
-      if (success)
+      TickType_t wait = portMAX_DELAY;
+      if (!self->webhookConnection.closeIfIdle() && self->webhookConnection.isOpen())
       {
-        Serial.println("Webhook action sent successfully.");
+        wait = pdMS_TO_TICKS(max((long)(self->webhookConnection.idleCloseTime() - millis()), 1L));
       }
-      else
+      ulTaskNotifyTake(pdTRUE, wait);
+      continue;
+    }
+
+    if (!self->isWiFiConnected() || self->webhookURL.isEmpty())
+    {
+      // Keep the events until there is somewhere to send them
+      vTaskDelay(pdMS_TO_TICKS(WEBHOOK_RETRY_BASE_MS));
+      continue;
+    }
+
+    if (self->deliverWebhooks())
+    {
+      attempt = 0;
+    }
+    else
+    {
+      uint32_t delayMs = WebhookOutbox::retryDelay(attempt);
+      if (attempt < 255)
       {
-        Serial.println("Failed to send webhook action.");
+        attempt++;
       }
+      self->webhookOutbox.recordRetry();
+      Serial.printf("Webhook delivery incomplete, retrying in %u ms.\n", delayMs);
+      vTaskDelay(pdMS_TO_TICKS(delayMs));
+    }
+  }
+}
 
-      free(action); // Free the allocated memory for action
+// POST bodies are built here, once per request, by the webhook task only
+static char webhookBody[WEBHOOK_BODY_SIZE];
+static_assert(WEBHOOK_BODY_SIZE >= WEBHOOK_EVENT_JSON_MAX + 2, "A batch must fit at least one event");
 
-      Serial.println("Finished processing webhook action.");
+bool NetworkController::deliverWebhooks()
+{
+  uint32_t seqs[WEBHOOK_BATCH_MAX];
+  uint8_t count = webhookOutbox.peekBatch(webhookBatch, seqs, webhookConnection.acceptsBatches() ? WEBHOOK_BATCH_MAX : 1);
+  if (count == 0)
+  {
+    // Events still pending means the log could not be read: back off and
+    // try again rather than spin on it or wait for the next capture
+    if (webhookOutbox.pendingCount() > 0)
+    {
+      Serial.println("Webhook outbox could not be read.");
+      return false;
     }
+    return true;
+  }
+  if (count > 1)
+  {
+    return sendWebhookBatch(webhookBatch, seqs, count);
+  }
 
-    // Small delay to yield
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+  Serial.printf("Processing webhook event %u: %s\n", seqs[0], webhookActionName(webhookBatch[0].action));
+  return settleWebhookEvent(seqs[0], sendWebhookRequest(webhookBatch[0], seqs[0]));
+}
+
+bool NetworkController::settleWebhookEvent(uint32_t seq, int status)
+{
+  if (status >= 200 && status < 300)
+  {
+    Serial.printf("Webhook event %u delivered.\n", seq);
+    webhookOutbox.ack(seq, true);
+    return true;
+  }
+  if (!isRetryableStatus(status))
+  {
+    Serial.printf("Webhook rejected with HTTP %d, dropping event %u.\n", status, seq);
+    webhookOutbox.ack(seq, false);
+    return true;
+  }
+  Serial.printf("Webhook event %u failed (%d), keeping it for a retry.\n", seq, status);
+  return false;
+}
+
+// Seconds since the event, by the uptime clock; unknown (-1) for one
+// replayed from before a reboot, when that clock started over
+int32_t NetworkController::webhookEventAge(const WebhookEvent &event, uint32_t seq)
+{
+  if (!webhookOutbox.isFromThisBoot(seq))
+  {
+    return -1;
   }
+  uint32_t now = millis() / 1000;
+  return now >= event.uptimeSeconds ? (int32_t)(now - event.uptimeSeconds) : 0;
 }
 
-bool NetworkController::sendWebhookRequest(const String &action)
+int NetworkController::sendWebhookRequest(const WebhookEvent &event, uint32_t seq)
 {
   if (webhookURL.isEmpty())
   {
     Serial.println("Webhook URL is not set. Cannot send action.");
-    return false;
+    return HTTPC_ERROR_CONNECTION_REFUSED;
   }
 
-  std::unique_ptr<WiFiClient> client;
-  if (webhookURL.startsWith("https://"))
+  if (apiKey.isEmpty())
   {
-    client.reset(new WiFiClientSecure());
-    if (!client)
-    {
-      Serial.println("Memory allocation for WiFiClientSecure failed.");
-      return false;
-    }
-    static_cast<WiFiClientSecure *>(client.get())->setInsecure(); // Not verifying server certificate
+    Serial.println("Warning: Sending webhook without API Key.");
+  }
+
+  uint32_t allocations = heapAllocationCount();
+  size_t length = serializeWebhookEvent(event, seq, webhookEventAge(event, seq), webhookBody, sizeof(webhookBody));
+  webhookSerializeAllocs += heapAllocationCount() - allocations;
+
+  Serial.printf("Sending webhook payload: %s\n", webhookBody);
+
+  // Send the POST request on the kept-alive connection
+  String response;
+  int httpResponseCode = webhookConnection.post(webhookURL, apiKey, webhookBody, length, &response);
+
+  if (httpResponseCode > 0)
+  {
+    Serial.println("HTTP Response code: " + String(httpResponseCode));
+    Serial.println("Response: " + response);
   }
   else
   {
-    client.reset(new WiFiClient());
-    if (!client)
-    {
-      Serial.println("Memory allocation for WiFiClient failed.");
-      return false;
-    }
+    Serial.println("Error in sending POST: " + String(httpResponseCode));
   }
 
-  HTTPClient http;
-  bool result = false;
-
-  if (http.begin(*client, webhookURL))
-  {
-    http.addHeader("Content-Type", "application/json");
+  return httpResponseCode;
+}
 
-    // Add Authorization header if API key exists
-    if (!apiKey.isEmpty())
+// Posts the events as one JSON array. The endpoint answers with one result per
+// item ({"results": [{"index", "status", ...}]}), applied in one transaction
+// but settled individually: delivered and rejected items leave the outbox,
+// the rest stay for the next round.
+bool NetworkController::sendWebhookBatch(const WebhookEvent events[], const uint32_t seqs[], uint8_t count)
+{
+  uint32_t allocations = heapAllocationCount();
+  size_t length = 0;
+  uint8_t sent = 0;
+  webhookBody[length++] = '[';
+  while (sent < count)
+  {
+    // Each event goes straight into the body, leaving room for the closing
+    // bracket; stop at the first one that does not fit
+    size_t at = length + (sent > 0 ? 1 : 0);
+    size_t written = serializeWebhookEvent(events[sent], seqs[sent], webhookEventAge(events[sent], seqs[sent]),
+                                           webhookBody + at, sizeof(webhookBody) - at - 1);
+    if (written == 0)
     {
-      http.addHeader("Authorization", "Bearer " + apiKey);
+      break;
     }
-    else
+    if (sent > 0)
     {
-      Serial.println("Warning: Sending webhook without API Key.");
+      webhookBody[length++] = ',';
     }
+    length += written;
+    sent++;
+  }
+  webhookBody[length++] = ']';
+  webhookBody[length] = '\0';
+  webhookSerializeAllocs += heapAllocationCount() - allocations;
 
-    // Parse the incoming action JSON
-    JsonDocument incomingDoc;
-    DeserializationError error = deserializeJson(incomingDoc, action);
-
-    if (error)
+  Serial.printf("Sending webhook batch of %u events (%u..%u)\n", sent, seqs[0], seqs[sent - 1]);
+  String response;
+  int status = webhookConnection.post(webhookURL, apiKey, webhookBody, length, &response);
+  if (status < 200 || status >= 300)
+  {
+    if (isRetryableStatus(status))
     {
-      Serial.printf("Failed to parse incoming action JSON: %s\n", error.c_str());
       return false;
     }
+    // Refused the array itself (400/413/415...); the events are fine one at a time
+    webhookConnection.refuseBatches();
+    return true;
+  }
 
-    // Create the final payload
-    JsonDocument outgoingDoc;
-    outgoingDoc["action"] = incomingDoc["action"];
-    outgoingDoc["timestamp"] = time(nullptr); // Current Unix timestamp
-    outgoingDoc["device_project_id"] = incomingDoc["device_project_id"];
-    outgoingDoc["project_name"] = incomingDoc["project_name"];
-    outgoingDoc["project_color"] = incomingDoc["project_color"];
-
-    String jsonPayload;
-    serializeJson(outgoingDoc, jsonPayload);
-
-    Serial.printf("Sending webhook payload: %s\n", jsonPayload.c_str());
-
-    // Send the POST request
-    int httpResponseCode = http.POST(jsonPayload);
-
-    if (httpResponseCode > 0)
-    {
-      String response = http.getString();
-      Serial.println("HTTP Response code: " + String(httpResponseCode));
-      Serial.println("Response: " + response);
-      result = true;
-    }
-    else
+  JsonDocument doc;
+  JsonArray results;
+  if (!deserializeJson(doc, response))
+  {
+    results = doc["results"].as<JsonArray>();
+  }
+  if (results.size() != sent)
+  {
+    // Accepted but with no per-item answer; treat the whole batch as delivered
+    Serial.printf("Webhook batch answered %d without %u results\n", status, sent);
+    webhookConnection.refuseBatches();
+    for (uint8_t i = 0; i < sent; i++)
     {
-      Serial.println("Error in sending POST: " + String(httpResponseCode));
+      settleWebhookEvent(seqs[i], status);
     }
-
-    http.end(); // Close the connection
+    return true;
   }
-  else
+
+  bool settled = true;
+  for (uint8_t i = 0; i < sent; i++)
   {
-    Serial.println("Unable to connect to server.");
+    settled &= settleWebhookEvent(seqs[i], results[i]["status"] | 500);
   }
-
-  return result;
+  return settled;
 }
 
 void NetworkController::WiFiProvisionerSettings()
@@ -644,12 +693,8 @@ bool NetworkController::validateInput(const String &input)
   if (modifiedInput.isEmpty())
   {
     Serial.println("Webhook URL is empty, clearing saved URL.");
-    if (preferences.begin("focusdial", false))
-    {
-      preferences.remove("webhook_url");
-      preferences.end();
-      webhookURL = "";
-    }
+    settings.setWebhookUrl("");
+    webhookURL = "";
     return true; // Allow saving an empty URL
   }
 
@@ -681,23 +726,13 @@ bool NetworkController::validateInput(const String &input)
   // Save URL to NVS here if valid
   if (isValid)
   {
-    Serial.println("URL is valid. Saving to NVS...");
-
-    if (preferences.begin("focusdial", false))
-    { // false means open for writing
-      preferences.putString("webhook_url", modifiedInput);
-      preferences.end();
-      webhookURL = modifiedInput;
-      Serial.println("Webhook URL saved: " + webhookURL);
-    }
-    else
-    {
-      Serial.println("Failed to open NVS for writing.");
-    }
+    settings.setWebhookUrl(modifiedInput); // Written behind by the settings store
+    webhookURL = modifiedInput;
+    Serial.println("Webhook URL saved: " + webhookURL);
   }
   else
   {
-    Serial.println("Invalid URL. Not saving to NVS.");
+    Serial.println("Invalid URL. Not saving.");
   }
 
   return isValid;
@@ -757,13 +792,20 @@ void NetworkController::_setupWebServerRoutes()
   _server.on("/api/apikey", HTTP_POST, std::bind(&NetworkController::handleUpdateApiKey, this, std::placeholders::_1));
   Serial.println("Route registered: POST /api/apikey");
 
+  // Loop latency histograms and scheduler stats
+  _server.on("/api/metrics", HTTP_GET, std::bind(&NetworkController::handleGetMetrics, this, std::placeholders::_1));
+  Serial.println("Route registered: GET /api/metrics");
+
   // --- Then Serve Static Files ---
-  _server.on("/", HTTP_GET, [](AsyncWebServerRequest *request)
-             { request->send(LittleFS, "/index.html", "text/html"); });
+  // Built by firmware/tools/build_web.py: only the page is revalidated, the
+  // assets it names are content-hashed and cached for good. Nothing else on
+  // LittleFS (the project catalog, the webhook outbox) is reachable.
+  _server.on("/", HTTP_GET, std::bind(&NetworkController::handleGetIndex, this, std::placeholders::_1));
+  _server.on("/index.html", HTTP_GET, std::bind(&NetworkController::handleGetIndex, this, std::placeholders::_1));
   Serial.println("Route registered: GET / (index.html)");
-  _server.serveStatic("/", LittleFS, "/")
-      .setDefaultFile("index.html");
-  Serial.println("Route registered: serveStatic('/')");
+  _server.serveStatic(WEB_ASSETS_PATH, LittleFS, WEB_ASSETS_PATH)
+      .setCacheControl("public, max-age=31536000, immutable");
+  Serial.println("Route registered: serveStatic('" WEB_ASSETS_PATH "')");
 
   // --- Not Found Handler (Must be Last) ---
   _server.onNotFound([](AsyncWebServerRequest *request)
@@ -846,6 +888,8 @@ void NetworkController::_onWiFiEvent(WiFiEvent_t event)
     Serial.println("WiFi connected (SYSTEM_EVENT_STA_GOT_IP)");
     Serial.print("IP address: ");
     Serial.println(WiFi.localIP());
+    // Real timestamps for webhook events from here on (UTC)
+    configTime(0, 0, "pool.ntp.org", "time.google.com");
     if (instance)
     {
       Serial.println("Calling _startWebServer()...");
@@ -872,28 +916,313 @@ void NetworkController::_onWiFiEvent(WiFiEvent_t event)
     // Serial.printf("Unhandled WiFi Event: %d\n", event);
     break;
   }
+
+  // Connectivity is shown on screen; let the loop redraw now
+  scheduler.wake();
 }
 
 // --- API Handler Implementations ---
 
-void NetworkController::handleGetProjects(AsyncWebServerRequest *request)
+// Longest project object: every byte of name and id escaped as \u00XX
+#define PROJECT_JSON_MAX (64 + 6 * (MAX_PROJECT_NAME_BYTES + 255 + 7))
+
+// A JSON response written a piece at a time into whatever room each chunk
+// of the response has; nextPiece() sets finished with the last one, or
+// failed, leaving the piece empty, when the catalog could not be read
+class ProjectJsonStream
 {
-  JsonDocument doc; // Adjust size dynamically if needed, or use JsonDocument
-  JsonArray array = doc.to<JsonArray>();
+public:
+  ProjectJsonStream() : finished(false), failed(false), length(0), offset(0) {}
+  virtual ~ProjectJsonStream() {}
+
+  bool hasFailed() const { return failed; }
 
-  const auto &projects = getProjectManagerInstance().getProjects();
-  for (const auto &project : projects)
+  size_t fill(uint8_t *buffer, size_t maxLen)
   {
-    JsonObject obj = array.add<JsonObject>();
-    obj["name"] = project.name;
-    obj["color"] = project.color;
-    // Always include the device_project_id (should exist for all projects going forward)
-    obj["device_project_id"] = project.device_project_id;
+    size_t written = 0;
+    while (written < maxLen)
+    {
+      if (offset == length)
+      {
+        if (finished || failed)
+        {
+          break;
+        }
+        nextPiece();
+        offset = 0;
+      }
+      size_t count = min(length - offset, maxLen - written);
+      memcpy(buffer + written, piece + offset, count);
+      offset += count;
+      written += count;
+    }
+    return written;
   }
 
-  String responseJson;
-  serializeJson(doc, responseJson);
-  request->send(200, "application/json", responseJson);
+protected:
+  bool finished;
+  bool failed;
+  char piece[PROJECT_JSON_MAX];
+  size_t length; // Of piece
+
+  virtual void nextPiece() = 0;
+
+  static void writeProject(JsonWriter &json, const Project &project, bool first)
+  {
+    json.raw(first ? "{\"name\":" : ",{\"name\":");
+    json.string(project.name.c_str());
+    json.raw(",\"color\":");
+    json.string(project.color.c_str());
+    json.raw(",\"device_project_id\":");
+    json.string(project.device_project_id.c_str());
+    json.raw("}");
+  }
+
+private:
+  size_t offset; // Of piece, already handed out
+};
+
+// The project list as a JSON array. Only the cursor's page and one
+// serialized project are held, however long the list.
+class ProjectListStream : public ProjectJsonStream
+{
+public:
+  explicit ProjectListStream(ProjectManager &manager) : cursor(manager), started(false) {}
+
+private:
+  ProjectCursor cursor;
+  bool started;
+
+  // "[" and the first project, ",<project>" after that, and "]" to close
+  void nextPiece() override
+  {
+    bool more = started ? cursor.next() : cursor.seek(0);
+    if (!more && cursor.position() + 1 < cursor.count())
+    {
+      // Projects left that could not be read: the list must not look whole
+      Serial.println("Project list: Catalog read failed, aborting the response.");
+      failed = true;
+      length = 0;
+      return;
+    }
+    JsonWriter json(piece, sizeof(piece));
+    if (!started)
+    {
+      json.raw("[");
+    }
+    if (more)
+    {
+      writeProject(json, cursor.current(), !started);
+    }
+    else
+    {
+      json.raw("]");
+      finished = true;
+    }
+    started = true;
+    length = json.finish();
+  }
+};
+
+// What changed in the list after a revision the client synced at:
+//   {"journal":"<epoch>","revision":<now>,"full":false,
+//    "projects":[<added or edited>],"deleted":["<device_project_id>",...]}
+// The client keeps journal and revision for its next request. When the
+// journal doesn't reach back that far, or the client's journal is not this
+// one, "full" is true and projects is the whole list: the client drops
+// whatever isn't in it. The whole list walks the catalog by index, so a
+// change while it streams (a delete shifts every project after it) aborts
+// the response rather than leave a project out; the client asks again.
+class ProjectChangesStream : public ProjectJsonStream
+{
+public:
+  ProjectChangesStream(ProjectManager &manager, uint32_t since, bool sameJournal)
+      : manager(manager), cursor(manager), stage(Head), position(0), written(0)
+  {
+    epoch = manager.getRevisionEpoch();
+    full = !sameJournal || !manager.changedSince(since, changed, deleted, revision);
+    if (full)
+    {
+      revision = manager.getRevision(); // Taken before the first project is read
+    }
+  }
+
+private:
+  enum Stage
+  {
+    Head,
+    Projects,
+    Deleted
+  };
+
+  ProjectManager &manager;
+  ProjectCursor cursor; // Walks the list when full
+  std::vector<ProjectHandle> changed;
+  std::vector<String> deleted;
+  Project project; // Read buffer for changed projects
+  bool full;
+  uint32_t epoch;
+  uint32_t revision;
+  Stage stage;
+  size_t position; // In changed, then in deleted
+  size_t written;  // Projects so far
+
+  void nextPiece() override
+  {
+    JsonWriter json(piece, sizeof(piece));
+    switch (stage)
+    {
+    case Head:
+    {
+      char head[96];
+      snprintf(head, sizeof(head), "{\"journal\":\"%08lx\",\"revision\":%lu,\"full\":%s,\"projects\":[",
+               (unsigned long)epoch, (unsigned long)revision, full ? "true" : "false");
+      json.raw(head);
+      stage = Projects;
+      break;
+    }
+    case Projects:
+    {
+      const Project *next = nextProject();
+      if (failed)
+      {
+        length = 0;
+        return;
+      }
+      if (next != nullptr)
+      {
+        writeProject(json, *next, written++ == 0);
+        break;
+      }
+      json.raw("],\"deleted\":[");
+      stage = Deleted;
+      position = 0;
+      break;
+    }
+    case Deleted:
+      if (position < deleted.size())
+      {
+        json.raw(position == 0 ? "" : ",");
+        json.string(deleted[position++].c_str());
+        break;
+      }
+      json.raw("]}");
+      finished = true;
+      break;
+    }
+    length = json.finish();
+  }
+
+  const Project *nextProject()
+  {
+    if (full)
+    {
+      bool more = written == 0 ? cursor.seek(0) : cursor.next();
+      if (manager.getRevision() != revision)
+      {
+        Serial.println("Project changes: List changed while streaming, aborting the response.");
+        failed = true;
+        return nullptr;
+      }
+      if (!more && cursor.position() + 1 < cursor.count())
+      {
+        Serial.println("Project changes: Catalog read failed, aborting the response.");
+        failed = true;
+        return nullptr;
+      }
+      return more ? &cursor.current() : nullptr;
+    }
+    // One deleted since the changes were taken is left out; it's in the next delta
+    while (position < changed.size())
+    {
+      if (manager.read(changed[position++], project))
+      {
+        return &project;
+      }
+    }
+    return nullptr;
+  }
+};
+
+// The list's revision, qualified by its journal's epoch
+static void projectListETag(char *etag, size_t size)
+{
+  ProjectManager &manager = getProjectManagerInstance();
+  snprintf(etag, size, "\"%08lx-%lu\"", (unsigned long)manager.getRevisionEpoch(), (unsigned long)manager.getRevision());
+}
+
+// A stream that fails sends nothing more, not even the closing chunk, and
+// the connection is closed, so the client sees the body cut short rather
+// than valid JSON it could cache. The close waits for the server to ask
+// again (on the connection's next poll): the first call comes from within
+// send(), where closing would free the request under its handler.
+static AsyncWebServerResponse *beginProjectStream(AsyncWebServerRequest *request, std::shared_ptr<ProjectJsonStream> stream)
+{
+  return request->beginChunkedResponse("application/json", [request, stream](uint8_t *buffer, size_t maxLen, size_t index) -> size_t
+                                       {
+                                         if (stream->hasFailed())
+                                         {
+                                           request->client()->close();
+                                           return RESPONSE_TRY_AGAIN;
+                                         }
+                                         size_t written = stream->fill(buffer, maxLen);
+                                         return stream->hasFailed() ? RESPONSE_TRY_AGAIN : written; });
+}
+
+// The tag is taken before the first project is read, so a list edited while
+// it streams is never older than its tag; at worst the next request refetches
+static void sendProjectList(AsyncWebServerRequest *request, int code, const char *etag)
+{
+  AsyncWebServerResponse *response = beginProjectStream(request, std::make_shared<ProjectListStream>(getProjectManagerInstance()));
+  response->setCode(code);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache"); // Keep it, but check the tag every time
+  request->send(response);
+}
+
+// GET /api/projects?since=<revision>[&journal=<epoch>]
+static void sendProjectChanges(AsyncWebServerRequest *request)
+{
+  ProjectManager &manager = getProjectManagerInstance();
+  String since = request->getParam("since")->value();
+  char *end;
+  uint32_t revision = strtoul(since.c_str(), &end, 10);
+  if (since.isEmpty() || *end != '\0')
+  {
+    request->send(400, "application/json", "{\"error\":\"'since' must be a revision number\"}");
+    return;
+  }
+  bool sameJournal = true;
+  if (request->hasParam("journal"))
+  {
+    char epoch[9];
+    snprintf(epoch, sizeof(epoch), "%08lx", (unsigned long)manager.getRevisionEpoch());
+    sameJournal = request->getParam("journal")->value().equalsIgnoreCase(epoch);
+  }
+
+  AsyncWebServerResponse *response = beginProjectStream(request, std::make_shared<ProjectChangesStream>(manager, revision, sameJournal));
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
+void NetworkController::handleGetProjects(AsyncWebServerRequest *request)
+{
+  if (request->hasParam("since"))
+  {
+    sendProjectChanges(request);
+    return;
+  }
+
+  char etag[24];
+  projectListETag(etag, sizeof(etag));
+  if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == etag)
+  {
+    AsyncWebServerResponse *response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return;
+  }
+  sendProjectList(request, 200, etag);
 }
 
 void NetworkController::handleAddProject(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)
@@ -927,25 +1256,10 @@ void NetworkController::handleAddProject(AsyncWebServerRequest *request, uint8_t
     // Pass the JsonObject directly to the ProjectManager
     if (getProjectManagerInstance().addProject(projectData))
     {
-      // Fetch updated projects list (including the new one with its ID)
-      JsonDocument responseDoc;
-      JsonArray array = responseDoc.to<JsonArray>();
-      const auto &projects = getProjectManagerInstance().getProjects();
-      for (const auto &p : projects)
-      {
-        JsonObject obj = array.add<JsonObject>();
-        obj["name"] = p.name;
-        obj["color"] = p.color;
-        // Include the device ID in the response
-        if (!p.device_project_id.isEmpty())
-        {
-          obj["device_project_id"] = p.device_project_id;
-        }
-      }
-      String responseJson;
-      serializeJson(responseDoc, responseJson);
-      // Send 201 Created with the updated list
-      request->send(201, "application/json", responseJson);
+      // Send 201 Created with the updated list (including the new one with its ID)
+      char etag[24];
+      projectListETag(etag, sizeof(etag));
+      sendProjectList(request, 201, etag);
     }
     else
     {
@@ -1002,8 +1316,7 @@ void NetworkController::handleUpdateProjectPostRequest(AsyncWebServerRequest *re
     {
       Serial.printf("POST /api/updateProject Error: updateProject(%d) failed.\n", projectIndex);
       // Check if index was the reason for failure
-      const auto &projects = getProjectManagerInstance().getProjects();
-      if (projectIndex < 0 || projectIndex >= projects.size())
+      if (projectIndex < 0 || projectIndex >= getProjectManagerInstance().count())
       {
         request->send(404, "application/json", "{\"error\":\"Project index not found\"}");
       }
@@ -1033,22 +1346,12 @@ void NetworkController::handleDeleteProjectPostRequest(AsyncWebServerRequest *re
 
   Serial.printf("POST /api/deleteProject Request for index: %d\n", projectIndex);
 
-  const auto &projects = getProjectManagerInstance().getProjects();
-  Serial.printf("Currently %d projects in list before delete\n", projects.size());
-  for (size_t i = 0; i < projects.size(); i++)
-  {
-    Serial.printf("  Project[%d]: %s, %s\n", i, projects[i].name.c_str(), projects[i].color.c_str());
-  }
+  Serial.printf("Currently %d projects in list before delete\n", getProjectManagerInstance().count());
 
   bool deleted = getProjectManagerInstance().deleteProject(projectIndex);
   Serial.printf("deleteProject returned: %s\n", deleted ? "true" : "false");
 
-  const auto &updatedProjects = getProjectManagerInstance().getProjects();
-  Serial.printf("Now %d projects in list after delete\n", updatedProjects.size());
-  for (size_t i = 0; i < updatedProjects.size(); i++)
-  {
-    Serial.printf("  Project[%d]: %s, %s\n", i, updatedProjects[i].name.c_str(), updatedProjects[i].color.c_str());
-  }
+  Serial.printf("Now %d projects in list after delete\n", getProjectManagerInstance().count());
 
   if (deleted)
   {
@@ -1083,33 +1386,14 @@ void NetworkController::handleDeleteProjectByIdPostRequest(AsyncWebServerRequest
 
   Serial.printf("POST /api/deleteProjectById Request for ID: %s\n", deviceProjectId.c_str());
 
-  const auto &projects = getProjectManagerInstance().getProjects();
-  Serial.printf("Currently %d projects in list before delete\n", projects.size());
-
-  // Find and log the project we're going to delete (for debugging)
-  bool foundProject = false;
-  for (size_t i = 0; i < projects.size(); i++)
-  {
-    if (projects[i].device_project_id == deviceProjectId)
-    {
-      Serial.printf("Found project with ID %s: %s, %s\n",
-                    deviceProjectId.c_str(), projects[i].name.c_str(), projects[i].color.c_str());
-      foundProject = true;
-      break;
-    }
-  }
-
-  if (!foundProject)
-  {
-    Serial.printf("POST /api/deleteProjectById Warning: Project with ID %s not found in pre-delete check\n",
-                  deviceProjectId.c_str());
-  }
+  ProjectManager &manager = getProjectManagerInstance();
+  Serial.printf("Currently %d projects in list before delete\n", manager.count());
 
-  bool deleted = getProjectManagerInstance().deleteProjectById(deviceProjectId);
-  Serial.printf("deleteProjectById returned: %s\n", deleted ? "true" : "false");
+  // By its stable handle; deleteProjectById logs a miss
+  bool deleted = manager.deleteProjectById(deviceProjectId);
+  Serial.printf("deleteProject returned: %s\n", deleted ? "true" : "false");
 
-  const auto &updatedProjects = getProjectManagerInstance().getProjects();
-  Serial.printf("Now %d projects in list after delete\n", updatedProjects.size());
+  Serial.printf("Now %d projects in list after delete\n", manager.count());
 
   if (deleted)
   {
@@ -1180,13 +1464,8 @@ void NetworkController::handleUpdateWebhook(AsyncWebServerRequest *request, uint
 // New Handler: Get API Key Status
 void NetworkController::handleGetApiKeyStatus(AsyncWebServerRequest *request)
 {
-  // Check if the API key exists in NVS without reading its value
-  bool keyPresent = false;
-  if (preferences.begin("focusdial", true))
-  { // Read-only
-    keyPresent = preferences.isKey("api_key");
-    preferences.end();
-  }
+  // Whether a key was ever stored, without exposing its value
+  bool keyPresent = settings.hasApiKey();
 
   JsonDocument doc;
   doc["key_present"] = keyPresent;
@@ -1212,27 +1491,18 @@ void NetworkController::handleUpdateApiKey(AsyncWebServerRequest *request)
   Serial.println("Received POST request to /api/apikey");
 
   // Save the key (even if empty, to allow clearing)
-  if (preferences.begin("focusdial", false))
-  { // Read-write
-    preferences.putString("api_key", receivedKey);
-    preferences.end();
-    apiKey = receivedKey; // Update the in-memory copy as well
+  settings.setApiKey(receivedKey);
+  apiKey = receivedKey; // Update the in-memory copy as well
 
-    if (!receivedKey.isEmpty())
-    {
-      Serial.println("API Key saved successfully (partial): " + apiKey.substring(0, 5) + "...");
-    }
-    else
-    {
-      Serial.println("API Key cleared successfully.");
-    }
-    request->send(200, "application/json", "{\"message\":\"API Key updated successfully\"}");
+  if (!receivedKey.isEmpty())
+  {
+    Serial.println("API Key saved successfully (partial): " + apiKey.substring(0, 5) + "...");
   }
   else
   {
-    Serial.println("Failed to open NVS for writing API key.");
-    request->send(500, "application/json", "{\"error\":\"Failed to save API Key (NVS error)\"}");
+    Serial.println("API Key cleared successfully.");
   }
+  request->send(200, "application/json", "{\"message\":\"API Key updated successfully\"}");
 }
 
 // Implement WebSocket event handler
@@ -1243,64 +1513,92 @@ void NetworkController::_onWebSocketEvent(AsyncWebSocket *server, AsyncWebSocket
   {
   case WS_EVT_CONNECT:
     Serial.printf("WebSocket client #%u connected from %s\n", client->id(), client->remoteIP().toString().c_str());
+    client->setCloseClientOnQueueFull(true); // See _broadcastWebSocketMessage()
+    // The loop sends it where the timer stands
+    _stateSnapshotWanted = true;
+    scheduler.wake();
     break;
   case WS_EVT_DISCONNECT:
     Serial.printf("WebSocket client #%u disconnected\n", client->id());
     // Reset color when a client disconnects
-    handleColorReset();
+    colorPreviews.post(ColorPreviewAction::Reset, 0);
+    scheduler.wake();
     break;
   case WS_EVT_DATA:
-    // Handle data from the WebSocket client
-    if (len)
+  {
+    // Only whole text messages; ours are a few dozen bytes
+    AwsFrameInfo *info = (AwsFrameInfo *)arg;
+    if (len && info->final && info->index == 0 && info->len == len && info->opcode == WS_TEXT)
     {
-      String message = String((char *)data, len);
-      _handleWebSocketMessage(message, client->id());
+      _handleWebSocketMessage(data, len, client->id());
     }
     break;
+  }
   case WS_EVT_PONG:
   case WS_EVT_ERROR:
     break;
   }
 }
 
-// Implement the WebSocket message handler
-void NetworkController::_handleWebSocketMessage(const String &message, uint32_t clientId)
+// "#RRGGBB" -> 0x00RRGGBB
+static bool parseHexColor(const uint8_t *text, size_t len, uint32_t &color)
 {
-  Serial.printf("WebSocket message from client #%u: %s\n", clientId, message.c_str());
+  if (len != 7 || text[0] != '#')
+  {
+    return false;
+  }
+  color = 0;
+  for (size_t i = 1; i < len; i++)
+  {
+    uint8_t c = text[i];
+    uint8_t digit;
+    if (c >= '0' && c <= '9')
+      digit = c - '0';
+    else if (c >= 'a' && c <= 'f')
+      digit = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F')
+      digit = c - 'A' + 10;
+    else
+      return false;
+    color = color << 4 | digit;
+  }
+  return true;
+}
 
-  // Parse the message format: "action:value"
-  int separatorPos = message.indexOf(':');
-  if (separatorPos == -1)
+// Runs on the AsyncTCP task: parses "action:value" in place and posts it for
+// the loop, without allocating or waiting on anything
+void NetworkController::_handleWebSocketMessage(const uint8_t *data, size_t len, uint32_t clientId)
+{
+  const uint8_t *separator = (const uint8_t *)memchr(data, ':', len);
+  if (separator == nullptr)
   {
-    Serial.println("Invalid WebSocket message format");
+    Serial.printf("Invalid WebSocket message format from client #%u\n", clientId);
     return;
   }
+  size_t actionLength = separator - data;
+  const uint8_t *value = separator + 1;
+  size_t valueLength = len - actionLength - 1;
 
-  String action = message.substring(0, separatorPos);
-  String value = message.substring(separatorPos + 1);
-
-  if (action == "preview-color")
+  uint32_t color;
+  if (actionLength == 13 && memcmp(data, "preview-color", 13) == 0)
   {
-    // Check if the device is asleep
-    if (stateMachine.getCurrentState() == &StateMachine::sleepState)
+    if (!parseHexColor(value, valueLength, color))
     {
-      Serial.println("Device is asleep, waking up for color preview...");
-      stateMachine.changeState(&StateMachine::idleState);
-      // Small delay to allow state transition before setting color
-      delay(50);
+      Serial.printf("Invalid preview color from client #%u\n", clientId);
+      return;
     }
-    // Proceed with handling the color preview
-    handleColorPreview(value);
+    colorPreviews.post(ColorPreviewAction::Preview, color);
   }
-  else if (action == "reset-color")
+  else if (actionLength == 11 && memcmp(data, "reset-color", 11) == 0)
   {
-    // Handle reset, but don't wake the device just for reset
-    handleColorReset();
+    colorPreviews.post(ColorPreviewAction::Reset, 0);
   }
   else
   {
-    Serial.printf("Unknown WebSocket action: %s\n", action.c_str());
+    Serial.printf("Unknown WebSocket action from client #%u: %.*s\n", clientId, (int)actionLength, (const char *)data);
+    return;
   }
+  scheduler.wake();
 }
 
 // Implement WebSocket client cleanup
@@ -1310,24 +1608,111 @@ void NetworkController::_cleanupWebSocketClients()
   Serial.println("WebSocket clients cleaned up");
 }
 
-// Implement WebSocket broadcast
-void NetworkController::_broadcastWebSocketMessage(const String &message)
+// Loop task. AsyncWebSocket::textAll() walks the client list under the
+// library's lock, as clients come and go on the AsyncTCP task meanwhile.
+// A client that already has WS_MAX_QUEUED_MESSAGES frames unsent (a browser
+// tab in the background, a phone that lost WiFi) is closed by the library
+// instead of queued to, so a stuck client costs a few frames of RAM.
+// Browsers reconnect and are sent a fresh frame then.
+void NetworkController::_broadcastWebSocketMessage(const char *message, size_t len)
 {
-  _ws.textAll(message);
+  if (_ws.textAll(message, len) != AsyncWebSocket::ENQUEUED)
+  {
+    Serial.println("WebSocket client fell behind, closed it");
+    _wsClientsDropped++;
+  }
+}
+
+// Loop task, right after the state machine so a transition goes out in the
+// pass that made it. The frame is {"state":"Timer","project":"<id>",
+// "duration":1500,"elapsed":42}, in seconds; duration 0 counts up.
+void NetworkController::publishTimerState()
+{
+  const State *state = stateMachine.getCurrentState();
+  uint32_t durationSeconds;
+  uint32_t elapsedSeconds;
+  bool timer = stateMachine.getTimerProgress(durationSeconds, elapsedSeconds);
+  unsigned long now = millis();
+
+  bool snapshot = _stateSnapshotWanted.exchange(false);
+  bool changed = state != _statePublished;
+  bool tick = state == &StateMachine::timerState && elapsedSeconds != _elapsedPublished;
+  if (!snapshot && !changed && !tick)
+  {
+    return;
+  }
+  if (!snapshot && !changed && now - _statePublishedAt < WS_STATE_INTERVAL_MS)
+  {
+    // A transition went out less than a second ago; this second waits its turn
+    scheduler.wakeAt(_statePublishedAt + WS_STATE_INTERVAL_MS);
+    return;
+  }
+  _statePublished = state;
+  _elapsedPublished = elapsedSeconds;
+  _statePublishedAt = now;
+  if (_ws.count() == 0)
+  {
+    return;
+  }
+
+  auto write = [&](const char *project)
+  {
+    JsonWriter json(_stateFrame, sizeof(_stateFrame));
+    json.raw("{\"state\":");
+    json.string(StateMachine::getStateName(state));
+    json.raw(",\"project\":");
+    json.string(project);
+    json.raw(",\"duration\":");
+    json.number(durationSeconds);
+    json.raw(",\"elapsed\":");
+    json.number(elapsedSeconds);
+    json.raw("}");
+    return json.finish();
+  };
+  size_t len = write(timer ? stateMachine.getPendingProjectId().c_str() : "");
+  if (len == 0)
+  {
+    len = write(""); // An id too long for the frame
+  }
+  _broadcastWebSocketMessage(_stateFrame, len);
+  _stateFramesSent++;
+}
+
+// Loop task, before the LED frame is flushed: whatever preview arrived last
+// since the previous frame; the ones it superseded were never shown
+void NetworkController::applyColorPreview()
+{
+  ColorPreviewRequest request;
+  if (!colorPreviews.take(request))
+  {
+    return;
+  }
+  if (request.action == ColorPreviewAction::Preview)
+  {
+    handleColorPreview(request.color);
+  }
+  else
+  {
+    handleColorReset();
+  }
 }
 
 // Implement color preview handler that interfaces with the StateMachine
-void NetworkController::handleColorPreview(const String &hexColor)
+void NetworkController::handleColorPreview(uint32_t color)
 {
-  Serial.printf("Color preview requested: %s\n", hexColor.c_str());
+  // A preview wakes the device; on the loop task the state change is done
+  // before the color is set, so there is nothing to wait for
+  if (stateMachine.getCurrentState() == &StateMachine::sleepState)
+  {
+    Serial.println("Device is asleep, waking up for color preview...");
+    stateMachine.changeState(&StateMachine::idleState);
+  }
 
   // Allow preview only if in IdleState (or just woken up to IdleState)
   if (stateMachine.getCurrentState() == &StateMachine::idleState)
   {
     // Use the ledController to update the LEDs using the preview methods
-    ledController.setPreviewColor(hexColor); // This handles saving state and setting the solid color
-
-    Serial.printf("LED color preview set to: %s\n", hexColor.c_str());
+    ledController.setPreviewColor(color); // This handles saving state and setting the solid color
   }
   else
   {
@@ -1354,4 +1739,125 @@ void NetworkController::handleColorReset()
   {
     Serial.println("LED color preview reset (was not in Idle)");
   }
-}
\ No newline at end of file
+}
+
+void NetworkController::handleGetMetrics(AsyncWebServerRequest *request)
+{
+  JsonDocument doc;
+  JsonObject root = doc.to<JsonObject>();
+  root["uptime_ms"] = millis();
+  metrics.writeJson(root);
+
+  SchedulerStats stats = scheduler.getStats();
+  JsonObject sched = root["scheduler"].to<JsonObject>();
+  sched["idle_percent"] = scheduler.getIdlePercent();
+  sched["passes"] = stats.passes;
+  sched["timed_wakeups"] = stats.timedWakeups;
+  sched["event_wakeups"] = stats.eventWakeups;
+  sched["jitter_avg_us"] = stats.timedWakeups > 0 ? (uint32_t)(stats.jitterTotalUs / stats.timedWakeups) : 0;
+  sched["jitter_max_us"] = stats.jitterMaxUs;
+
+  JsonObject leds = root["leds"].to<JsonObject>();
+  leds["frames_shown"] = ledController.getFramesShown();
+  leds["frames_skipped"] = ledController.getFramesSkipped();
+  leds["shows_per_sec"] = millis() > 0 ? ledController.getFramesShown() * 1000.0f / millis() : 0.0f;
+  leds["previews_posted"] = colorPreviews.getPosted();
+  leds["previews_dropped"] = colorPreviews.getDropped();
+
+  JsonObject websocket = root["websocket"].to<JsonObject>();
+  websocket["clients"] = _ws.count();
+  websocket["state_frames"] = _stateFramesSent;
+  websocket["clients_dropped"] = _wsClientsDropped;
+
+  OledFlushStats flush = displayController.getFlushStats();
+  JsonObject display = root["display"].to<JsonObject>();
+  display["frames_rendered"] = displayController.getFramesRendered();
+  display["frames_skipped"] = displayController.getFramesSkipped();
+  display["presented"] = flush.presented;
+  display["flushes"] = flush.flushes;
+  display["flush_avg_us"] = flush.flushes > 0 ? (uint32_t)(flush.flushMicrosTotal / flush.flushes) : 0;
+  display["flush_max_us"] = flush.flushMicrosMax;
+  display["found_busy"] = flush.foundBusy;
+  display["dropped"] = flush.dropped;
+  display["errors"] = flush.errors;
+
+  JsonObject input = root["input"].to<JsonObject>();
+  input["dropped_edges"] = inputController.getDroppedEdges();
+  input["edge_high_water"] = inputController.getEdgeHighWater();
+
+  const WebhookOutboxStats &outbox = webhookOutbox.getStats();
+  JsonObject webhooks = root["webhooks"].to<JsonObject>();
+  webhooks["pending"] = webhookOutbox.pendingCount();
+  webhooks["delivered"] = outbox.delivered;
+  webhooks["rejected"] = outbox.rejected;
+  webhooks["retries"] = outbox.retries;
+  webhooks["dropped"] = outbox.dropped;
+  webhooks["replayed_at_boot"] = outbox.replayed;
+  webhooks["capture_allocs"] = webhookCaptureAllocs;
+  webhooks["serialize_allocs"] = webhookSerializeAllocs;
+
+  const WebhookConnectionStats &connection = webhookConnection.getStats();
+  const LatencyHistogram &latency = webhookConnection.getLatency();
+  webhooks["requests"] = connection.requests;
+  webhooks["handshakes"] = connection.handshakes;
+  webhooks["reused"] = connection.reused;
+  webhooks["reuse_ratio"] = webhookConnection.getReuseRatio();
+  webhooks["stale_retries"] = connection.staleRetries;
+  webhooks["p50_ms"] = latency.getPercentile(0.50f) / 1000;
+  webhooks["p99_ms"] = latency.getPercentile(0.99f) / 1000;
+  webhooks["max_ms"] = latency.getMax() / 1000;
+
+  String responseJson;
+  serializeJson(doc, responseJson);
+  request->send(200, "application/json", responseJson);
+}
+
+// FNV-1a of the stored page, so a new filesystem image changes the tag.
+// Hashed on the first request; the image can't change while we run.
+static const char *indexETag()
+{
+  static char etag[12] = "";
+  if (etag[0] == '\0')
+  {
+    File file = LittleFS.open(LittleFS.exists(WEB_INDEX_PATH) ? WEB_INDEX_PATH : WEB_INDEX_PATH ".gz", "r");
+    if (!file)
+    {
+      return nullptr;
+    }
+    uint32_t hash = 2166136261u;
+    uint8_t buffer[128];
+    size_t length;
+    while ((length = file.read(buffer, sizeof(buffer))) > 0)
+    {
+      for (size_t i = 0; i < length; i++)
+      {
+        hash = (hash ^ buffer[i]) * 16777619u;
+      }
+    }
+    file.close();
+    snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)hash);
+  }
+  return etag;
+}
+
+void NetworkController::handleGetIndex(AsyncWebServerRequest *request)
+{
+  const char *etag = indexETag();
+  if (etag == nullptr)
+  {
+    request->send(404, "text/plain", "Web UI not installed (pio run -t uploadfs)");
+    return;
+  }
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == etag)
+  {
+    response = request->beginResponse(304);
+  }
+  else
+  {
+    response = request->beginResponse(LittleFS, WEB_INDEX_PATH, "text/html");
+  }
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache"); // It names the current asset hashes
+  request->send(response);
+}
@@ -0,0 +1,285 @@
+#include "drivers/BufferedSSD1306.h"
+#include "Scheduler.h"
+
+// Data bytes per Wire transaction: its buffer less the control byte
+#ifdef I2C_BUFFER_LENGTH
+#define OLED_WIRE_CHUNK (I2C_BUFFER_LENGTH - 1)
+#else
+#define OLED_WIRE_CHUNK 31
+#endif
+
+BufferedSSD1306::BufferedSSD1306(uint8_t w, uint8_t h, TwoWire *twi, uint8_t address, uint32_t clock)
+    : Adafruit_SSD1306(w, h, twi, -1, clock, clock),
+      address(address),
+      front(nullptr),
+      task(nullptr),
+      job{0, 0, 0, 0},
+      waiting{0, 0, 0, 0},
+      frameWaiting(false),
+      flushing(false),
+      resend(false),
+      stats() {}
+
+BufferedSSD1306::~BufferedSSD1306()
+{
+  if (task != nullptr)
+  {
+    while (flushing)
+    {
+      vTaskDelay(1);
+    }
+    vTaskDelete(task);
+  }
+  free(front);
+}
+
+bool BufferedSSD1306::startFlushTask()
+{
+  if (task != nullptr)
+  {
+    return true;
+  }
+
+  // Address only: answers if Wire installed the IDF driver and the panel is there
+  i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link, sizeof(link));
+  i2c_master_start(cmd);
+  i2c_master_write_byte(cmd, address << 1 | I2C_MASTER_WRITE, true);
+  i2c_master_stop(cmd);
+  esp_err_t probe = i2c_master_cmd_begin(OLED_FLUSH_I2C_PORT, cmd, pdMS_TO_TICKS(OLED_FLUSH_TIMEOUT_MS));
+  i2c_cmd_link_delete_static(cmd);
+  if (probe != ESP_OK)
+  {
+    Serial.println("BufferedSSD1306: I2C driver did not answer, flushing synchronously");
+    return false;
+  }
+
+  size_t bytes = width() * ((height() + 7) / 8);
+  front = (uint8_t *)malloc(bytes);
+  if (front == nullptr)
+  {
+    Serial.println("BufferedSSD1306: Failed to allocate the front buffer");
+    return false;
+  }
+  memcpy(front, getBuffer(), bytes);
+
+  if (xTaskCreatePinnedToCore(flushTask, "OLED Flush", OLED_FLUSH_TASK_STACK, this, OLED_FLUSH_TASK_PRIORITY, &task,
+                              OLED_FLUSH_TASK_CORE) != pdPASS)
+  {
+    Serial.println("BufferedSSD1306: Failed to start the flush task");
+    free(front);
+    front = nullptr;
+    task = nullptr;
+    return false;
+  }
+  return true;
+}
+
+void BufferedSSD1306::present()
+{
+  present(Window{0, (int16_t)(width() - 1), 0, (int16_t)((height() + 7) / 8 - 1)});
+}
+
+void BufferedSSD1306::present(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  Window window;
+  if (clip(x, y, w, h, window))
+  {
+    present(window);
+  }
+}
+
+void BufferedSSD1306::present(const Window &window)
+{
+  stats.presented++;
+  if (front == nullptr)
+  {
+    unsigned long start = micros();
+    if (window.firstColumn == 0 && window.lastColumn == width() - 1 && window.firstPage == 0 &&
+        window.lastPage == (height() + 7) / 8 - 1)
+    {
+      display();
+    }
+    else
+    {
+      writeWindow(window);
+    }
+    recordFlush(micros() - start);
+    return;
+  }
+
+  if (frameWaiting)
+  {
+    stats.dropped++;
+    merge(waiting, window);
+  }
+  else
+  {
+    waiting = window;
+  }
+
+  // Flagged before looking at the task, which looks the other way round when
+  // it finishes, so one of the two always picks the frame up
+  frameWaiting = true;
+  if (flushing)
+  {
+    stats.foundBusy++;
+    return;
+  }
+  handOver();
+}
+
+void BufferedSSD1306::service()
+{
+  if ((frameWaiting || resend) && !flushing)
+  {
+    handOver();
+  }
+}
+
+OledFlushStats BufferedSSD1306::getFlushStats() const
+{
+  portENTER_CRITICAL(&statsLock);
+  OledFlushStats copy = stats;
+  portEXIT_CRITICAL(&statsLock);
+  return copy;
+}
+
+void BufferedSSD1306::recordFlush(uint32_t elapsed)
+{
+  portENTER_CRITICAL(&statsLock);
+  stats.flushes++;
+  stats.flushMicrosTotal += elapsed;
+  stats.flushMicrosMax = max(stats.flushMicrosMax, elapsed);
+  portEXIT_CRITICAL(&statsLock);
+}
+
+// The back buffer holds everything the front one did, so a window that
+// failed to go out is sent again from there
+void BufferedSSD1306::handOver()
+{
+  if (resend)
+  {
+    resend = false;
+    if (frameWaiting)
+    {
+      stats.dropped++; // The failed frame, superseded
+      merge(waiting, job);
+    }
+    else
+    {
+      waiting = job;
+    }
+  }
+  frameWaiting = false;
+  uint8_t *drawn = buffer;
+  buffer = front;
+  front = drawn;
+  memcpy(buffer, front, width() * ((height() + 7) / 8));
+  job = waiting;
+  flushing = true;
+  xTaskNotifyGive(task);
+}
+
+bool BufferedSSD1306::clip(int16_t x, int16_t y, int16_t w, int16_t h, Window &window) const
+{
+  window.firstColumn = max(x, (int16_t)0);
+  window.lastColumn = min((int16_t)(x + w), width()) - 1;
+  window.firstPage = max(y, (int16_t)0) / 8;
+  window.lastPage = (min((int16_t)(y + h), height()) - 1) / 8;
+  return window.lastColumn >= window.firstColumn && window.lastPage >= window.firstPage;
+}
+
+void BufferedSSD1306::merge(Window &into, const Window &window)
+{
+  into.firstColumn = min(into.firstColumn, window.firstColumn);
+  into.lastColumn = max(into.lastColumn, window.lastColumn);
+  into.firstPage = min(into.firstPage, window.firstPage);
+  into.lastPage = max(into.lastPage, window.lastPage);
+}
+
+// The bus is already at the panel's clock: begin() left it there
+void BufferedSSD1306::writeWindow(const Window &window)
+{
+  wire->beginTransmission(address);
+  wire->write((uint8_t)0x00); // Command stream
+  wire->write(SSD1306_COLUMNADDR);
+  wire->write((uint8_t)window.firstColumn);
+  wire->write((uint8_t)window.lastColumn);
+  wire->write(SSD1306_PAGEADDR);
+  wire->write((uint8_t)window.firstPage);
+  wire->write((uint8_t)window.lastPage);
+  wire->endTransmission();
+
+  // The controller fills the window a page at a time, left to right
+  for (int16_t page = window.firstPage; page <= window.lastPage; page++)
+  {
+    const uint8_t *data = buffer + page * width() + window.firstColumn;
+    int16_t remaining = window.lastColumn - window.firstColumn + 1;
+    while (remaining > 0)
+    {
+      int16_t chunk = min(remaining, (int16_t)OLED_WIRE_CHUNK);
+      wire->beginTransmission(address);
+      wire->write((uint8_t)0x40); // Data stream
+      wire->write(data, chunk);
+      wire->endTransmission();
+      data += chunk;
+      remaining -= chunk;
+    }
+  }
+}
+
+void BufferedSSD1306::flushTask(void *param)
+{
+  BufferedSSD1306 *oled = (BufferedSSD1306 *)param;
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    oled->transfer();
+  }
+}
+
+// The window, then all of its pages in one data transaction: the IDF driver
+// is not limited to Wire's buffer
+void BufferedSSD1306::transfer()
+{
+  unsigned long start = micros();
+  uint8_t commands[] = {0x00, // Command stream
+                        SSD1306_COLUMNADDR, (uint8_t)job.firstColumn, (uint8_t)job.lastColumn,
+                        SSD1306_PAGEADDR, (uint8_t)job.firstPage, (uint8_t)job.lastPage};
+  int16_t columns = job.lastColumn - job.firstColumn + 1;
+
+  i2c_cmd_handle_t cmd = i2c_cmd_link_create_static(link, sizeof(link));
+  i2c_master_start(cmd);
+  i2c_master_write_byte(cmd, address << 1 | I2C_MASTER_WRITE, true);
+  i2c_master_write(cmd, commands, sizeof(commands), true);
+  i2c_master_stop(cmd);
+  i2c_master_start(cmd);
+  i2c_master_write_byte(cmd, address << 1 | I2C_MASTER_WRITE, true);
+  i2c_master_write_byte(cmd, 0x40, true); // Data stream
+  for (int16_t page = job.firstPage; page <= job.lastPage; page++)
+  {
+    i2c_master_write(cmd, front + page * width() + job.firstColumn, columns, true);
+  }
+  i2c_master_stop(cmd);
+  esp_err_t result = i2c_master_cmd_begin(OLED_FLUSH_I2C_PORT, cmd, pdMS_TO_TICKS(OLED_FLUSH_TIMEOUT_MS));
+  i2c_cmd_link_delete_static(cmd);
+
+  if (result == ESP_OK)
+  {
+    recordFlush(micros() - start);
+  }
+  else
+  {
+    stats.errors++;
+  }
+
+  // Set before the task looks free, so the loop's next hand-over sees it.
+  // The retry waits for the loop's next pass: a panel that is gone must not
+  // have it spin.
+  resend = result != ESP_OK;
+  flushing = false;
+  if (frameWaiting)
+  {
+    scheduler.wake(); // So the loop hands it over now rather than at its next deadline
+  }
+}
@@ -0,0 +1,69 @@
+#include "drivers/NeoPixelRmt.h"
+
+// RMT clock: 80 MHz APB / 2 = 25 ns per tick
+#define RMT_CLOCK_DIVIDER 2
+#define T0H_TICKS 16 // 0.40 us
+#define T0L_TICKS 34 // 0.85 us
+#define T1H_TICKS 32 // 0.80 us
+#define T1L_TICKS 18 // 0.45 us
+
+NeoPixelRmt::NeoPixelRmt(uint8_t pin, uint16_t numLeds)
+    : pin(pin),
+      numLeds(min(numLeds, (uint16_t)NEOPIXEL_MAX_LEDS)),
+      ready(false) {}
+
+bool NeoPixelRmt::begin()
+{
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)pin, NEOPIXEL_RMT_CHANNEL);
+  config.clk_div = RMT_CLOCK_DIVIDER;
+  config.mem_block_num = NEOPIXEL_RMT_MEM_BLOCKS;
+
+  if (rmt_config(&config) != ESP_OK || rmt_driver_install(NEOPIXEL_RMT_CHANNEL, 0, 0) != ESP_OK)
+  {
+    Serial.println("NeoPixelRmt: Failed to set up RMT channel");
+    return false;
+  }
+  ready = true;
+  return true;
+}
+
+bool NeoPixelRmt::isBusy() const
+{
+  return ready && rmt_wait_tx_done(NEOPIXEL_RMT_CHANNEL, 0) != ESP_OK;
+}
+
+bool NeoPixelRmt::write(const uint32_t *colors, uint8_t brightness)
+{
+  if (!ready || isBusy())
+  {
+    return false;
+  }
+
+  // Same scaling as Adafruit_NeoPixel, which stores brightness + 1
+  uint16_t scale = (uint16_t)brightness + 1;
+  rmt_item32_t *item = items;
+  for (uint16_t i = 0; i < numLeds; i++)
+  {
+    uint32_t color = colors[i];
+    uint8_t grb[3] = {
+        (uint8_t)((((color >> 8) & 0xFF) * scale) >> 8),
+        (uint8_t)((((color >> 16) & 0xFF) * scale) >> 8),
+        (uint8_t)(((color & 0xFF) * scale) >> 8)};
+
+    for (uint8_t byte = 0; byte < 3; byte++)
+    {
+      for (uint8_t mask = 0x80; mask != 0; mask >>= 1)
+      {
+        bool one = grb[byte] & mask;
+        item->level0 = 1;
+        item->duration0 = one ? T1H_TICKS : T0H_TICKS;
+        item->level1 = 0;
+        item->duration1 = one ? T1L_TICKS : T0L_TICKS;
+        item++;
+      }
+    }
+  }
+
+  // Returns once the items are in RMT RAM; the line idles low for the latch
+  return rmt_write_items(NEOPIXEL_RMT_CHANNEL, items, numLeds * 24, false) == ESP_OK;
+}
@@ -2,6 +2,8 @@
 #include "Config.h"
 #include "StateMachine.h"
 #include "Controllers.h"
+#include "Scheduler.h"
+#include "Metrics.h"
 #include "managers/ProjectManager.h"
 
 // Global instances of controllers
@@ -9,7 +11,6 @@ DisplayController displayController(OLED_WIDTH, OLED_HEIGHT, OLED_ADDR);
 LEDController ledController(LED_PIN, NUM_LEDS, LED_BRIGHTNESS);
 InputController inputController(BUTTON_PIN, ENCODER_A_PIN, ENCODER_B_PIN);
 NetworkController networkController;
-Preferences preferences;
 ProjectManager projectManager;
 
 // --- Add static function to get the global instance ---
@@ -21,16 +22,20 @@ ProjectManager &getProjectManagerInstance()
 void setup()
 {
   Serial.begin(115200);
+  scheduler.begin();
+  metrics.begin();
 
-  // Initialize Project Manager first (loads data needed by others)
+  // Settings before anything that reads them
+  if (!settings.begin())
+  {
+    Serial.println("Failed to load settings, using defaults");
+  }
+
+  // Initialize Project Manager first (loads data needed by others). Without
+  // its data partition the timer still works, just with no projects.
   if (!projectManager.begin())
   {
-    Serial.println("FATAL: Failed to initialize Project Manager!");
-    // Optional: Enter a safe error state? Loop forever?
-    while (1)
-    {
-      delay(1000);
-    }
+    Serial.println("Failed to initialize Project Manager, continuing without projects");
   }
 
   // Initialize controllers
@@ -47,6 +52,24 @@ void loop()
 {
   // Update state machine
   stateMachine.update();
-  // If any animation needs to run
+  // Timer state out to the web UI's WebSocket clients
+  networkController.publishTimerState();
+  // Newest color preview from the web UI, into this frame
+  networkController.applyColorPreview();
+  // Frame tick for the LED ring
+  ledController.flush();
+  // If any animation needs to run, and a frame still waiting for the flush task
   displayController.updateAnimation();
+  // Settings changed a while ago and not yet written
+  settings.update();
+  // Serial console: 'm' dumps the loop latency histograms
+  if (Serial.available() > 0 && Serial.read() == 'm')
+  {
+    metrics.printReport();
+    scheduler.printStats();
+    ledController.printFrameStats();
+    displayController.printFlushStats();
+  }
+  // Block until the earliest deadline reported above, or an input/network wake-up
+  scheduler.sleep();
 }
@@ -0,0 +1,689 @@
+#include "managers/ProjectCatalog.h"
+#include <algorithm>
+
+#define PROJECT_CATALOG_MAGIC 0xFC
+#define PROJECT_CATALOG_VERSION 1
+#define PROJECT_PAGE_ID_LIMIT 0xFFFF
+#define PROJECT_INDEX_SCAN 8 // Entries left when the search switches to one sequential read
+
+struct __attribute__((packed)) CatalogDirectoryHeader
+{
+  uint8_t magic;
+  uint8_t version;
+  uint16_t nextPageId;
+  uint16_t pageCount; // CatalogPage entries that follow
+};
+
+static_assert(sizeof(CatalogPage) == 8, "CatalogPage is stored as is");
+
+bool packProjectColor(const String &color, uint8_t rgb[3])
+{
+  if (color.length() != 7 || color[0] != '#')
+  {
+    return false;
+  }
+  for (int i = 1; i < 7; i++)
+  {
+    if (!isxdigit((unsigned char)color[i]))
+    {
+      return false;
+    }
+  }
+  uint32_t value = strtoul(color.c_str() + 1, nullptr, 16);
+  rgb[0] = value >> 16;
+  rgb[1] = value >> 8;
+  rgb[2] = value;
+  return true;
+}
+
+static uint32_t hashProjectId(const String &deviceProjectId)
+{
+  uint32_t hash = 2166136261UL;
+  for (const char *c = deviceProjectId.c_str(); *c; c++)
+  {
+    hash = (hash ^ (uint8_t)*c) * 16777619UL;
+  }
+  return hash;
+}
+
+size_t encodeProjectRecord(const Project &project, uint8_t *record)
+{
+  ProjectRecordHeader *header = (ProjectRecordHeader *)record;
+  if (project.device_project_id.isEmpty() || project.device_project_id.length() > 255 ||
+      project.name.length() > MAX_PROJECT_NAME_BYTES || !packProjectColor(project.color, header->rgb))
+  {
+    return 0;
+  }
+  header->version = PROJECT_RECORD_VERSION;
+  header->idLength = project.device_project_id.length();
+  header->nameLength = project.name.length();
+  uint8_t *text = record + sizeof(ProjectRecordHeader);
+  memcpy(text, project.device_project_id.c_str(), header->idLength);
+  memcpy(text + header->idLength, project.name.c_str(), header->nameLength);
+  return sizeof(ProjectRecordHeader) + header->idLength + header->nameLength;
+}
+
+bool decodeProjectRecord(const uint8_t *record, size_t length, Project &project)
+{
+  const ProjectRecordHeader *header = (const ProjectRecordHeader *)record;
+  if (length < sizeof(ProjectRecordHeader) || header->version != PROJECT_RECORD_VERSION ||
+      length != sizeof(ProjectRecordHeader) + header->idLength + header->nameLength)
+  {
+    return false;
+  }
+  // Assigning in place keeps the Strings' buffers when a page is reread
+  const char *text = (const char *)(record + sizeof(ProjectRecordHeader));
+  project.device_project_id = "";
+  project.device_project_id.concat(text, header->idLength);
+  project.name = "";
+  project.name.concat(text + header->idLength, header->nameLength);
+  char color[8];
+  snprintf(color, sizeof(color), "#%02x%02x%02x", header->rgb[0], header->rgb[1], header->rgb[2]);
+  project.color = color;
+  return true;
+}
+
+ProjectCatalog::ProjectCatalog()
+    : total(0),
+      changes(0),
+      nextPageId(0),
+      indexEntries(0),
+      idLogCount(0),
+      stats{} {}
+
+bool ProjectCatalog::load()
+{
+  File file = DataFS.open(PROJECT_CATALOG_DIRECTORY_PATH, "r");
+  if (!file)
+  {
+    return false;
+  }
+  CatalogDirectoryHeader header;
+  bool ok = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == PROJECT_CATALOG_MAGIC && header.version == PROJECT_CATALOG_VERSION;
+  pages.clear();
+  if (ok)
+  {
+    pages.resize(header.pageCount);
+    size_t bytes = header.pageCount * sizeof(CatalogPage);
+    ok = file.read((uint8_t *)pages.data(), bytes) == bytes;
+  }
+  file.close();
+  if (!ok)
+  {
+    Serial.println("ProjectCatalog: Unreadable directory");
+    pages.clear();
+    return false;
+  }
+
+  nextPageId = header.nextPageId;
+  total = 0;
+  for (const CatalogPage &page : pages)
+  {
+    total += page.live;
+  }
+
+  file = DataFS.open(PROJECT_CATALOG_IDS_PATH, "r");
+  indexEntries = file ? file.size() / sizeof(IdEntry) : 0;
+  file.close();
+
+  // A torn last entry is dropped; its project is still listed, just slower to find
+  idLogCount = 0;
+  file = DataFS.open(PROJECT_CATALOG_IDS_LOG_PATH, "r");
+  while (file && idLogCount < PROJECT_ID_LOG_ENTRIES &&
+         file.read((uint8_t *)&idLog[idLogCount], sizeof(IdEntry)) == sizeof(IdEntry))
+  {
+    idLogCount++;
+  }
+  file.close();
+
+  changes++;
+  Serial.printf("ProjectCatalog: %u projects in %u pages\n", (unsigned)total, (unsigned)pages.size());
+  return true;
+}
+
+bool ProjectCatalog::create()
+{
+  pages.clear();
+  total = 0;
+  nextPageId = 0;
+  indexEntries = 0;
+  idLogCount = 0;
+  changes++;
+  DataFS.mkdir("/projects");
+  DataFS.remove(PROJECT_CATALOG_IDS_PATH);
+  DataFS.remove(PROJECT_CATALOG_IDS_LOG_PATH);
+  return writeDirectory();
+}
+
+ProjectLocation ProjectCatalog::locationOf(size_t index) const
+{
+  for (const CatalogPage &page : pages)
+  {
+    if (index >= page.live)
+    {
+      index -= page.live;
+      continue;
+    }
+    for (uint8_t slot = 0; slot < page.used; slot++)
+    {
+      if (!(page.deleted & (1UL << slot)) && index-- == 0)
+      {
+        return (uint32_t)page.id << 8 | slot;
+      }
+    }
+  }
+  return NO_PROJECT_LOCATION;
+}
+
+int ProjectCatalog::indexOf(ProjectLocation location) const
+{
+  if (!isLive(location))
+  {
+    return -1;
+  }
+  int page = pageOf(location >> 8);
+  int index = 0;
+  for (int i = 0; i < page; i++)
+  {
+    index += pages[i].live;
+  }
+  uint32_t before = (1UL << (location & 0xFF)) - 1;
+  return index + __builtin_popcount(before & ~pages[page].deleted);
+}
+
+bool ProjectCatalog::readPage(size_t index, ProjectPage &page)
+{
+  size_t first = 0;
+  size_t p = 0;
+  while (p < pages.size() && index >= first + pages[p].live)
+  {
+    first += pages[p].live;
+    p++;
+  }
+  if (p == pages.size())
+  {
+    return false;
+  }
+
+  const CatalogPage &entry = pages[p];
+  char path[24];
+  pagePath(entry.id, path);
+  File file = DataFS.open(path, "r");
+  if (!file)
+  {
+    Serial.printf("ProjectCatalog: Missing page %s\n", path);
+    return false;
+  }
+  stats.pageReads++;
+
+  uint8_t count = 0;
+  bool ok = true;
+  for (uint8_t slot = 0; slot < entry.used && ok; slot++)
+  {
+    size_t length;
+    ok = readRecord(file, recordBuffer, length);
+    if (ok && !(entry.deleted & (1UL << slot)))
+    {
+      ok = decodeProjectRecord(recordBuffer, length, page.projects[count]);
+      page.locations[count] = (uint32_t)entry.id << 8 | slot;
+      count++;
+    }
+  }
+  file.close();
+  if (!ok)
+  {
+    Serial.printf("ProjectCatalog: Unreadable page %s\n", path);
+    page.first = -1;
+    return false;
+  }
+  page.first = first;
+  page.count = count;
+  page.generation = changes;
+  return true;
+}
+
+bool ProjectCatalog::read(ProjectLocation location, Project &project)
+{
+  if (!isLive(location))
+  {
+    return false;
+  }
+  char path[24];
+  pagePath(location >> 8, path);
+  File file = DataFS.open(path, "r");
+  size_t length;
+  bool ok = file && seekSlot(file, location & 0xFF) && readRecord(file, recordBuffer, length) &&
+            decodeProjectRecord(recordBuffer, length, project);
+  file.close();
+  stats.pageReads++;
+  return ok;
+}
+
+ProjectLocation ProjectCatalog::find(const String &deviceProjectId)
+{
+  if (deviceProjectId.isEmpty())
+  {
+    return NO_PROJECT_LOCATION;
+  }
+  uint32_t hash = hashProjectId(deviceProjectId);
+  for (int i = idLogCount - 1; i >= 0; i--)
+  {
+    if (idLog[i].hash == hash && matches(idLog[i].location, deviceProjectId))
+    {
+      return idLog[i].location;
+    }
+  }
+  if (indexEntries == 0)
+  {
+    return NO_PROJECT_LOCATION;
+  }
+
+  File file = DataFS.open(PROJECT_CATALOG_IDS_PATH, "r");
+  if (!file)
+  {
+    return NO_PROJECT_LOCATION;
+  }
+  ProjectLocation found = NO_PROJECT_LOCATION;
+  IdEntry entry;
+  for (uint32_t at = lowerBound(file, hash);
+       at < indexEntries && file.seek(at * sizeof(IdEntry)) &&
+       file.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry) && entry.hash == hash;
+       at++)
+  {
+    // Usually the one entry with this hash; on a collision, each is checked
+    if (matches(entry.location, deviceProjectId))
+    {
+      found = entry.location;
+      break;
+    }
+  }
+  file.close();
+  return found;
+}
+
+ProjectLocation ProjectCatalog::append(const Project &project)
+{
+  size_t length = encodeProjectRecord(project, recordBuffer);
+  if (length == 0)
+  {
+    Serial.printf("ProjectCatalog: Project '%s' cannot be stored\n", project.name.c_str());
+    return NO_PROJECT_LOCATION;
+  }
+
+  bool newPage = pages.empty() || pages.back().used == PROJECT_PAGE_SLOTS;
+  if (newPage && nextPageId == PROJECT_PAGE_ID_LIMIT)
+  {
+    Serial.println("ProjectCatalog: Out of page ids");
+    return NO_PROJECT_LOCATION;
+  }
+  CatalogPage page = newPage ? CatalogPage{0, nextPageId, 0, 0} : pages.back();
+  ProjectLocation location = (uint32_t)page.id << 8 | page.used;
+  if (!logId(hashProjectId(project.device_project_id), location))
+  {
+    return NO_PROJECT_LOCATION;
+  }
+
+  char path[24];
+  pagePath(page.id, path);
+  File file = DataFS.open(path, "r");
+  bool clean = !file || (seekSlot(file, page.used) && file.position() == file.size());
+  file.close();
+  if (clean)
+  {
+    file = DataFS.open(path, newPage ? "w" : "a");
+  }
+  else
+  {
+    // A record cut short by a reset follows the last listed one: copy the
+    // page up to it and put the new record there
+    file = DataFS.open(path, "r");
+    File copy = DataFS.open(PROJECT_CATALOG_PAGE_TMP_PATH, "w");
+    uint8_t buffer[PROJECT_RECORD_MAX];
+    size_t recordLength;
+    for (uint8_t slot = 0; slot < page.used && copy; slot++)
+    {
+      if (!readRecord(file, buffer, recordLength) || copy.write(buffer, recordLength) != recordLength)
+      {
+        copy.close();
+        copy = File();
+      }
+    }
+    file.close();
+    file = copy;
+  }
+  bool ok = file && file.write(recordBuffer, length) == length;
+  file.close();
+  if (ok && !clean)
+  {
+    ok = DataFS.rename(PROJECT_CATALOG_PAGE_TMP_PATH, path);
+  }
+  if (!ok)
+  {
+    Serial.printf("ProjectCatalog: Failed to write %s\n", path);
+    return NO_PROJECT_LOCATION;
+  }
+
+  page.used++;
+  page.live++;
+  if (newPage)
+  {
+    pages.push_back(page);
+    nextPageId++;
+  }
+  else
+  {
+    pages.back() = page;
+  }
+  if (!writeDirectory())
+  {
+    // Not listed, so not there; the slot is written over next time
+    if (newPage)
+    {
+      pages.pop_back();
+      nextPageId--;
+    }
+    else
+    {
+      pages.back().used--;
+      pages.back().live--;
+    }
+    return NO_PROJECT_LOCATION;
+  }
+  total++;
+  changes++;
+  return location;
+}
+
+bool ProjectCatalog::update(ProjectLocation location, const Project &project)
+{
+  size_t length = encodeProjectRecord(project, recordBuffer);
+  if (length == 0 || !isLive(location))
+  {
+    return false;
+  }
+
+  // Records vary in length, so the page is rewritten and swapped in
+  const CatalogPage &page = pages[pageOf(location >> 8)];
+  char path[24];
+  pagePath(page.id, path);
+  File source = DataFS.open(path, "r");
+  File target = DataFS.open(PROJECT_CATALOG_PAGE_TMP_PATH, "w");
+  bool ok = source && target;
+  uint8_t buffer[PROJECT_RECORD_MAX];
+  for (uint8_t slot = 0; slot < page.used && ok; slot++)
+  {
+    size_t recordLength;
+    ok = readRecord(source, buffer, recordLength);
+    if (slot == (location & 0xFF))
+    {
+      ok = ok && target.write(recordBuffer, length) == length;
+    }
+    else
+    {
+      ok = ok && target.write(buffer, recordLength) == recordLength;
+    }
+  }
+  source.close();
+  target.close();
+  if (!ok || !DataFS.rename(PROJECT_CATALOG_PAGE_TMP_PATH, path))
+  {
+    Serial.printf("ProjectCatalog: Failed to rewrite %s\n", path);
+    DataFS.remove(PROJECT_CATALOG_PAGE_TMP_PATH);
+    return false;
+  }
+  changes++;
+  return true;
+}
+
+bool ProjectCatalog::remove(ProjectLocation location)
+{
+  if (!isLive(location))
+  {
+    return false;
+  }
+  int p = pageOf(location >> 8);
+  CatalogPage previous = pages[p];
+  pages[p].deleted |= 1UL << (location & 0xFF);
+  pages[p].live--;
+  bool emptied = pages[p].live == 0;
+  if (emptied)
+  {
+    pages.erase(pages.begin() + p);
+  }
+  if (!writeDirectory())
+  {
+    if (emptied)
+    {
+      pages.insert(pages.begin() + p, previous);
+    }
+    else
+    {
+      pages[p] = previous;
+    }
+    return false;
+  }
+  if (emptied)
+  {
+    char path[24];
+    pagePath(previous.id, path);
+    DataFS.remove(path);
+  }
+  // Its id entry goes stale and is dropped at the next merge
+  total--;
+  changes++;
+  return true;
+}
+
+int ProjectCatalog::pageOf(uint16_t id) const
+{
+  auto it = std::lower_bound(pages.begin(), pages.end(), id,
+                             [](const CatalogPage &page, uint16_t id)
+                             { return page.id < id; });
+  return it != pages.end() && it->id == id ? it - pages.begin() : -1;
+}
+
+bool ProjectCatalog::isLive(ProjectLocation location) const
+{
+  if (location == NO_PROJECT_LOCATION)
+  {
+    return false;
+  }
+  int p = pageOf(location >> 8);
+  uint8_t slot = location & 0xFF;
+  return p >= 0 && slot < pages[p].used && !(pages[p].deleted & (1UL << slot));
+}
+
+bool ProjectCatalog::writeDirectory()
+{
+  CatalogDirectoryHeader header = {PROJECT_CATALOG_MAGIC, PROJECT_CATALOG_VERSION, nextPageId, (uint16_t)pages.size()};
+  size_t bytes = pages.size() * sizeof(CatalogPage);
+  File file = DataFS.open(PROJECT_CATALOG_DIRECTORY_TMP_PATH, "w");
+  bool ok = file && file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            (bytes == 0 || file.write((const uint8_t *)pages.data(), bytes) == bytes);
+  file.close();
+  if (!ok || !DataFS.rename(PROJECT_CATALOG_DIRECTORY_TMP_PATH, PROJECT_CATALOG_DIRECTORY_PATH))
+  {
+    Serial.println("ProjectCatalog: Failed to write directory");
+    return false;
+  }
+  return true;
+}
+
+// Reads the record at the file position into buffer
+bool ProjectCatalog::readRecord(File &file, uint8_t *buffer, size_t &length)
+{
+  ProjectRecordHeader *header = (ProjectRecordHeader *)buffer;
+  if (file.read(buffer, sizeof(ProjectRecordHeader)) != sizeof(ProjectRecordHeader))
+  {
+    return false;
+  }
+  size_t text = header->idLength + header->nameLength;
+  length = sizeof(ProjectRecordHeader) + text;
+  return file.read(buffer + sizeof(ProjectRecordHeader), text) == text;
+}
+
+// Positions the file at a slot's record by stepping over the ones before it
+bool ProjectCatalog::seekSlot(File &file, uint8_t slot)
+{
+  ProjectRecordHeader header;
+  for (uint8_t i = 0; i < slot; i++)
+  {
+    if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+        !file.seek(header.idLength + header.nameLength, SeekCur))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ProjectCatalog::matches(ProjectLocation location, const String &deviceProjectId)
+{
+  if (!isLive(location))
+  {
+    return false;
+  }
+  char path[24];
+  pagePath(location >> 8, path);
+  File file = DataFS.open(path, "r");
+  size_t length;
+  const ProjectRecordHeader *header = (const ProjectRecordHeader *)recordBuffer;
+  bool ok = file && seekSlot(file, location & 0xFF) && readRecord(file, recordBuffer, length) &&
+            header->idLength == deviceProjectId.length() &&
+            memcmp(recordBuffer + sizeof(ProjectRecordHeader), deviceProjectId.c_str(), header->idLength) == 0;
+  file.close();
+  stats.pageReads++;
+  return ok;
+}
+
+bool ProjectCatalog::logId(uint32_t hash, ProjectLocation location)
+{
+  if (idLogCount == PROJECT_ID_LOG_ENTRIES && !mergeIdLog())
+  {
+    return false;
+  }
+  IdEntry entry = {hash, location};
+  File file = DataFS.open(PROJECT_CATALOG_IDS_LOG_PATH, "a");
+  bool ok = file && file.write((const uint8_t *)&entry, sizeof(entry)) == sizeof(entry);
+  file.close();
+  if (!ok)
+  {
+    Serial.println("ProjectCatalog: Failed to log project id");
+    return false;
+  }
+  idLog[idLogCount++] = entry;
+  return true;
+}
+
+// Streams the sorted index and the sorted log into a new index, dropping
+// entries whose project is gone, then swaps it in
+bool ProjectCatalog::mergeIdLog()
+{
+  std::sort(idLog, idLog + idLogCount, [](const IdEntry &a, const IdEntry &b)
+            { return a.hash < b.hash; });
+
+  File source = DataFS.open(PROJECT_CATALOG_IDS_PATH, "r");
+  File target = DataFS.open(PROJECT_CATALOG_IDS_TMP_PATH, "w");
+  if (!target)
+  {
+    Serial.println("ProjectCatalog: Failed to open index for merging");
+    return false;
+  }
+
+  uint32_t written = 0;
+  uint32_t read = 0;
+  uint8_t logged = 0;
+  IdEntry next;
+  bool haveNext = source && read < indexEntries && source.read((uint8_t *)&next, sizeof(next)) == sizeof(next);
+  bool ok = true;
+  while (ok && (haveNext || logged < idLogCount))
+  {
+    IdEntry entry;
+    if (haveNext && (logged == idLogCount || next.hash <= idLog[logged].hash))
+    {
+      entry = next;
+      read++;
+      haveNext = read < indexEntries && source.read((uint8_t *)&next, sizeof(next)) == sizeof(next);
+    }
+    else
+    {
+      entry = idLog[logged++];
+    }
+    if (isLive(entry.location))
+    {
+      ok = target.write((const uint8_t *)&entry, sizeof(entry)) == sizeof(entry);
+      written++;
+    }
+  }
+  source.close();
+  target.close();
+  if (!ok || !DataFS.rename(PROJECT_CATALOG_IDS_TMP_PATH, PROJECT_CATALOG_IDS_PATH))
+  {
+    Serial.println("ProjectCatalog: Failed to merge id index");
+    DataFS.remove(PROJECT_CATALOG_IDS_TMP_PATH);
+    return false;
+  }
+  DataFS.remove(PROJECT_CATALOG_IDS_LOG_PATH);
+  indexEntries = written;
+  idLogCount = 0;
+  stats.indexMerges++;
+  return true;
+}
+
+// First entry whose hash is >= hash. Each probe interpolates between the
+// hashes known to bound the range; when a probe fails to halve the range the
+// next one bisects, so a skewed run costs at most twice a binary search.
+uint32_t ProjectCatalog::lowerBound(File &file, uint32_t hash)
+{
+  uint32_t lo = 0;                // Entries before lo hash below the target
+  uint32_t hi = indexEntries;     // Entries from hi on hash at or above it
+  uint64_t loHash = 0;            // No entry in [lo, hi) hashes below this
+  uint64_t hiHash = 1ULL << 32;   // ... or at or above this
+  bool bisect = false;
+  IdEntry entry;
+  while (hi - lo > PROJECT_INDEX_SCAN)
+  {
+    uint32_t probe = bisect ? lo + (hi - lo) / 2
+                            : lo + (uint32_t)((hash - loHash) * (hi - lo) / (hiHash - loHash));
+    if (!file.seek(probe * sizeof(IdEntry)) || file.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry))
+    {
+      return indexEntries;
+    }
+    stats.indexReads++;
+    uint32_t before = hi - lo;
+    if (entry.hash < hash)
+    {
+      lo = probe + 1;
+      loHash = entry.hash;
+    }
+    else
+    {
+      hi = probe;
+      hiHash = (uint64_t)entry.hash + 1;
+    }
+    bisect = hi - lo > before / 2;
+  }
+
+  // The last few in one read
+  IdEntry block[PROJECT_INDEX_SCAN];
+  size_t bytes = (hi - lo) * sizeof(IdEntry);
+  if (bytes == 0 || !file.seek(lo * sizeof(IdEntry)) || file.read((uint8_t *)block, bytes) != bytes)
+  {
+    return lo;
+  }
+  stats.indexReads++;
+  for (uint32_t i = 0; i < hi - lo; i++)
+  {
+    if (block[i].hash >= hash)
+    {
+      return lo + i;
+    }
+  }
+  return hi;
+}
+
+void ProjectCatalog::pagePath(uint16_t id, char path[24])
+{
+  snprintf(path, 24, "/projects/p%04x.bin", id);
+}
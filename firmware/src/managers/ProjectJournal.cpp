@@ -0,0 +1,199 @@
+#include "managers/ProjectJournal.h"
+#include <esp_system.h>
+
+#define PROJECT_JOURNAL_MAGIC 0xFD
+#define PROJECT_JOURNAL_VERSION 1
+
+struct __attribute__((packed)) JournalHeader
+{
+  uint8_t magic;
+  uint8_t version;
+  uint32_t id;
+  uint32_t base; // The first entry's revision is base + 1
+};
+
+// Followed by the id; revisions run on by one from entry to entry
+struct __attribute__((packed)) JournalEntry
+{
+  uint32_t revision;
+  uint8_t idLength;
+};
+
+ProjectJournal::ProjectJournal() : journalId(0), base(0), current(0), entries(0) {}
+
+bool ProjectJournal::load()
+{
+  File file = DataFS.open(PROJECT_JOURNAL_PATH, "r");
+  if (!file)
+  {
+    return false;
+  }
+  JournalHeader header;
+  if (file.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+      header.magic != PROJECT_JOURNAL_MAGIC || header.version != PROJECT_JOURNAL_VERSION)
+  {
+    file.close();
+    Serial.println("ProjectJournal: Unreadable journal");
+    return false;
+  }
+
+  journalId = header.id;
+  base = header.base;
+  current = base;
+  entries = 0;
+  uint32_t bytes = sizeof(header); // Up to the end of the last good entry
+  JournalEntry entry;
+  char id[255];
+  while (file.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry) && entry.revision == current + 1 &&
+         entry.idLength > 0 && file.read((uint8_t *)id, entry.idLength) == entry.idLength)
+  {
+    current++;
+    entries++;
+    bytes += sizeof(entry) + entry.idLength;
+  }
+  bool torn = bytes != file.size();
+  file.close();
+
+  // Appending after a torn entry would bury every later one; cut it off
+  if (torn)
+  {
+    Serial.println("ProjectJournal: Dropping a torn entry");
+    if (!compact(entries))
+    {
+      return false;
+    }
+  }
+  Serial.printf("ProjectJournal: Revision %lu, %lu changes back\n", (unsigned long)current, (unsigned long)entries);
+  return true;
+}
+
+bool ProjectJournal::create()
+{
+  JournalHeader header = {PROJECT_JOURNAL_MAGIC, PROJECT_JOURNAL_VERSION, esp_random(), 1};
+  File file = DataFS.open(PROJECT_JOURNAL_PATH, "w");
+  bool ok = file && file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+  file.close();
+  if (!ok)
+  {
+    Serial.println("ProjectJournal: Failed to create journal");
+    return false;
+  }
+  journalId = header.id;
+  base = header.base;
+  current = base;
+  entries = 0;
+  return true;
+}
+
+bool ProjectJournal::record(const String &deviceProjectId)
+{
+  if (deviceProjectId.isEmpty() || deviceProjectId.length() > 255)
+  {
+    return false;
+  }
+  if (entries >= PROJECT_JOURNAL_MAX_ENTRIES && !compact(PROJECT_JOURNAL_KEEP))
+  {
+    return false;
+  }
+
+  uint8_t buffer[sizeof(JournalEntry) + 255];
+  JournalEntry *entry = (JournalEntry *)buffer;
+  entry->revision = current + 1;
+  entry->idLength = deviceProjectId.length();
+  memcpy(buffer + sizeof(JournalEntry), deviceProjectId.c_str(), entry->idLength);
+  size_t length = sizeof(JournalEntry) + entry->idLength;
+
+  File file = DataFS.open(PROJECT_JOURNAL_PATH, "a");
+  bool ok = file && file.write(buffer, length) == length;
+  file.close();
+  if (!ok)
+  {
+    Serial.println("ProjectJournal: Failed to record a change");
+    return false;
+  }
+  current++;
+  entries++;
+  return true;
+}
+
+bool ProjectJournal::changedSince(uint32_t since, std::vector<String> &deviceProjectIds)
+{
+  if (!covers(since))
+  {
+    return false;
+  }
+  File file = DataFS.open(PROJECT_JOURNAL_PATH, "r");
+  if (!file || !file.seek(sizeof(JournalHeader)))
+  {
+    file.close();
+    return false;
+  }
+
+  // Entries are in revision order; the ones up to since are read past
+  JournalEntry entry;
+  char id[255];
+  for (uint32_t i = 0; i < entries; i++)
+  {
+    if (file.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry) ||
+        file.read((uint8_t *)id, entry.idLength) != entry.idLength)
+    {
+      break;
+    }
+    if (entry.revision <= since)
+    {
+      continue;
+    }
+    String deviceProjectId;
+    deviceProjectId.concat(id, entry.idLength);
+    bool seen = false;
+    for (const String &other : deviceProjectIds)
+    {
+      if (other == deviceProjectId)
+      {
+        seen = true;
+        break;
+      }
+    }
+    if (!seen)
+    {
+      deviceProjectIds.push_back(deviceProjectId);
+    }
+  }
+  file.close();
+  return true;
+}
+
+// Copies the newest keep entries into a new file and swaps it in. Until the
+// rename lands, the old journal is intact.
+bool ProjectJournal::compact(uint32_t keep)
+{
+  File source = DataFS.open(PROJECT_JOURNAL_PATH, "r");
+  File target = DataFS.open(PROJECT_JOURNAL_TMP_PATH, "w");
+  JournalHeader header = {PROJECT_JOURNAL_MAGIC, PROJECT_JOURNAL_VERSION, journalId, current - keep};
+  bool ok = source && target && source.seek(sizeof(JournalHeader)) &&
+            target.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+
+  JournalEntry entry;
+  uint8_t id[255];
+  for (uint32_t i = 0; ok && i < entries; i++)
+  {
+    ok = source.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry) &&
+         source.read(id, entry.idLength) == entry.idLength;
+    if (ok && i >= entries - keep)
+    {
+      ok = target.write((const uint8_t *)&entry, sizeof(entry)) == sizeof(entry) &&
+           target.write(id, entry.idLength) == entry.idLength;
+    }
+  }
+  source.close();
+  target.close();
+  if (!ok || !DataFS.rename(PROJECT_JOURNAL_TMP_PATH, PROJECT_JOURNAL_PATH))
+  {
+    Serial.println("ProjectJournal: Failed to compact journal");
+    DataFS.remove(PROJECT_JOURNAL_TMP_PATH);
+    return false;
+  }
+  base = header.base;
+  entries = keep;
+  return true;
+}
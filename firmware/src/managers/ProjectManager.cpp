@@ -1,11 +1,12 @@
 #include "managers/ProjectManager.h"
+#include "managers/WebhookOutbox.h" // WEBHOOK_OUTBOX_MAX_FLASH
 #include <esp_system.h>  // For esp_efuse_mac_get_default
 #include <Preferences.h> // Ensure Preferences is included
+#include <algorithm>
 
-// --- Define the NVS keys declared as extern in ProjectData.h ---
+// --- Define the NVS key declared as extern in ProjectData.h ---
+// (the last selected project and the ID counter are kept by SettingsStore)
 const char *NVS_PROJECTS_KEY = "projects";
-const char *NVS_LAST_PROJECT_KEY = "lastProjIdx";
-const char *NVS_PROJECT_ID_COUNTER_KEY = "projIdCntr"; // Key for the ID counter
 
 // --- Helper function to get Chip ID as String ---
 String getChipId()
@@ -20,13 +21,102 @@ String getChipId()
 // Define the NVS namespace used by ProjectManager
 const char *PROJECT_MANAGER_NVS_NAMESPACE = "projects";
 
-ProjectManager::ProjectManager() : _lastProjectIndex(-1) // Initialize last index to -1 (invalid)
+// DataFS kept free past the catalog besides the outbox's share: the journal
+// growing to its cap and its compacted copy, the copy a page or the directory
+// is written to before its rename, and the block a new page takes
+#define PROJECT_FREE_RESERVE_BYTES (10 * DATA_FS_BLOCK_SIZE)
+
+// Valid name and color for a project to be stored
+static bool isStorableProject(const Project &project)
+{
+  uint8_t rgb[3];
+  return !project.name.isEmpty() && project.name.length() <= MAX_PROJECT_NAME_BYTES && packProjectColor(project.color, rgb);
+}
+
+// Holds the catalog mutex for the enclosing scope
+class ProjectLock
+{
+public:
+  explicit ProjectLock(SemaphoreHandle_t lock) : lock(lock), held(lock && xSemaphoreTake(lock, portMAX_DELAY) == pdTRUE) {}
+  ~ProjectLock()
+  {
+    if (held)
+    {
+      xSemaphoreGive(lock);
+    }
+  }
+
+private:
+  SemaphoreHandle_t lock;
+  bool held;
+};
+
+// --- ProjectCursor ---
+
+ProjectCursor::ProjectCursor(ProjectManager &manager) : _manager(manager), _position(-1) {}
+
+int ProjectCursor::count() const
+{
+  return _manager.count();
+}
+
+bool ProjectCursor::seek(int index)
+{
+  if (index < 0 || index >= count())
+  {
+    return false;
+  }
+  bool inPage = _page.first >= 0 && index >= _page.first && index < _page.first + _page.count &&
+                _page.generation == _manager._catalog.generation();
+  if (!inPage && !_manager._readPage(index, _page))
+  {
+    _position = -1;
+    return false;
+  }
+  _position = index;
+  return true;
+}
+
+bool ProjectCursor::next()
+{
+  return _position >= 0 && seek(_position + 1);
+}
+
+bool ProjectCursor::prev()
+{
+  return _position > 0 && seek(_position - 1);
+}
+
+ProjectHandle ProjectCursor::handle() const
+{
+  ProjectHandle handle;
+  if (_position >= 0)
+  {
+    handle.location = _page.locations[_position - _page.first];
+  }
+  return handle;
+}
+
+// --- ProjectManager ---
+
+ProjectManager::ProjectManager()
+    : _lock(nullptr),
+      _lookupLocation(NO_PROJECT_LOCATION),
+      _lookupGeneration(0)
 {
-  // Constructor - potentially initialize Preferences object here if needed
 }
 
 bool ProjectManager::begin()
 {
+  if (_lock == nullptr)
+  {
+    _lock = xSemaphoreCreateMutex();
+  }
+  if (!mountDataFS())
+  {
+    return false;
+  }
+
   // Open NVS namespace
   if (!_preferences.begin(PROJECT_MANAGER_NVS_NAMESPACE, false))
   {
@@ -35,34 +125,124 @@ bool ProjectManager::begin()
   }
   Serial.println("ProjectManager: NVS initialized.");
 
-  // Load data
-  bool loadProjectsOk = _loadProjectsFromNVS();
-  bool loadIndexOk = _loadLastIndexFromNVS();
-
+  // A project list still in NVS means the catalog was never (fully) built
+  bool loadProjectsOk = true;
+  bool migrate = _preferences.isKey(NVS_PROJECTS_KEY);
+  String legacyJson;
+  if (migrate)
+  {
+    legacyJson = _preferences.getString(NVS_PROJECTS_KEY, "");
+  }
   _preferences.end(); // Close NVS until needed again
-  return loadProjectsOk && loadIndexOk;
+
+  ProjectLock guard(_lock);
+  if (migrate)
+  {
+    ProjectList legacyProjects;
+    loadProjectsOk = _loadLegacyJson(legacyJson, legacyProjects) && _migrateProjects(legacyProjects);
+  }
+  else if (!_catalog.load())
+  {
+    Serial.println("ProjectManager: No project catalog, starting an empty one.");
+    loadProjectsOk = _catalog.create() && _journal.create();
+  }
+  else if (!_journal.load())
+  {
+    // Clients that synced against the old one get the whole list once
+    Serial.println("ProjectManager: No change journal, starting a new one.");
+    loadProjectsOk = _journal.create();
+  }
+  return loadProjectsOk;
 }
 
-const ProjectList &ProjectManager::getProjects() const
+uint32_t ProjectManager::getRevision() const
 {
-  return _projects;
+  ProjectLock guard(_lock); // A change is recorded just before it is made
+  return _journal.revision();
+}
+
+uint32_t ProjectManager::getRevisionEpoch() const
+{
+  ProjectLock guard(_lock);
+  return _journal.id();
+}
+
+bool ProjectManager::changedSince(uint32_t since, std::vector<ProjectHandle> &changed, std::vector<String> &deleted, uint32_t &revision)
+{
+  ProjectLock guard(_lock);
+  std::vector<String> ids;
+  if (!_journal.changedSince(since, ids))
+  {
+    return false;
+  }
+  for (const String &id : ids)
+  {
+    ProjectHandle handle;
+    handle.location = _catalog.find(id);
+    if (handle.isValid())
+    {
+      changed.push_back(handle);
+    }
+    else
+    {
+      deleted.push_back(id);
+    }
+  }
+  revision = _journal.revision();
+  return true;
+}
+
+bool ProjectManager::read(const ProjectHandle &handle, Project &project)
+{
+  ProjectLock guard(_lock);
+  return _catalog.read(handle.location, project);
+}
+
+int ProjectManager::count() const
+{
+  return _catalog.count();
 }
 
 int ProjectManager::getLastProjectIndex() const
 {
-  return _lastProjectIndex;
+  return settings.getLastProjectIndex();
 }
 
-// --- Modifiers ---
+ProjectHandle ProjectManager::findById(const String &deviceProjectId)
+{
+  ProjectLock guard(_lock);
+  ProjectHandle handle;
+  handle.location = _catalog.find(deviceProjectId);
+  return handle;
+}
 
-bool ProjectManager::addProject(const JsonObject &projectData)
+const Project *ProjectManager::get(const ProjectHandle &handle)
 {
-  if (_projects.size() >= MAX_PROJECTS)
+  ProjectLock guard(_lock);
+  if (handle.location != _lookupLocation || _lookupGeneration != _catalog.generation())
   {
-    Serial.println("ProjectManager: Max projects reached.");
-    return false;
+    // The same project is asked for again and again while its timer runs
+    _lookupLocation = NO_PROJECT_LOCATION;
+    if (!_catalog.read(handle.location, _lookup))
+    {
+      return nullptr;
+    }
+    _lookupLocation = handle.location;
+    _lookupGeneration = _catalog.generation();
   }
+  return &_lookup;
+}
+
+int ProjectManager::indexOf(const ProjectHandle &handle)
+{
+  ProjectLock guard(_lock);
+  return _catalog.indexOf(handle.location);
+}
 
+// --- Modifiers ---
+
+bool ProjectManager::addProject(const JsonObject &projectData)
+{
   // Validate incoming data
   if (!projectData.containsKey("name") || !projectData["name"].is<const char *>() ||
       !projectData.containsKey("color") || !projectData["color"].is<const char *>())
@@ -76,7 +256,7 @@ bool ProjectManager::addProject(const JsonObject &projectData)
   newProject.color = projectData["color"].as<String>();
 
   // Basic validation
-  if (newProject.name.isEmpty() || !newProject.color.startsWith("#") || newProject.color.length() != 7)
+  if (!isStorableProject(newProject))
   {
     Serial.println("ProjectManager: Invalid project format (name empty or invalid color).");
     return false;
@@ -92,77 +272,54 @@ bool ProjectManager::addProject(const JsonObject &projectData)
   Serial.printf("Generated Device Project ID: %s\n", newProject.device_project_id.c_str());
   // ----------------------------------
 
-  _projects.push_back(newProject);
-  return _saveProjectsToNVS();
-}
-
-bool ProjectManager::updateProject(int index, const Project &updatedData)
-{
-  if (index < 0 || index >= _projects.size())
+  // Checked under the lock so two adds cannot both take the last slot
+  ProjectLock guard(_lock);
+  if (!_hasRoomForProject())
   {
-    Serial.println("ProjectManager: Invalid index for update.");
+    Serial.println("ProjectManager: Data partition full, project not added.");
     return false;
   }
+  return _journal.record(newProject.device_project_id) && _catalog.append(newProject) != NO_PROJECT_LOCATION;
+}
 
+bool ProjectManager::updateProject(int index, const Project &updatedData)
+{
   // Basic validation on incoming data
-  if (updatedData.name.isEmpty() || !updatedData.color.startsWith("#") || updatedData.color.length() != 7)
+  if (!isStorableProject(updatedData))
   {
     Serial.println("ProjectManager: Invalid project data for update.");
     return false;
   }
 
-  // Preserve the existing device_project_id
-  String existingId = _projects[index].device_project_id;
-
-  // Assign new name and color
-  _projects[index].name = updatedData.name;
-  _projects[index].color = updatedData.color;
-
-  // Ensure the ID is kept (or assigned if it was somehow missing)
-  if (existingId.isEmpty())
+  ProjectLock guard(_lock);
+  ProjectLocation location = index >= 0 ? _catalog.locationOf(index) : NO_PROJECT_LOCATION;
+  Project project;
+  if (!_catalog.read(location, project))
   {
-    Serial.printf("ProjectManager: Warning - Project at index %d was missing ID. Generating new one.\n", index);
-    _projects[index].device_project_id = _generateNextDeviceId();
-    if (_projects[index].device_project_id.isEmpty())
-    {
-      Serial.println("ProjectManager: Failed to generate missing ID during update.");
-      return false; // Fail update if ID generation fails
-    }
-  }
-  else
-  {
-    _projects[index].device_project_id = existingId;
+    Serial.println("ProjectManager: Invalid index for update.");
+    return false;
   }
 
-  return _saveProjectsToNVS();
+  // Assign new name and color, keeping the device_project_id
+  project.name = updatedData.name;
+  project.color = updatedData.color;
+  return _journal.record(project.device_project_id) && _catalog.update(location, project);
 }
 
 bool ProjectManager::deleteProject(int index)
 {
-  if (index < 0 || index >= _projects.size())
+  ProjectLocation location;
+  {
+    ProjectLock guard(_lock);
+    location = index >= 0 ? _catalog.locationOf(index) : NO_PROJECT_LOCATION;
+  }
+  if (location == NO_PROJECT_LOCATION)
   {
     Serial.println("ProjectManager::deleteProject: Invalid index.");
     return false;
   }
   Serial.printf("ProjectManager::deleteProject: Deleting index %d\n", index);
-  _projects.erase(_projects.begin() + index);
-
-  // Adjust last selected index if it was the deleted item or after it
-  if (_lastProjectIndex == index)
-  {
-    Serial.println("ProjectManager::deleteProject: Resetting lastProjectIndex.");
-    setLastProjectIndex(-1); // Reset if deleted item was last selected
-  }
-  else if (_lastProjectIndex > index)
-  {
-    Serial.printf("ProjectManager::deleteProject: Decrementing lastProjectIndex from %d\n", _lastProjectIndex);
-    setLastProjectIndex(_lastProjectIndex - 1); // Decrement if after deleted item
-  }
-
-  Serial.println("ProjectManager::deleteProject: Calling _saveProjectsToNVS()...");
-  bool saveOk = _saveProjectsToNVS();
-  Serial.printf("ProjectManager::deleteProject: _saveProjectsToNVS() returned %s\n", saveOk ? "true" : "false");
-  return saveOk;
+  return _deleteLocation(location);
 }
 
 bool ProjectManager::deleteProjectById(const String &deviceProjectId)
@@ -173,52 +330,69 @@ bool ProjectManager::deleteProjectById(const String &deviceProjectId)
     return false;
   }
 
-  int indexToDelete = -1;
-
-  // Find the project with the matching ID
-  for (size_t i = 0; i < _projects.size(); i++)
+  ProjectHandle handle = findById(deviceProjectId);
+  if (!handle.isValid())
   {
-    if (_projects[i].device_project_id == deviceProjectId)
-    {
-      indexToDelete = i;
-      break;
-    }
+    Serial.printf("ProjectManager::deleteProjectById: No project found with ID %s\n", deviceProjectId.c_str());
+    return false;
   }
+  return _deleteLocation(handle.location);
+}
 
-  if (indexToDelete == -1)
+bool ProjectManager::_deleteLocation(ProjectLocation location)
+{
+  int index;
+  bool saveOk;
+  {
+    ProjectLock guard(_lock);
+    Project project; // For its id, to journal
+    index = _catalog.indexOf(location);
+    saveOk = index >= 0 && _catalog.read(location, project) && _journal.record(project.device_project_id) &&
+             _catalog.remove(location);
+  }
+  Serial.printf("ProjectManager::deleteProject: Saving returned %s\n", saveOk ? "true" : "false");
+  if (!saveOk)
   {
-    Serial.printf("ProjectManager::deleteProjectById: No project found with ID %s\n", deviceProjectId.c_str());
     return false;
   }
 
-  // Call the existing index-based delete method
-  return deleteProject(indexToDelete);
+  // Adjust last selected index if it was the deleted item or after it
+  int lastProjectIndex = settings.getLastProjectIndex();
+  if (lastProjectIndex == index)
+  {
+    Serial.println("ProjectManager::deleteProject: Resetting lastProjectIndex.");
+    setLastProjectIndex(-1); // Reset if deleted item was last selected
+  }
+  else if (lastProjectIndex > index)
+  {
+    Serial.printf("ProjectManager::deleteProject: Decrementing lastProjectIndex from %d\n", lastProjectIndex);
+    setLastProjectIndex(lastProjectIndex - 1); // Decrement if after deleted item
+  }
+  return true;
 }
 
 void ProjectManager::setLastProjectIndex(int index)
 {
-  _lastProjectIndex = index;
-  _saveLastIndexToNVS(); // Save immediately
+  settings.setLastProjectIndex(index); // Written behind, with the other settings
+}
+
+bool ProjectManager::_readPage(int index, ProjectPage &page)
+{
+  ProjectLock guard(_lock);
+  return _catalog.readPage(index, page);
 }
 
-// --- Private NVS Interaction Helpers ---
+// --- Migration from the NVS list ---
 
-bool ProjectManager::_loadProjectsFromNVS()
+bool ProjectManager::_loadLegacyJson(const String &jsonString, ProjectList &projects)
 {
-  // Note: Preferences opened in begin()
-  String jsonString = _preferences.getString(NVS_PROJECTS_KEY, "");
   if (jsonString.isEmpty())
   {
-    Serial.println("ProjectManager: No projects found in NVS.");
-    _projects.clear(); // Ensure list is empty
-    return true;       // Not an error if it's just empty
+    return true; // Not an error if it's just empty
   }
 
-  // Allocate JsonDocument - size needs estimation!
-  // TODO: Calculate a reasonable size based on MAX_PROJECTS
-  // DynamicJsonDocument doc(2048); // Example size - NEEDS TUNING!
-  JsonDocument doc; // Use stack-based JsonDocument for v7
   // The size is determined by the input string, but filter for safety
+  JsonDocument doc;
   JsonDocument filter;
   filter["name"] = true;
   filter["color"] = true;
@@ -231,125 +405,20 @@ bool ProjectManager::_loadProjectsFromNVS()
   {
     Serial.print("ProjectManager: deserializeJson() failed: ");
     Serial.println(error.c_str());
-    _projects.clear();
     return false;
   }
 
   if (!doc.is<JsonArray>())
   {
     Serial.println("ProjectManager: NVS data is not a JSON array.");
-    _projects.clear();
-    return false;
-  }
-
-  if (!_deserializeProjects(doc))
-  {
-    _projects.clear();
-    return false;
-  }
-
-  Serial.printf("ProjectManager: Loaded %d projects from NVS.\n", _projects.size());
-  return true;
-}
-
-bool ProjectManager::_saveProjectsToNVS()
-{
-  // DynamicJsonDocument doc(2048); // Example size - NEEDS TUNING!
-  // Calculate required size dynamically based on current projects
-  size_t requiredSize = JSON_ARRAY_SIZE(_projects.size());
-  for (const auto &p : _projects)
-  {
-    requiredSize += JSON_OBJECT_SIZE(2) + p.name.length() + p.color.length();
-  }
-  requiredSize += 256; // Add some buffer
-
-  JsonDocument doc;
-  if (!_serializeProjects(doc))
-  { // Pass by reference
-    return false;
-  }
-
-  String jsonString;
-  serializeJson(doc, jsonString);
-
-  if (!_preferences.begin(PROJECT_MANAGER_NVS_NAMESPACE, false))
-  {
-    Serial.println("ProjectManager: Failed to open NVS for saving projects!");
     return false;
   }
-  bool success = _preferences.putString(NVS_PROJECTS_KEY, jsonString);
-  _preferences.end();
 
-  if (success)
-  {
-    Serial.printf("ProjectManager: Saved %d projects to NVS.\n", _projects.size());
-  }
-  else
-  {
-    Serial.println("ProjectManager: Failed to save projects to NVS.");
-  }
-  return success;
-}
-
-bool ProjectManager::_loadLastIndexFromNVS()
-{
-  // Note: Preferences opened in begin()
-  _lastProjectIndex = _preferences.getInt(NVS_LAST_PROJECT_KEY, -1); // Default to -1 if not found
-  Serial.printf("ProjectManager: Loaded last project index: %d\n", _lastProjectIndex);
-  return true; // Getting default is not an error
-}
-
-bool ProjectManager::_saveLastIndexToNVS()
-{
-  if (!_preferences.begin(PROJECT_MANAGER_NVS_NAMESPACE, false))
-  {
-    Serial.println("ProjectManager: Failed to open NVS for saving index!");
-    return false;
-  }
-  bool success = _preferences.putInt(NVS_LAST_PROJECT_KEY, _lastProjectIndex);
-  _preferences.end();
-
-  if (success)
-  {
-    Serial.printf("ProjectManager: Saved last project index: %d\n", _lastProjectIndex);
-  }
-  else
-  {
-    Serial.println("ProjectManager: Failed to save last index to NVS.");
-  }
-  return success;
-}
-
-// --- Private JSON Helpers ---
-
-bool ProjectManager::_serializeProjects(JsonDocument &doc)
-{ // Accept by reference
-  JsonArray array = doc.to<JsonArray>();
-  for (const auto &project : _projects)
-  {
-    JsonObject obj = array.add<JsonObject>();
-    obj["name"] = project.name;
-    obj["color"] = project.color;
-    obj["device_project_id"] = project.device_project_id; // Always serialize
-  }
-  return true;
-}
-
-bool ProjectManager::_deserializeProjects(JsonDocument &doc)
-{
-  _projects.clear(); // Start with an empty list
   JsonArray array = doc.as<JsonArray>();
-
-  if (_projects.capacity() < array.size())
-  {
-    _projects.reserve(array.size());
-  }
-
-  bool needsSave = false; // Flag to check if we need to re-save NVS
-
+  projects.reserve(array.size());
   for (JsonObject obj : array)
   {
-    if (_projects.size() >= MAX_PROJECTS)
+    if (projects.size() >= MAX_NVS_PROJECTS)
     {
       Serial.println("ProjectManager: Max projects reached during NVS load.");
       break;
@@ -376,13 +445,24 @@ bool ProjectManager::_deserializeProjects(JsonDocument &doc)
           Serial.println("ProjectManager: CRITICAL - Failed to generate missing ID during deserialization. Skipping project.");
           continue; // Skip this project if ID generation fails
         }
-        needsSave = true; // Mark that we need to save the updated list
+      }
+
+      if (p.name.length() > MAX_PROJECT_NAME_BYTES)
+      {
+        // The binary record holds a one-byte length; cut on a UTF-8 boundary
+        unsigned int cut = MAX_PROJECT_NAME_BYTES;
+        while (cut > 0 && ((uint8_t)p.name[cut] & 0xC0) == 0x80)
+        {
+          cut--;
+        }
+        p.name = p.name.substring(0, cut);
+        Serial.printf("ProjectManager: Shortened project name to '%s'\n", p.name.c_str());
       }
 
       // Basic validation on load
-      if (!p.name.isEmpty() && p.color.startsWith("#") && p.color.length() == 7)
+      if (isStorableProject(p))
       {
-        _projects.push_back(p);
+        projects.push_back(p);
       }
       else
       {
@@ -395,34 +475,53 @@ bool ProjectManager::_deserializeProjects(JsonDocument &doc)
     }
   }
 
-  // If we generated any missing IDs, save the updated list back to NVS
-  if (needsSave)
-  {
-    Serial.println("ProjectManager: Saving projects back to NVS after generating missing IDs.");
-    _saveProjectsToNVS();
-  }
-
   return true;
 }
 
-String ProjectManager::_generateNextDeviceId()
+// Rebuilds the catalog from the old list, then drops the list from NVS.
+// Rerun from scratch if a reset cuts it short.
+bool ProjectManager::_migrateProjects(const ProjectList &projects)
 {
-  if (!_preferences.begin(PROJECT_MANAGER_NVS_NAMESPACE, false))
+  Serial.printf("ProjectManager: Migrating %u projects from NVS to the catalog...\n", (unsigned)projects.size());
+  if (!_catalog.create() || !_journal.create())
   {
-    Serial.println("ProjectManager: Failed to open NVS for generating ID!");
-    return ""; // Return empty string on failure
+    return false;
+  }
+  for (const Project &p : projects)
+  {
+    if (_catalog.append(p) == NO_PROJECT_LOCATION)
+    {
+      return false;
+    }
   }
 
-  // Get the current counter value, default to 0 if not found
-  uint32_t counter = _preferences.getUInt(NVS_PROJECT_ID_COUNTER_KEY, 0);
+  if (_preferences.begin(PROJECT_MANAGER_NVS_NAMESPACE, false))
+  {
+    _preferences.remove(NVS_PROJECTS_KEY);
+    _preferences.end();
+  }
+  Serial.printf("ProjectManager: Migrated %u projects.\n", (unsigned)projects.size());
+  return true;
+}
 
-  // Increment the counter for the next ID
-  counter++;
+// The catalog grows until the data partition is full, short of what the
+// outbox and the files the catalog rewrites need; merging new ids into the
+// index copies the whole index, so its size is kept free as well.
+bool ProjectManager::_hasRoomForProject()
+{
+  size_t reserve = WEBHOOK_OUTBOX_MAX_FLASH + PROJECT_FREE_RESERVE_BYTES + _catalog.indexBytes();
+  size_t total = DataFS.totalBytes();
+  return total > reserve && DataFS.usedBytes() <= total - reserve;
+}
 
-  // Save the updated counter back to NVS
-  bool saved = _preferences.putUInt(NVS_PROJECT_ID_COUNTER_KEY, counter);
+String ProjectManager::_generateNextDeviceId()
+{
+  // Increment the counter for the next ID
+  uint32_t counter = settings.getProjectIdCounter() + 1;
+  settings.setProjectIdCounter(counter);
 
-  _preferences.end(); // Close NVS
+  // Written through: an ID must be on flash before a project carries it
+  bool saved = settings.commit();
 
   if (!saved)
   {
@@ -0,0 +1,317 @@
+#include "managers/SettingsStore.h"
+#include "Config.h"
+#include "Scheduler.h"
+
+SettingsStore settings;
+
+static const struct
+{
+  const char *nvsNamespace;
+  const char *key;
+} SETTING_KEYS[] = {
+    {"focusdial", "timer"},       // KeyTimer
+    {"projects", "lastProjIdx"},  // KeyLastProject
+    {"projects", "projIdCntr"},   // KeyProjectIdCounter
+    {"network", "bt_paired"},     // KeyBluetoothPaired
+    {"focusdial", "webhook_url"}, // KeyWebhookUrl
+    {"focusdial", "api_key"},     // KeyApiKey
+};
+
+// Holds the settings mutex for the enclosing scope
+class SettingsLock
+{
+public:
+  explicit SettingsLock(SemaphoreHandle_t lock) : lock(lock), held(lock && xSemaphoreTake(lock, portMAX_DELAY) == pdTRUE) {}
+  ~SettingsLock()
+  {
+    if (held)
+    {
+      xSemaphoreGive(lock);
+    }
+  }
+
+private:
+  SemaphoreHandle_t lock;
+  bool held;
+};
+
+SettingsStore::SettingsStore()
+    : lock(nullptr),
+      timer(DEFAULT_TIMER),
+      lastProject(-1),
+      projectIdCounter(0),
+      bluetoothPaired(false),
+      apiKeyStored(false),
+      dirty(0),
+      lastChange(0),
+      stats{} {}
+
+bool SettingsStore::begin()
+{
+  if (lock == nullptr)
+  {
+    lock = xSemaphoreCreateMutex();
+  }
+  if (nvs_flash_init() != ESP_OK)
+  {
+    Serial.println("SettingsStore: NVS flash init failed");
+    return false;
+  }
+
+  SettingsLock guard(lock);
+  Preferences nvs;
+  if (nvs.begin("focusdial", true))
+  {
+    timer = nvs.getInt(SETTING_KEYS[KeyTimer].key, DEFAULT_TIMER);
+    webhookUrl = nvs.getString(SETTING_KEYS[KeyWebhookUrl].key, "");
+    apiKeyStored = nvs.isKey(SETTING_KEYS[KeyApiKey].key);
+    apiKey = nvs.getString(SETTING_KEYS[KeyApiKey].key, "");
+    nvs.end();
+  }
+  if (nvs.begin("projects", true))
+  {
+    lastProject = nvs.getInt(SETTING_KEYS[KeyLastProject].key, -1);
+    projectIdCounter = nvs.getUInt(SETTING_KEYS[KeyProjectIdCounter].key, 0);
+    nvs.end();
+  }
+  if (nvs.begin("network", true))
+  {
+    bluetoothPaired = nvs.getBool(SETTING_KEYS[KeyBluetoothPaired].key, false);
+    nvs.end();
+  }
+  dirty = 0;
+  return true;
+}
+
+int SettingsStore::getTimer() const
+{
+  SettingsLock guard(lock);
+  return timer;
+}
+
+void SettingsStore::setTimer(int minutes)
+{
+  SettingsLock guard(lock);
+  if (timer != minutes)
+  {
+    timer = minutes;
+    markDirty(KeyTimer);
+  }
+}
+
+int SettingsStore::getLastProjectIndex() const
+{
+  SettingsLock guard(lock);
+  return lastProject;
+}
+
+void SettingsStore::setLastProjectIndex(int index)
+{
+  SettingsLock guard(lock);
+  if (lastProject != index)
+  {
+    lastProject = index;
+    markDirty(KeyLastProject);
+  }
+}
+
+uint32_t SettingsStore::getProjectIdCounter() const
+{
+  SettingsLock guard(lock);
+  return projectIdCounter;
+}
+
+void SettingsStore::setProjectIdCounter(uint32_t counter)
+{
+  SettingsLock guard(lock);
+  if (projectIdCounter != counter)
+  {
+    projectIdCounter = counter;
+    markDirty(KeyProjectIdCounter);
+  }
+}
+
+bool SettingsStore::getBluetoothPaired() const
+{
+  SettingsLock guard(lock);
+  return bluetoothPaired;
+}
+
+void SettingsStore::setBluetoothPaired(bool paired)
+{
+  SettingsLock guard(lock);
+  if (bluetoothPaired != paired)
+  {
+    bluetoothPaired = paired;
+    markDirty(KeyBluetoothPaired);
+  }
+}
+
+String SettingsStore::getWebhookUrl() const
+{
+  SettingsLock guard(lock);
+  return webhookUrl;
+}
+
+void SettingsStore::setWebhookUrl(const String &url)
+{
+  SettingsLock guard(lock);
+  if (webhookUrl != url)
+  {
+    webhookUrl = url;
+    markDirty(KeyWebhookUrl);
+  }
+}
+
+String SettingsStore::getApiKey() const
+{
+  SettingsLock guard(lock);
+  return apiKey;
+}
+
+void SettingsStore::setApiKey(const String &key)
+{
+  SettingsLock guard(lock);
+  if (apiKey != key || !apiKeyStored)
+  {
+    apiKey = key;
+    apiKeyStored = true;
+    markDirty(KeyApiKey);
+  }
+}
+
+bool SettingsStore::hasApiKey() const
+{
+  SettingsLock guard(lock);
+  return apiKeyStored;
+}
+
+void SettingsStore::markDirty(Key key)
+{
+  stats.changes++;
+  if (dirty & (1 << key))
+  {
+    stats.coalesced++;
+  }
+  dirty |= 1 << key;
+  lastChange = millis();
+}
+
+void SettingsStore::update()
+{
+  unsigned long due;
+  {
+    SettingsLock guard(lock);
+    if (dirty == 0)
+    {
+      return;
+    }
+    due = lastChange + SETTINGS_COMMIT_DELAY_MS;
+  }
+  if ((long)(millis() - due) >= 0)
+  {
+    commit();
+  }
+  else
+  {
+    scheduler.wakeAt(due);
+  }
+}
+
+bool SettingsStore::commit()
+{
+  SettingsLock guard(lock);
+  if (dirty == 0)
+  {
+    return true;
+  }
+
+  // One pass per namespace, each opened once for all of its dirty keys
+  uint8_t pending = dirty;
+  uint8_t failed = 0;
+  while (pending != 0)
+  {
+    const char *nvsNamespace = nullptr;
+    Preferences nvs;
+    bool opened = false;
+    for (uint8_t key = 0; key < KeyCount; key++)
+    {
+      if (!(pending & (1 << key)))
+      {
+        continue;
+      }
+      if (nvsNamespace == nullptr)
+      {
+        nvsNamespace = SETTING_KEYS[key].nvsNamespace;
+        opened = nvs.begin(nvsNamespace, false);
+      }
+      else if (strcmp(nvsNamespace, SETTING_KEYS[key].nvsNamespace) != 0)
+      {
+        continue;
+      }
+      pending &= ~(1 << key);
+      if (opened && writeKey(nvs, (Key)key))
+      {
+        stats.keysWritten++;
+      }
+      else
+      {
+        failed |= 1 << key;
+      }
+    }
+    if (opened)
+    {
+      nvs.end();
+    }
+  }
+
+  stats.commits++;
+  dirty = failed;
+  if (failed != 0)
+  {
+    Serial.printf("SettingsStore: Failed to write settings (0x%02x), retrying later\n", failed);
+    stats.failures++;
+    lastChange = millis();
+    return false;
+  }
+  return true;
+}
+
+bool SettingsStore::writeKey(Preferences &nvs, Key key)
+{
+  const char *name = SETTING_KEYS[key].key;
+  switch (key)
+  {
+  case KeyTimer:
+    return nvs.putInt(name, timer) > 0;
+  case KeyLastProject:
+    return nvs.putInt(name, lastProject) > 0;
+  case KeyProjectIdCounter:
+    return nvs.putUInt(name, projectIdCounter) > 0;
+  case KeyBluetoothPaired:
+    return nvs.putBool(name, bluetoothPaired) > 0;
+  case KeyWebhookUrl:
+    if (webhookUrl.isEmpty())
+    {
+      return !nvs.isKey(name) || nvs.remove(name);
+    }
+    return nvs.putString(name, webhookUrl) > 0;
+  case KeyApiKey:
+    // An empty key is stored as such; its presence is what hasApiKey() reports
+    return nvs.putString(name, apiKey) == apiKey.length();
+  default:
+    return false;
+  }
+}
+
+bool SettingsStore::isDirty() const
+{
+  SettingsLock guard(lock);
+  return dirty != 0;
+}
+
+SettingsStats SettingsStore::getStats() const
+{
+  SettingsLock guard(lock);
+  return stats;
+}
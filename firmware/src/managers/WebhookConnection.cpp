@@ -0,0 +1,144 @@
+#include "managers/WebhookConnection.h"
+
+WebhookConnection::WebhookConnection()
+    : activeClient(nullptr),
+      lastUsed(0),
+      batchesAccepted(false),
+      batchesRefused(false),
+      stats{}
+{
+  static const char *collected[] = {WEBHOOK_BATCH_HEADER};
+  secureClient.setInsecure(); // Not verifying server certificate
+  http.setReuse(true);
+  http.collectHeaders(collected, 1);
+}
+
+int WebhookConnection::send(WiFiClient &client, const String &url, const String &bearerToken, const char *body, size_t length)
+{
+  if (!http.begin(client, url))
+  {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  http.setTimeout(WEBHOOK_HTTP_TIMEOUT_MS);
+  http.addHeader("Content-Type", "application/json");
+  if (!bearerToken.isEmpty())
+  {
+    http.addHeader("Authorization", "Bearer " + bearerToken);
+  }
+  return http.POST((uint8_t *)body, length);
+}
+
+int WebhookConnection::post(const String &url, const String &bearerToken, const char *body, size_t length, String *response)
+{
+  WiFiClient &client = url.startsWith("https://") ? (WiFiClient &)secureClient : plainClient;
+  if (activeClient != nullptr && (activeClient != &client || url != connectedUrl))
+  {
+    close(); // Different server; don't leave the old socket hanging
+  }
+  if (url != batchUrl)
+  {
+    batchUrl = url;
+    batchesAccepted = false;
+    batchesRefused = false;
+  }
+
+  unsigned long start = micros();
+  stats.requests++;
+  bool reusing = client.connected();
+  if (!reusing)
+  {
+    stats.handshakes++;
+  }
+
+  int status = send(client, url, bearerToken, body, length);
+  if (reusing && (status == HTTPC_ERROR_SEND_HEADER_FAILED || status == HTTPC_ERROR_SEND_PAYLOAD_FAILED))
+  {
+    // The server closed the kept-alive socket between requests and the request
+    // never left; try once on a new one. A failure after sending (a timeout, a
+    // lost connection) may have reached the server, so it is left to the
+    // outbox's backoff rather than repeated at once.
+    stats.staleRetries++;
+    stats.handshakes++;
+    http.end();
+    client.stop();
+    reusing = false;
+    status = send(client, url, bearerToken, body, length);
+  }
+
+  if (status > 0)
+  {
+    batchesAccepted = http.header(WEBHOOK_BATCH_HEADER) == "1";
+    String reply = http.getString(); // Drain the response so the socket can carry the next request
+    if (response != nullptr)
+    {
+      *response = reply;
+    }
+    if (reusing)
+    {
+      stats.reused++;
+    }
+  }
+  else
+  {
+    stats.failures++;
+  }
+  http.end(); // Keeps the connection when the server allowed keep-alive
+
+  latency.record(micros() - start);
+  lastUsed = millis();
+  activeClient = &client;
+  connectedUrl = url;
+
+  Serial.printf("Webhook: HTTP %d in %lu ms (%s connection)\n", status, (micros() - start) / 1000,
+                reusing ? "reused" : "new");
+  return status;
+}
+
+void WebhookConnection::close()
+{
+  if (activeClient != nullptr)
+  {
+    activeClient->stop();
+    activeClient = nullptr;
+  }
+  connectedUrl = "";
+}
+
+void WebhookConnection::refuseBatches()
+{
+  if (!batchesRefused)
+  {
+    Serial.println("Webhook: Endpoint did not handle a batch, sending events one at a time");
+  }
+  batchesRefused = true;
+}
+
+bool WebhookConnection::isOpen()
+{
+  return activeClient != nullptr && activeClient->connected();
+}
+
+unsigned long WebhookConnection::idleCloseTime() const
+{
+  return lastUsed + WEBHOOK_IDLE_CLOSE_MS;
+}
+
+bool WebhookConnection::closeIfIdle()
+{
+  if (activeClient == nullptr || millis() - lastUsed < WEBHOOK_IDLE_CLOSE_MS)
+  {
+    return false;
+  }
+  bool wasOpen = activeClient->connected();
+  close();
+  if (wasOpen)
+  {
+    Serial.println("Webhook: Closed idle connection");
+  }
+  return wasOpen;
+}
+
+float WebhookConnection::getReuseRatio() const
+{
+  return stats.requests > 0 ? (float)stats.reused / stats.requests : 0.0f;
+}
@@ -0,0 +1,86 @@
+#include "managers/WebhookEvent.h"
+#include "JsonWriter.h"
+#include <esp_system.h>
+
+// Copies at most size - 1 bytes, backing off so a multi-byte UTF-8 character
+// is never cut in half
+static void copyField(char *dest, size_t size, const char *src)
+{
+  size_t length = strnlen(src, size);
+  if (length >= size)
+  {
+    length = size - 1;
+    while (length > 0 && ((uint8_t)src[length] & 0xC0) == 0x80)
+    {
+      length--;
+    }
+  }
+  memcpy(dest, src, length);
+  dest[length] = '\0';
+}
+
+void setWebhookEventProject(WebhookEvent &event, const char *id, const char *name, const char *color)
+{
+  copyField(event.projectId, sizeof(event.projectId), id);
+  copyField(event.projectName, sizeof(event.projectName), name);
+  copyField(event.projectColor, sizeof(event.projectColor), color);
+}
+
+// The chip id (as in device project ids), read once
+static const char *chipId()
+{
+  static char id[13];
+  if (id[0] == '\0')
+  {
+    uint8_t mac[6];
+    esp_efuse_mac_get_default(mac);
+    snprintf(id, sizeof(id), "%02X%02X%02X%02X%02X%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+  }
+  return id;
+}
+
+const char *webhookActionName(WebhookAction action)
+{
+  return action == WebhookAction::Start ? "start_timer" : "stop_timer";
+}
+
+size_t serializeWebhookEvent(const WebhookEvent &event, uint32_t seq, int32_t ageSeconds, char *out, size_t size)
+{
+  char eventId[24];
+  snprintf(eventId, sizeof(eventId), "%s-%lu", chipId(), (unsigned long)seq);
+
+  JsonWriter json(out, size);
+  json.raw("{\"event_id\":");
+  json.string(eventId);
+  json.raw(",\"action\":");
+  json.string(webhookActionName(event.action));
+  json.raw(",\"timestamp\":");
+  json.number(event.timestamp);
+  if (ageSeconds >= 0)
+  {
+    json.raw(",\"age_seconds\":");
+    json.number((uint32_t)ageSeconds);
+  }
+  json.raw(",\"duration_set_minutes\":");
+  json.number(event.durationSetMinutes);
+  if (event.action == WebhookAction::Stop)
+  {
+    json.raw(",\"duration_actual_seconds\":");
+    json.number(event.durationActualSeconds);
+  }
+  if (event.projectId[0] != '\0')
+  {
+    json.raw(",\"device_project_id\":");
+    json.string(event.projectId);
+    json.raw(",\"project_name\":");
+    json.string(event.projectName);
+    json.raw(",\"project_color\":");
+    json.string(event.projectColor);
+  }
+  else
+  {
+    json.raw(",\"device_project_id\":null,\"project_name\":null,\"project_color\":null");
+  }
+  json.raw("}");
+  return json.finish();
+}
@@ -0,0 +1,394 @@
+#include "managers/WebhookOutbox.h"
+#include <esp_system.h>
+
+#define OUTBOX_RECORD_MAGIC 0xFD
+#define OUTBOX_RECORD_ACK 2   // No payload; seq is the event that left the outbox
+#define OUTBOX_RECORD_EVENT 3 // Payload is a WebhookEvent
+
+static_assert(sizeof(WebhookEvent) <= WEBHOOK_OUTBOX_MAX_PAYLOAD, "WebhookEvent must fit an outbox record");
+
+struct __attribute__((packed)) OutboxRecordHeader
+{
+  uint8_t magic;
+  uint8_t type;
+  uint16_t length;   // Payload bytes that follow the header
+  uint32_t seq;
+  uint32_t checksum; // FNV-1a over the header (with this field zero) and the payload
+};
+
+static uint32_t recordChecksum(OutboxRecordHeader header, const uint8_t *payload, uint16_t length)
+{
+  header.checksum = 0;
+  uint32_t hash = 2166136261UL;
+  const uint8_t *bytes = (const uint8_t *)&header;
+  for (size_t i = 0; i < sizeof(header); i++)
+  {
+    hash = (hash ^ bytes[i]) * 16777619UL;
+  }
+  for (uint16_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ payload[i]) * 16777619UL;
+  }
+  return hash;
+}
+
+// Holds the outbox mutex for the enclosing scope
+class OutboxLock
+{
+public:
+  explicit OutboxLock(SemaphoreHandle_t lock) : lock(lock), held(lock && xSemaphoreTake(lock, portMAX_DELAY) == pdTRUE) {}
+  ~OutboxLock()
+  {
+    if (held)
+    {
+      xSemaphoreGive(lock);
+    }
+  }
+  bool isHeld() const { return held; }
+
+private:
+  SemaphoreHandle_t lock;
+  bool held;
+};
+
+WebhookOutbox::WebhookOutbox()
+    : lock(nullptr),
+      head(0),
+      count(0),
+      nextSeq(1),
+      bootSeq(1),
+      logSize(0),
+      ready(false),
+      stats{} {}
+
+bool WebhookOutbox::begin()
+{
+  if (lock == nullptr)
+  {
+    lock = xSemaphoreCreateMutex();
+  }
+  OutboxLock guard(lock);
+  if (!guard.isHeld())
+  {
+    Serial.println("WebhookOutbox: Failed to create mutex");
+    return false;
+  }
+
+  if (!mountDataFS())
+  {
+    Serial.println("WebhookOutbox: No data partition, events will not survive a reboot");
+    return false;
+  }
+
+  head = 0;
+  count = 0;
+  ready = scanLog();
+  bootSeq = nextSeq;
+  stats.replayed = count;
+  if (count > 0)
+  {
+    Serial.printf("WebhookOutbox: %u event(s) pending from before reboot\n", count);
+  }
+  return ready;
+}
+
+// Rebuilds the pending list by replaying the log in order
+bool WebhookOutbox::scanLog()
+{
+  logSize = 0;
+  nextSeq = 0;
+  File file = DataFS.open(WEBHOOK_OUTBOX_PATH, "r");
+  if (!file)
+  {
+    nextSeq = firstSeq(); // Nothing logged yet
+    return true;
+  }
+
+  size_t fileSize = file.size();
+  uint32_t offset = 0;
+  OutboxRecordHeader header;
+  while (file.read((uint8_t *)&header, sizeof(header)) == sizeof(header))
+  {
+    if (header.magic != OUTBOX_RECORD_MAGIC || header.length > WEBHOOK_OUTBOX_MAX_PAYLOAD ||
+        file.read(payloadBuffer, header.length) != header.length ||
+        recordChecksum(header, payloadBuffer, header.length) != header.checksum)
+    {
+      break;
+    }
+
+    if (header.type == OUTBOX_RECORD_EVENT && header.length == sizeof(WebhookEvent))
+    {
+      if (count == WEBHOOK_OUTBOX_MAX_PENDING)
+      {
+        popHead();
+        stats.dropped++;
+      }
+      pushEntry(header.seq, offset, header.length);
+    }
+    else if (header.type == OUTBOX_RECORD_ACK)
+    {
+      removeEntry(header.seq);
+    }
+
+    if (header.seq >= nextSeq)
+    {
+      nextSeq = header.seq + 1;
+    }
+    offset += sizeof(header) + header.length;
+  }
+  file.close();
+  logSize = offset;
+  if (nextSeq == 0)
+  {
+    nextSeq = firstSeq(); // Emptied by a reset before its first record
+  }
+
+  if (offset < fileSize)
+  {
+    // A record cut short by a reset; keep everything before it
+    Serial.printf("WebhookOutbox: Discarding %u bytes of torn log tail\n", (unsigned)(fileSize - offset));
+    return compact();
+  }
+  return true;
+}
+
+bool WebhookOutbox::writeRecord(File &file, uint8_t type, uint32_t seq, const uint8_t *payload, uint16_t length)
+{
+  OutboxRecordHeader header = {OUTBOX_RECORD_MAGIC, type, length, seq, 0};
+  header.checksum = recordChecksum(header, payload, length);
+  return file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+         (length == 0 || file.write(payload, length) == length);
+}
+
+bool WebhookOutbox::appendRecord(uint8_t type, uint32_t seq, const uint8_t *payload, uint16_t length, uint32_t *offset)
+{
+  File file = DataFS.open(WEBHOOK_OUTBOX_PATH, "a");
+  if (!file)
+  {
+    Serial.println("WebhookOutbox: Failed to open log for append");
+    return false;
+  }
+  if (offset != nullptr)
+  {
+    *offset = file.size();
+  }
+  bool ok = writeRecord(file, type, seq, payload, length);
+  logSize = file.size();
+  file.close(); // Commits the record to flash
+  if (!ok)
+  {
+    Serial.println("WebhookOutbox: Failed to write log record");
+  }
+  return ok;
+}
+
+bool WebhookOutbox::append(const WebhookEvent &event)
+{
+  OutboxLock guard(lock);
+  if (!ready || !guard.isHeld())
+  {
+    Serial.println("WebhookOutbox: Not ready, event lost");
+    return false;
+  }
+
+  if (count == WEBHOOK_OUTBOX_MAX_PENDING)
+  {
+    Serial.printf("WebhookOutbox: Full, dropping oldest event %u\n", pending[head].seq);
+    appendRecord(OUTBOX_RECORD_ACK, pending[head].seq, nullptr, 0, nullptr);
+    popHead();
+    stats.dropped++;
+  }
+
+  uint32_t seq = nextSeq;
+  uint32_t offset;
+  if (!appendRecord(OUTBOX_RECORD_EVENT, seq, (const uint8_t *)&event, sizeof(event), &offset))
+  {
+    return false;
+  }
+  nextSeq++;
+  pushEntry(seq, offset, sizeof(event));
+  stats.appended++;
+  if (logSize > WEBHOOK_OUTBOX_COMPACT_BYTES)
+  {
+    // Long offline nothing is acknowledged, but dropped events still are
+    compact();
+  }
+  return true;
+}
+
+bool WebhookOutbox::peek(WebhookEvent &event, uint32_t &seq)
+{
+  return peekBatch(&event, &seq, 1) == 1;
+}
+
+uint8_t WebhookOutbox::peekBatch(WebhookEvent events[], uint32_t seqs[], uint8_t max)
+{
+  OutboxLock guard(lock);
+  if (!ready || !guard.isHeld() || count == 0)
+  {
+    return 0;
+  }
+
+  File file = DataFS.open(WEBHOOK_OUTBOX_PATH, "r");
+  if (!file)
+  {
+    Serial.println("WebhookOutbox: Failed to open log");
+    return 0;
+  }
+
+  uint8_t found = 0;
+  while (found < max && found < count)
+  {
+    const Entry &entry = pending[(head + found) % WEBHOOK_OUTBOX_MAX_PENDING];
+    if (!file.seek(entry.offset + sizeof(OutboxRecordHeader)) ||
+        file.read((uint8_t *)&events[found], sizeof(WebhookEvent)) != sizeof(WebhookEvent))
+    {
+      Serial.println("WebhookOutbox: Failed to read pending event");
+      break;
+    }
+    seqs[found] = entry.seq;
+    found++;
+  }
+  file.close();
+  return found;
+}
+
+bool WebhookOutbox::ack(uint32_t seq, bool delivered)
+{
+  OutboxLock guard(lock);
+  if (!ready || !guard.isHeld() || !removeEntry(seq))
+  {
+    return false;
+  }
+
+  appendRecord(OUTBOX_RECORD_ACK, seq, nullptr, 0, nullptr);
+  if (delivered)
+  {
+    stats.delivered++;
+  }
+  else
+  {
+    stats.rejected++;
+  }
+
+  if (count == 0)
+  {
+    // Everything acknowledged: start the next session on an empty log
+    resetLog();
+  }
+  else if (logSize > WEBHOOK_OUTBOX_COMPACT_BYTES)
+  {
+    compact();
+  }
+  return true;
+}
+
+// Rewrites the log with only the pending events, then swaps it in
+bool WebhookOutbox::compact()
+{
+  if (count == 0)
+  {
+    return resetLog();
+  }
+
+  File source = DataFS.open(WEBHOOK_OUTBOX_PATH, "r");
+  File target = DataFS.open(WEBHOOK_OUTBOX_TMP_PATH, "w");
+  if (!source || !target)
+  {
+    Serial.println("WebhookOutbox: Failed to open files for compaction");
+    return false;
+  }
+
+  uint32_t offset = 0;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    Entry &entry = pending[(head + i) % WEBHOOK_OUTBOX_MAX_PENDING];
+    if (!source.seek(entry.offset + sizeof(OutboxRecordHeader)) ||
+        source.read(payloadBuffer, entry.length) != entry.length ||
+        !writeRecord(target, OUTBOX_RECORD_EVENT, entry.seq, payloadBuffer, entry.length))
+    {
+      Serial.println("WebhookOutbox: Compaction failed, keeping the old log");
+      source.close();
+      target.close();
+      DataFS.remove(WEBHOOK_OUTBOX_TMP_PATH);
+      return false;
+    }
+    entry.offset = offset;
+    offset += sizeof(OutboxRecordHeader) + entry.length;
+  }
+  source.close();
+  target.close();
+
+  if (!DataFS.rename(WEBHOOK_OUTBOX_TMP_PATH, WEBHOOK_OUTBOX_PATH))
+  {
+    Serial.println("WebhookOutbox: Failed to replace log after compaction");
+    return false;
+  }
+  logSize = offset;
+  return true;
+}
+
+// Truncates the log to one ack of the last seq, so the next scan carries on
+// after it; an emptied log never hands out a seq (part of each event's id on
+// the server) a second time
+bool WebhookOutbox::resetLog()
+{
+  File file = DataFS.open(WEBHOOK_OUTBOX_PATH, "w");
+  bool ok = file && writeRecord(file, OUTBOX_RECORD_ACK, nextSeq - 1, nullptr, 0);
+  logSize = file ? file.size() : 0;
+  file.close();
+  if (!ok)
+  {
+    Serial.println("WebhookOutbox: Failed to reset log");
+  }
+  return ok;
+}
+
+// Where a new log starts counting: at random, so an outbox whose log was lost
+// (a formatted partition) doesn't reuse the seqs, and event ids, it had sent
+uint32_t WebhookOutbox::firstSeq()
+{
+  return 1 + esp_random() % 0x40000000;
+}
+
+void WebhookOutbox::popHead()
+{
+  head = (head + 1) % WEBHOOK_OUTBOX_MAX_PENDING;
+  count--;
+}
+
+bool WebhookOutbox::removeEntry(uint32_t seq)
+{
+  for (uint16_t i = 0; i < count; i++)
+  {
+    if (pending[(head + i) % WEBHOOK_OUTBOX_MAX_PENDING].seq != seq)
+    {
+      continue;
+    }
+    for (uint16_t j = i; j > 0; j--)
+    {
+      // Shift the older entries up one slot, then drop the head
+      pending[(head + j) % WEBHOOK_OUTBOX_MAX_PENDING] = pending[(head + j - 1) % WEBHOOK_OUTBOX_MAX_PENDING];
+    }
+    popHead();
+    return true;
+  }
+  return false;
+}
+
+void WebhookOutbox::pushEntry(uint32_t seq, uint32_t offset, uint16_t length)
+{
+  pending[(head + count) % WEBHOOK_OUTBOX_MAX_PENDING] = {seq, offset, length};
+  count++;
+}
+
+uint32_t WebhookOutbox::retryDelay(uint8_t attempt)
+{
+  uint32_t ceiling = WEBHOOK_RETRY_BASE_MS;
+  while (attempt-- > 0 && ceiling < WEBHOOK_RETRY_MAX_MS)
+  {
+    ceiling *= 2;
+  }
+  ceiling = min(ceiling, (uint32_t)WEBHOOK_RETRY_MAX_MS);
+  return ceiling / 2 + random(ceiling / 2);
+}
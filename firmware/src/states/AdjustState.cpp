@@ -52,6 +52,7 @@ void AdjustState::update()
     // Transition to Idle
     stateMachine.changeState(&StateMachine::idleState);
   }
+  scheduler.wakeAt(lastActivity + CHANGE_TIMEOUT * 1000);
 }
 
 void AdjustState::exit()
@@ -17,7 +17,7 @@ void DoneState::enter()
         stateMachine.changeState(&StateMachine::idleState); });
 
   // Send 'stop' action to webhook handler (which will fetch project details) - MOVED to TimerState exit/handlers
-  // networkController.sendWebhookAction("stop");
+  // networkController.sendWebhookAction(WebhookAction::Stop);
 }
 
 void DoneState::update()
@@ -34,6 +34,7 @@ void DoneState::update()
     // Transition to Idle after timeout
     stateMachine.changeState(&StateMachine::idleState);
   }
+  scheduler.wakeAt(doneEnter + CHANGE_TIMEOUT * 1000);
 }
 
 void DoneState::exit()
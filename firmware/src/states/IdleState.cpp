@@ -1,29 +1,14 @@
 #include "StateMachine.h"
 #include "Controllers.h"
 
-IdleState::IdleState() : defaultDuration(0), lastActivity(0)
+IdleState::IdleState() : lastActivity(0)
 {
-
-  if (nvs_flash_init() != ESP_OK)
-  {
-    Serial.println("NVS Flash Init Failed");
-  }
-  else
-  {
-    Serial.println("NVS initialized successfully.");
-  }
-
-  // Load the default duration
-  if (preferences.begin("focusdial", true))
-  {
-    defaultDuration = preferences.getInt("timer", DEFAULT_TIMER);
-    preferences.end();
-  }
 }
 
 void IdleState::enter()
 {
   Serial.println("Entering Idle State");
+  settings.commit(); // Back from a session or an adjustment: one write for whatever it changed
   ledController.setBreath(BLUE, -1, false, 5);
 
   // Register state-specific handlers
@@ -31,7 +16,7 @@ void IdleState::enter()
                                  {
                                    Serial.println("Idle State: Button pressed - Go to Project Select");
                                    // Store the current default duration for TimerState later
-                                   stateMachine.setPendingDuration(this->defaultDuration);
+                                   stateMachine.setPendingDuration(settings.getTimer());
                                    // stateMachine.adjustState.adjustTimer(this->defaultDuration); // No longer needed
                                    // stateMachine.changeState(&StateMachine::adjustState); // Go to Project Select instead
                                    stateMachine.changeState(&StateMachine::projectSelectState); });
@@ -62,7 +47,7 @@ void IdleState::update()
   networkController.update();
 
   // Restore unconditional redraw
-  displayController.drawIdleScreen(defaultDuration, networkController.isWiFiConnected());
+  displayController.drawIdleScreen(settings.getTimer(), networkController.isWiFiConnected());
 
   // Check if sleep timeout is reached
   if (millis() - lastActivity >= (SLEEP_TIMOUT * 60 * 1000))
@@ -70,6 +55,7 @@ void IdleState::update()
     Serial.println("Idle State: Activity timeout");
     stateMachine.changeState(&StateMachine::sleepState); // Transition to Sleep State
   }
+  scheduler.wakeAt(lastActivity + SLEEP_TIMOUT * 60 * 1000);
 }
 
 void IdleState::exit()
@@ -81,16 +67,12 @@ void IdleState::exit()
 
 void IdleState::setTimer(int duration)
 {
-  defaultDuration = duration;
-
-  preferences.begin("focusdial", true);
-  preferences.putInt("timer", defaultDuration);
-  preferences.end();
+  settings.setTimer(duration); // Written when Idle is entered
 }
 
 int IdleState::getDefaultDuration() const
 {
-  return defaultDuration;
+  return settings.getTimer();
 }
 
 void IdleState::restoreDefaultLEDPattern()
@@ -15,7 +15,7 @@ void PausedState::enter()
                                    Serial.println("Paused State: Button Pressed - Resuming");
 
                                    // Send 'start' action to webhook handler (resume)
-                                   networkController.sendWebhookAction("start", this->duration, this->elapsedTime);
+                                   networkController.sendWebhookAction(WebhookAction::Start, this->duration, this->elapsedTime);
 
                                    // Transition back to TimerState with the stored duration and elapsed time
                                    StateMachine::timerState.setTimer(duration, elapsedTime);
@@ -28,7 +28,7 @@ void PausedState::enter()
                                          Serial.println("Paused State: Button Double Pressed - Canceling");
 
                                          // Send 'stop' action to webhook handler (canceled)
-                                         networkController.sendWebhookAction("stop", this->duration, this->elapsedTime);
+                                         networkController.sendWebhookAction(WebhookAction::Stop, this->duration, this->elapsedTime);
                                          displayController.showCancel();
                                          stateMachine.changeState(&StateMachine::idleState); // Transition back to Idle State
                                        });
@@ -52,10 +52,11 @@ void PausedState::update()
     Serial.println("Paused State: Timout");
 
     // Send 'stop' action to webhook handler (timeout)
-    networkController.sendWebhookAction("stop", this->duration, this->elapsedTime);
+    networkController.sendWebhookAction(WebhookAction::Stop, this->duration, this->elapsedTime);
     displayController.showCancel();
     stateMachine.changeState(&StateMachine::idleState); // Transition back to Idle State
   }
+  scheduler.wakeAt(pauseEnter + PAUSE_TIMEOUT * 60 * 1000);
 }
 
 void PausedState::exit()
@@ -4,14 +4,25 @@
 
 #define PROJECT_SELECT_TIMEOUT 30000 // 30 seconds
 
+const Project ProjectSelectView::noProject = {"No Project", "#FF0000", ""}; // Red for no project
+
+const Project &ProjectSelectView::at(int index)
+{
+  if (index > 0 && cursor.seek(index - 1))
+  {
+    return cursor.current();
+  }
+  return noProject;
+}
+
 ProjectSelectState::ProjectSelectState(StateMachine &sm, DisplayController &display, LEDController &leds, InputController &input, ProjectManager &pm)
     : stateMachine(sm),
       displayController(display),
       ledController(leds),
       inputController(input),
       projectManager(pm),
+      projects(pm),
       selectedProjectIndex(0),
-      numProjectsToShow(1),
       needsInitialRender(true),
       lastActivityTime(0) // Initialize
 {
@@ -24,12 +35,9 @@ void ProjectSelectState::enter()
 {
   Serial.println("Entering Project Select State");
 
-  // 1. Load projects and prepend "No Project"
-  loadProjects(); // Use helper
-
-  // 2. Determine initial selection (from last used)
+  // 1. Determine initial selection (from last used); "No Project" comes first
   int lastUsedIndex = projectManager.getLastProjectIndex();
-  if (lastUsedIndex >= 0 && (lastUsedIndex + 1) < projectsWithNone.size())
+  if (lastUsedIndex >= 0 && (lastUsedIndex + 1) < projects.size())
   {
     selectedProjectIndex = lastUsedIndex + 1;
   }
@@ -39,7 +47,7 @@ void ProjectSelectState::enter()
   }
   Serial.printf("Initial selected index: %d\n", selectedProjectIndex);
 
-  // 3. Register Input Handlers
+  // 2. Register Input Handlers
   handleInput(); // Use helper
 
   needsInitialRender = true;   // Set flag for first update
@@ -64,6 +72,7 @@ void ProjectSelectState::update()
     Serial.println("ProjectSelectState: Timeout - Returning to Idle");
     stateMachine.changeState(&StateMachine::idleState);
   }
+  scheduler.wakeAt(lastActivityTime + PROJECT_SELECT_TIMEOUT);
 }
 
 void ProjectSelectState::exit()
@@ -78,34 +87,15 @@ void ProjectSelectState::exit()
 void ProjectSelectState::renderDisplay()
 {
   // Draw the screen
-  displayController.drawProjectSelectionScreen(projectsWithNone, selectedProjectIndex, 0, numProjectsToShow);
+  displayController.drawProjectSelectionScreen(projects.at(selectedProjectIndex).name, selectedProjectIndex, projects.size());
   // Update LED to match selection
   updateLedColor();
 }
 
 void ProjectSelectState::updateLedColor()
 {
-  // Get color from projectsWithNone[selectedProjectIndex]
-  // Convert hex to uint32_t using LEDController::hexColorToUint32
-  // Set LED color using ledController.setSolid() or similar
-  if (selectedProjectIndex >= 0 && selectedProjectIndex < projectsWithNone.size())
-  {
-    uint32_t color = LEDController::hexColorToUint32(projectsWithNone[selectedProjectIndex].color);
-    ledController.setSolid(color);
-  }
-  else
-  {
-    ledController.turnOff(); // Should not happen
-  }
-}
-
-void ProjectSelectState::loadProjects()
-{
-  projectsWithNone.clear();
-  Project noProject = {"No Project", "#FF0000"}; // Red for no project
-  projectsWithNone.push_back(noProject);
-  const auto &actualProjects = projectManager.getProjects();
-  projectsWithNone.insert(projectsWithNone.end(), actualProjects.begin(), actualProjects.end());
+  uint32_t color = LEDController::hexColorToUint32(projects.at(selectedProjectIndex).color);
+  ledController.setSolid(color);
 }
 
 void ProjectSelectState::handleInput()
@@ -118,11 +108,8 @@ void ProjectSelectState::handleInput()
     projectManager.setLastProjectIndex(indexToSave);
     Serial.printf("Selected project index %d (saved as %d)\n", selectedProjectIndex, indexToSave);
     
-    // Get the device_project_id
-    String selectedProjectId = ""; // Empty string indicates "No Project"
-    if (selectedProjectIndex > 0 && selectedProjectIndex < projectsWithNone.size()) {
-        selectedProjectId = projectsWithNone[selectedProjectIndex].device_project_id;
-    }
+    // Get the device_project_id; empty for "No Project"
+    const String &selectedProjectId = projects.at(selectedProjectIndex).device_project_id;
     
     Serial.printf("Selected device_project_id: %s\n", selectedProjectId.c_str());
     stateMachine.setPendingProjectId(selectedProjectId); // Store the ID
@@ -139,12 +126,10 @@ void ProjectSelectState::handleInput()
 
   inputController.onEncoderRotateHandler([this](int delta)
                                          {
-                                           int listSize = projectsWithNone.size();
-                                           if (listSize == 0)
-                                             return;
+                                           int size = projects.size();
 
-                                           selectedProjectIndex += delta;                                                  // Add delta (assuming positive is clockwise/down)
-                                           selectedProjectIndex = (selectedProjectIndex % listSize + listSize) % listSize; // Modulo for wrapping
+                                           selectedProjectIndex += delta;                                      // Add delta (assuming positive is clockwise/down)
+                                           selectedProjectIndex = (selectedProjectIndex % size + size) % size; // Modulo for wrapping
 
                                            Serial.printf("ProjectSelectState: Encoder Delta: %d, Selected: %d\n", delta, selectedProjectIndex);
 
@@ -1,6 +1,8 @@
 #include "StateMachine.h"
 #include "Controllers.h"
 
+#define PROVISION_POLL_INTERVAL_MS 100 // Fallback poll for the connection check
+
 void ProvisionState::enter()
 {
   Serial.println("Entering Provision State");
@@ -20,6 +22,8 @@ void ProvisionState::update()
     networkController.stopProvisioning();
     stateMachine.changeState(&StateMachine::idleState);
   }
+  // WiFi events wake the loop; poll as a fallback while the portal runs
+  scheduler.wakeIn(PROVISION_POLL_INTERVAL_MS);
 }
 
 void ProvisionState::exit()
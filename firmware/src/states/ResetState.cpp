@@ -44,6 +44,10 @@ void ResetState::update()
     Serial.println("Restarting ...");
     ESP.restart(); // Restart after 1 second
   }
+  if (resetStartTime > 0)
+  {
+    scheduler.wakeAt(resetStartTime + 1000);
+  }
 }
 
 void ResetState::exit()
@@ -4,6 +4,7 @@
 void SleepState::enter()
 {
   Serial.println("Entering Sleep State");
+  settings.commit();
 
   ledController.turnOff();
   displayController.clear();
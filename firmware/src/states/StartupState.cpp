@@ -28,6 +28,7 @@ void StartupState::update()
       stateMachine.changeState(&StateMachine::provisionState); // Trigger Provision
     }
   }
+  scheduler.wakeAt(startEnter + SPLASH_DURATION * 1000);
 }
 
 void StartupState::exit()
@@ -19,19 +19,14 @@ void TimerState::enter()
     if (!pendingId.isEmpty())
     {
       // Find project by ID
-      const auto &allProjects = getProjectManagerInstance().getProjects();
-      bool found = false;
-      for (const auto &p : allProjects)
+      ProjectManager &projects = getProjectManagerInstance();
+      const Project *project = projects.get(projects.findById(pendingId));
+      if (project != nullptr)
       {
-        if (p.device_project_id == pendingId)
-        {
-          projectColorHex = p.color;
-          Serial.printf("Found project for timer: ID=%s, Color=%s\n", pendingId.c_str(), projectColorHex.c_str());
-          found = true;
-          break;
-        }
+        projectColorHex = project->color;
+        Serial.printf("Found project for timer: ID=%s, Color=%s\n", pendingId.c_str(), projectColorHex.c_str());
       }
-      if (!found)
+      else
       {
         Serial.printf("Warning: Could not find project color for pending ID: %s. Using default white.\n", pendingId.c_str());
       }
@@ -58,11 +53,12 @@ void TimerState::enter()
   }
   else // Countdown mode
   {
-    // Start LED Fill and Decay Animation using stored color and REMAINING duration
-    uint32_t remainingDurationMs = (this->duration * 60 - this->elapsedTime) * 1000;
-    if (remainingDurationMs > 0)
+    // Start LED Fill and Decay Animation on the same timeline as the countdown
+    uint32_t durationMs = this->duration * 60 * 1000;
+    uint32_t elapsedMs = millis() - startTime;
+    if (elapsedMs < durationMs)
     {
-      ledController.startFillAndDecay(currentLedColor, remainingDurationMs);
+      ledController.startFillAndDecay(currentLedColor, durationMs, elapsedMs);
     }
     else
     {
@@ -74,7 +70,7 @@ void TimerState::enter()
   inputController.onPressHandler([this]()
                                  {
                                    // Send 'stop' action first (applies to both modes)
-                                   networkController.sendWebhookAction("stop", this->duration, this->elapsedTime);
+                                   networkController.sendWebhookAction(WebhookAction::Stop, this->duration, this->elapsedTime);
 
                                    if (this->duration == 0) // Indeterminate mode
                                    {
@@ -97,14 +93,14 @@ void TimerState::enter()
                                        {
                                          Serial.println("Timer State: Button Double Pressed - Canceling");
                                          // Send 'stop' action with current elapsed time
-                                         networkController.sendWebhookAction("stop", this->duration, this->elapsedTime);
+                                         networkController.sendWebhookAction(WebhookAction::Stop, this->duration, this->elapsedTime);
                                          displayController.showCancel();
                                          stateMachine.changeState(&StateMachine::idleState); });
 
   // Send 'start' action ONLY on initial entry
   if (elapsedTime == 0)
   {
-    networkController.sendWebhookAction("start", this->duration, 0); // Pass set duration, 0 elapsed
+    networkController.sendWebhookAction(WebhookAction::Start, this->duration, 0); // Pass set duration, 0 elapsed
   }
 }
 
@@ -138,6 +134,9 @@ void TimerState::update()
       stateMachine.changeState(&StateMachine::doneState); // Transition to Done State
     }
   }
+
+  // The display only changes when the next whole second elapses
+  scheduler.wakeAt(startTime + (elapsedTime + 1) * 1000);
 }
 
 void TimerState::exit()
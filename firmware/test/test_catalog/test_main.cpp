@@ -0,0 +1,214 @@
+// Project catalog on the data partition: a bad or missing partition at boot,
+// migration of the old NVS list, edits across reboots, handles across
+// deletes, and a partition that fills up. Runs on the native env:
+//   pio test -e native -f test_catalog
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <Preferences.h>
+#include <unity.h>
+#include "DataFS.h"
+#include "managers/ProjectManager.h"
+#include "managers/WebhookOutbox.h"
+
+static size_t dataPartitionBytes = 0;
+
+static void clearNvsProjects()
+{
+  Preferences nvs;
+  nvs.begin("projects", false);
+  nvs.clear();
+  nvs.end();
+}
+
+static bool addNamed(ProjectManager &manager, const String &name)
+{
+  JsonDocument added;
+  added["name"] = name;
+  added["color"] = "#336699";
+  return manager.addProject(added.as<JsonObject>());
+}
+
+void setUp()
+{
+  // An empty data partition of the size partitions.csv gives it
+  dataPartitionBytes = sim::setPartitionSize(DATA_FS_PARTITION_LABEL, 0);
+  sim::setPartitionSize(DATA_FS_PARTITION_LABEL, dataPartitionBytes);
+  clearNvsProjects();
+}
+
+void tearDown()
+{
+  sim::setPartitionSize(DATA_FS_PARTITION_LABEL, dataPartitionBytes);
+}
+
+void test_corrupt_partition_is_formatted_at_boot()
+{
+  sim::corruptPartition(DATA_FS_PARTITION_LABEL);
+  ProjectManager manager;
+  TEST_ASSERT_TRUE(manager.begin());
+  TEST_ASSERT_EQUAL(0, manager.count());
+  TEST_ASSERT_TRUE(addNamed(manager, "After format"));
+}
+
+// An old partition table: the device runs with no projects to add to
+void test_missing_partition_refuses_adds()
+{
+  sim::setPartitionSize(DATA_FS_PARTITION_LABEL, 0);
+  ProjectManager manager;
+  TEST_ASSERT_FALSE(manager.begin());
+  TEST_ASSERT_EQUAL(0, manager.count());
+  TEST_ASSERT_FALSE(addNamed(manager, "Nowhere to go"));
+}
+
+// The largest list the JSON store held moves into the catalog once
+void test_nvs_list_is_migrated_once()
+{
+  const int legacyCount = MAX_NVS_PROJECTS;
+  JsonDocument seed;
+  JsonArray list = seed.to<JsonArray>();
+  for (int i = 0; i < legacyCount; i++)
+  {
+    JsonObject project = list.add<JsonObject>();
+    project["name"] = "Client project " + String(i + 1);
+    project["color"] = i % 2 ? "#1f3a5c" : "#ff8800";
+    project["device_project_id"] = "A1B2C3D4E5F6-" + String(i + 1);
+  }
+  String json;
+  serializeJson(seed, json);
+  Preferences nvs;
+  nvs.begin("projects", false);
+  nvs.putString(NVS_PROJECTS_KEY, json);
+  nvs.end();
+
+  ProjectManager migrated;
+  TEST_ASSERT_TRUE(migrated.begin());
+  TEST_ASSERT_EQUAL(legacyCount, migrated.count());
+  nvs.begin("projects", true);
+  TEST_ASSERT_FALSE(nvs.isKey(NVS_PROJECTS_KEY));
+  nvs.end();
+
+  ProjectManager rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  ProjectCursor cursor(rebooted);
+  for (int i = 0; i < legacyCount; i++)
+  {
+    TEST_ASSERT_TRUE(cursor.seek(i));
+    TEST_ASSERT_EQUAL_STRING(list[i]["name"].as<const char *>(), cursor.current().name.c_str());
+    TEST_ASSERT_EQUAL_STRING(list[i]["color"].as<const char *>(), cursor.current().color.c_str());
+    TEST_ASSERT_EQUAL_STRING(list[i]["device_project_id"].as<const char *>(), cursor.current().device_project_id.c_str());
+  }
+}
+
+void test_edits_survive_a_reboot()
+{
+  ProjectManager manager;
+  TEST_ASSERT_TRUE(manager.begin());
+  for (int i = 0; i < 10; i++)
+    TEST_ASSERT_TRUE(addNamed(manager, "Project " + String(i + 1)));
+
+  Project renamed = {"Renamed project", "#00ff88", ""};
+  TEST_ASSERT_TRUE(manager.updateProject(7, renamed));
+  TEST_ASSERT_TRUE(manager.deleteProject(3));
+  TEST_ASSERT_TRUE(addNamed(manager, "New project"));
+
+  ProjectManager rebooted;
+  ProjectCursor cursor(rebooted);
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL(10, rebooted.count());
+  TEST_ASSERT_TRUE(cursor.seek(3));
+  TEST_ASSERT_EQUAL_STRING("Project 5", cursor.current().name.c_str());
+  TEST_ASSERT_TRUE(cursor.seek(6));
+  TEST_ASSERT_EQUAL_STRING("Renamed project", cursor.current().name.c_str());
+  TEST_ASSERT_EQUAL_STRING("#00ff88", cursor.current().color.c_str());
+  TEST_ASSERT_TRUE(cursor.seek(9));
+  TEST_ASSERT_EQUAL_STRING("New project", cursor.current().name.c_str());
+}
+
+// A handle follows its project across deletes of others and dies with it
+void test_handle_follows_its_project()
+{
+  const int size = 3 * PROJECT_PAGE_SLOTS + 4;
+  ProjectManager manager;
+  TEST_ASSERT_TRUE(manager.begin());
+  for (int i = 0; i < size; i++)
+    TEST_ASSERT_TRUE(addNamed(manager, "Client " + String(i + 1)));
+  ProjectCursor cursor(manager);
+  TEST_ASSERT_TRUE(cursor.seek(size - 1));
+  String lastId = cursor.current().device_project_id;
+  TEST_ASSERT_TRUE(cursor.seek(40));
+  String otherId = cursor.current().device_project_id;
+
+  ProjectHandle handle = manager.findById(lastId);
+  TEST_ASSERT_TRUE(handle.isValid());
+  TEST_ASSERT_FALSE(manager.findById("no-such-id").isValid());
+  TEST_ASSERT_TRUE(manager.deleteProject(0));
+  TEST_ASSERT_TRUE(manager.deleteProjectById(otherId));
+  const Project *moved = manager.get(handle);
+  TEST_ASSERT_NOT_NULL(moved);
+  TEST_ASSERT_EQUAL_STRING(lastId.c_str(), moved->device_project_id.c_str());
+  TEST_ASSERT_EQUAL(size - 3, manager.indexOf(handle));
+
+  TEST_ASSERT_TRUE(manager.deleteProjectById(lastId));
+  TEST_ASSERT_NULL(manager.get(handle));
+  TEST_ASSERT_FALSE(manager.findById(lastId).isValid());
+}
+
+// Adds until the partition says no, on one the size of the old spiffs
+// partition (192 KB); returns how many fit
+static int fillSmallPartition(ProjectManager &manager)
+{
+  sim::setPartitionSize(DATA_FS_PARTITION_LABEL, 0x30000);
+  TEST_ASSERT_TRUE(manager.begin());
+  while (addNamed(manager, "Project " + String(manager.count() + 1)))
+    ;
+  TEST_ASSERT_GREATER_THAN(PROJECT_PAGE_SLOTS, manager.count());
+  return manager.count();
+}
+
+// Edits still fit; adds fit again once deletes empty page files (the
+// journal of those deletes takes some of the room back)
+void test_full_partition_can_be_edited_and_freed()
+{
+  ProjectManager manager;
+  int capacity = fillSmallPartition(manager);
+  Project renamed = {"Renamed", "#00ff88", ""};
+  TEST_ASSERT_TRUE(manager.updateProject(1, renamed));
+  for (int i = 0; i < 2 * PROJECT_PAGE_SLOTS; i++)
+    TEST_ASSERT_TRUE(manager.deleteProject(0));
+  TEST_ASSERT_TRUE(addNamed(manager, "After deletes"));
+  TEST_ASSERT_EQUAL(capacity - 2 * PROJECT_PAGE_SLOTS + 1, manager.count());
+}
+
+// Projects stop short of the room the outbox needs for a long time offline
+void test_full_partition_still_takes_an_offline_backlog()
+{
+  ProjectManager manager;
+  fillSmallPartition(manager);
+  WebhookOutbox outbox;
+  TEST_ASSERT_TRUE(outbox.begin());
+  WebhookEvent event = {};
+  event.action = WebhookAction::Start;
+  setWebhookEventProject(event, "A1B2C3D4E5F6-1", "Project 1", "#336699");
+  const int backlog = 4 * WEBHOOK_OUTBOX_COMPACT_BYTES / sizeof(WebhookEvent);
+  for (int i = 0; i < backlog; i++)
+    TEST_ASSERT_TRUE(outbox.append(event));
+  TEST_ASSERT_EQUAL(WEBHOOK_OUTBOX_MAX_PENDING, outbox.pendingCount());
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  sim::setSerialEcho(false);
+  settings.begin(); // Project ids come from its counter; setup() loads it first too
+  UNITY_BEGIN();
+  RUN_TEST(test_corrupt_partition_is_formatted_at_boot);
+  RUN_TEST(test_missing_partition_refuses_adds);
+  RUN_TEST(test_nvs_list_is_migrated_once);
+  RUN_TEST(test_edits_survive_a_reboot);
+  RUN_TEST(test_handle_follows_its_project);
+  RUN_TEST(test_full_partition_can_be_edited_and_freed);
+  RUN_TEST(test_full_partition_still_takes_an_offline_backlog);
+  return UNITY_END();
+}
@@ -0,0 +1,64 @@
+// Encoder decoding on a booted device: fast quadrature edge traces from
+// Idle/Adjust, where every detent redraws the OLED, must decode to the exact
+// detent count with no edge dropped. Runs on the native env:
+//   pio test -e native -f test_decoder
+
+#include <Arduino.h>
+#include <unity.h>
+#include "Config.h"
+#include "Controllers.h"
+#include "SimDevice.h"
+
+void setUp() {}
+
+void tearDown() {}
+
+static void expectDecoded(int detents, uint32_t detentHz, int bounces)
+{
+  long before = inputController.getEncoderPosition();
+  sim::runForMs(sim::queueEncoderTrace(detents, detentHz, bounces) / 1000 + 50);
+  TEST_ASSERT_EQUAL(detents, inputController.getEncoderPosition() - before);
+  TEST_ASSERT_EQUAL(0, inputController.getDroppedEdges());
+}
+
+void test_forward_spin_at_1200_hz()
+{
+  expectDecoded(200, 1200, 0);
+}
+
+void test_backward_spin_at_1200_hz()
+{
+  expectDecoded(-200, 1200, 0);
+}
+
+void test_forward_spin_at_2000_hz()
+{
+  expectDecoded(300, 2000, 0);
+}
+
+void test_bouncing_contacts()
+{
+  expectDecoded(-150, 1000, 2);
+}
+
+void test_edge_ring_has_room_left()
+{
+  TEST_ASSERT_LESS_THAN(INPUT_EDGE_RING_SIZE, inputController.getEdgeHighWater());
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  sim::setSerialEcho(false);
+  if (!sim::bootDevice(25))
+    return 1;
+
+  UNITY_BEGIN();
+  RUN_TEST(test_forward_spin_at_1200_hz);
+  RUN_TEST(test_backward_spin_at_1200_hz);
+  RUN_TEST(test_forward_spin_at_2000_hz);
+  RUN_TEST(test_bouncing_contacts);
+  RUN_TEST(test_edge_ring_has_room_left);
+  return UNITY_END();
+}
@@ -0,0 +1,150 @@
+// OLED flush task: present() hands frames to the task instead of holding the
+// loop for the bus, frames presented faster than the bus takes them are
+// merged and dropped rather than queued, a window the panel doesn't
+// acknowledge goes out again, and after all of it the panel shows the
+// framebuffer. Runs on the native env:
+//   pio test -e native -f test_flush_task
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <Wire.h>
+#include <unity.h>
+#include <vector>
+#include "Animation.h"
+#include "Config.h"
+#include "SimDevice.h"
+#include "animations.h"
+#include "drivers/BufferedSSD1306.h"
+
+static const size_t BUFFER_BYTES = OLED_WIDTH * OLED_HEIGHT / 8;
+
+static void beginOled(BufferedSSD1306 &oled, bool flushTask)
+{
+  sim::HeapAccountingPause pause;
+  TEST_ASSERT_TRUE(oled.begin(SSD1306_SWITCHCAPVCC, OLED_ADDR));
+  if (flushTask)
+    TEST_ASSERT_TRUE(oled.startFlushTask());
+}
+
+static void expectPanelShowsBuffer(BufferedSSD1306 &oled)
+{
+  sim::settleFlush(oled);
+  TEST_ASSERT_EQUAL_MEMORY(oled.getBuffer(), oled.panel(), BUFFER_BYTES);
+}
+
+// Virtual time one full-screen present() holds the loop
+static uint64_t presentMicros(bool flushTask)
+{
+  BufferedSSD1306 oled(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, OLED_I2C_CLOCK);
+  beginOled(oled, flushTask);
+  oled.fillRect(0, 0, 8, OLED_HEIGHT, SSD1306_WHITE);
+  uint64_t start = sim::nowMicros();
+  oled.present();
+  uint64_t blocked = sim::nowMicros() - start;
+  expectPanelShowsBuffer(oled);
+  return blocked;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_present_does_not_wait_for_the_bus()
+{
+  uint64_t fromLoop = presentMicros(false);
+  uint64_t handedOff = presentMicros(true);
+  TEST_ASSERT_GREATER_THAN(0, fromLoop);
+  TEST_ASSERT_LESS_THAN(fromLoop / 10, handedOff);
+}
+
+// Every animation each way through the task, frame by frame
+void test_animations_reach_the_panel()
+{
+  BufferedSSD1306 oled(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, OLED_I2C_CLOCK);
+  beginOled(oled, true);
+  const PackedAnimation *animations[] = {&animation_tick, &animation_cancel, &animation_reset, &animation_wifi, &animation_timer_start, &animation_resume};
+  for (const PackedAnimation *packed : animations)
+  {
+    for (int reverse = 0; reverse < 2; reverse++)
+    {
+      Animation animation(&oled);
+      animation.start(*packed, false, reverse, 60000);
+      for (int i = 1; i < packed->frameCount; i++)
+      {
+        sim::advanceMicros(DEFAULT_FRAME_DELAY * 1000);
+        oled.service();
+        animation.update();
+      }
+      expectPanelShowsBuffer(oled);
+    }
+  }
+  TEST_ASSERT_EQUAL(0, oled.getFlushStats().errors);
+}
+
+// A new frame every 5 ms, alternately the whole panel and one column
+void test_frames_faster_than_the_bus_are_merged()
+{
+  BufferedSSD1306 oled(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, OLED_I2C_CLOCK);
+  beginOled(oled, true);
+  for (int i = 0; i < 200; i++)
+  {
+    int16_t x = i % OLED_WIDTH;
+    oled.drawFastVLine(x, 0, OLED_HEIGHT, i / OLED_WIDTH % 2 ? SSD1306_BLACK : SSD1306_WHITE);
+    if (i % 2)
+      oled.present(x, 0, 1, OLED_HEIGHT);
+    else
+      oled.present();
+    sim::advanceMicros(5000);
+    oled.service();
+  }
+  expectPanelShowsBuffer(oled);
+
+  OledFlushStats stats = oled.getFlushStats();
+  TEST_ASSERT_GREATER_THAN(0, stats.foundBusy);
+  TEST_ASSERT_GREATER_THAN(0, stats.dropped);
+  TEST_ASSERT_EQUAL(stats.presented, stats.flushes + stats.dropped);
+  TEST_ASSERT_EQUAL(0, stats.errors);
+}
+
+void test_unacknowledged_window_is_sent_again()
+{
+  BufferedSSD1306 oled(OLED_WIDTH, OLED_HEIGHT, &Wire, OLED_ADDR, OLED_I2C_CLOCK);
+  beginOled(oled, true);
+  // Every panel begun at the address so far answers for it
+  std::vector<TwoWireDevice *> unplugged;
+  while (Wire.deviceAt(OLED_ADDR) != nullptr)
+  {
+    unplugged.push_back(Wire.deviceAt(OLED_ADDR));
+    Wire.detach(unplugged.back());
+  }
+  oled.fillRect(0, 0, 16, 8, SSD1306_WHITE);
+  oled.present(0, 0, 16, 8);
+  for (int i = 0; i < 3; i++)
+  {
+    sim::advanceMicros(5000);
+    oled.service();
+  }
+  for (size_t i = unplugged.size(); i-- > 0;)
+    Wire.attach(OLED_ADDR, unplugged[i]);
+  expectPanelShowsBuffer(oled);
+
+  OledFlushStats stats = oled.getFlushStats();
+  TEST_ASSERT_GREATER_THAN(0, stats.errors);
+  TEST_ASSERT_EQUAL(1, stats.flushes);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  sim::setSerialEcho(false);
+  // The task runs one thread at a time with the test, as on the device
+  sim::runTask("OLED Flush");
+
+  UNITY_BEGIN();
+  RUN_TEST(test_present_does_not_wait_for_the_bus);
+  RUN_TEST(test_animations_reach_the_panel);
+  RUN_TEST(test_frames_faster_than_the_bus_are_merged);
+  RUN_TEST(test_unacknowledged_window_is_sent_again);
+  return UNITY_END();
+}
@@ -0,0 +1,225 @@
+// Webhook outbox: events survive a reboot and a torn write, seqs (and so
+// event ids) are never reused, an offline backlog stays bounded, and the
+// webhook task settles a batch item by item. Runs on the native env:
+//   pio test -e native -f test_outbox
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <HTTPClient.h>
+#include <unity.h>
+#include "Controllers.h"
+#include "DataFS.h"
+#include "SimDevice.h"
+#include "managers/WebhookConnection.h"
+#include "managers/WebhookEvent.h"
+#include "managers/WebhookOutbox.h"
+
+static WebhookEvent makeEvent(WebhookAction action, uint32_t actualSeconds)
+{
+  WebhookEvent event = {};
+  event.action = action;
+  event.durationSetMinutes = 25;
+  event.durationActualSeconds = action == WebhookAction::Stop ? actualSeconds : 0;
+  setWebhookEventProject(event, "A1B2C3D4E5F6-1", "Project 1", "#336699");
+  return event;
+}
+
+static size_t logBytes()
+{
+  return DataFS.exists(WEBHOOK_OUTBOX_PATH) ? DataFS.open(WEBHOOK_OUTBOX_PATH, "r").size() : 0;
+}
+
+void setUp()
+{
+  // An empty data partition
+  sim::setPartitionSize(DATA_FS_PARTITION_LABEL, sim::setPartitionSize(DATA_FS_PARTITION_LABEL, 0));
+}
+
+void tearDown() {}
+
+void test_pending_events_replay_after_reboot()
+{
+  WebhookOutbox outbox;
+  TEST_ASSERT_TRUE(outbox.begin());
+  TEST_ASSERT_TRUE(outbox.append(makeEvent(WebhookAction::Start, 0)));
+  TEST_ASSERT_TRUE(outbox.append(makeEvent(WebhookAction::Stop, 90)));
+  WebhookEvent event;
+  uint32_t seq;
+  TEST_ASSERT_TRUE(outbox.peek(event, seq));
+  TEST_ASSERT_TRUE(outbox.ack(seq, true));
+
+  WebhookOutbox rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL(1, rebooted.pendingCount());
+  uint32_t stopSeq;
+  TEST_ASSERT_TRUE(rebooted.peek(event, stopSeq));
+  TEST_ASSERT_TRUE(event.action == WebhookAction::Stop);
+  TEST_ASSERT_EQUAL(seq + 1, stopSeq);
+  TEST_ASSERT_EQUAL(90, event.durationActualSeconds);
+  TEST_ASSERT_FALSE(rebooted.isFromThisBoot(stopSeq));
+}
+
+// An event from before a reboot has no age: its uptime belongs to the last boot
+void test_serialized_event_carries_id_age_and_durations()
+{
+  WebhookEvent stop = makeEvent(WebhookAction::Stop, 90);
+  char json[WEBHOOK_EVENT_JSON_MAX];
+  TEST_ASSERT_GREATER_THAN(0, serializeWebhookEvent(stop, 42, 12, json, sizeof(json)));
+  JsonDocument doc;
+  TEST_ASSERT_FALSE(deserializeJson(doc, json));
+  TEST_ASSERT_TRUE(doc["event_id"].as<String>().endsWith("-42"));
+  TEST_ASSERT_EQUAL_STRING("stop_timer", doc["action"].as<const char *>());
+  TEST_ASSERT_EQUAL(12, doc["age_seconds"].as<int>());
+  TEST_ASSERT_EQUAL(25, doc["duration_set_minutes"].as<int>());
+  TEST_ASSERT_EQUAL(90, doc["duration_actual_seconds"].as<int>());
+  TEST_ASSERT_EQUAL_STRING("A1B2C3D4E5F6-1", doc["device_project_id"].as<const char *>());
+
+  TEST_ASSERT_GREATER_THAN(0, serializeWebhookEvent(makeEvent(WebhookAction::Start, 0), 43, -1, json, sizeof(json)));
+  doc.clear();
+  TEST_ASSERT_FALSE(deserializeJson(doc, json));
+  TEST_ASSERT_FALSE(doc["age_seconds"].is<int>());
+  TEST_ASSERT_FALSE(doc["duration_actual_seconds"].is<int>());
+}
+
+// The emptied log still carries the last seq, so the next event after a
+// reboot gets a new one (and so a new event_id)
+void test_seq_is_not_reused_once_the_log_empties()
+{
+  WebhookOutbox outbox;
+  TEST_ASSERT_TRUE(outbox.begin());
+  TEST_ASSERT_TRUE(outbox.append(makeEvent(WebhookAction::Start, 0)));
+  WebhookEvent event;
+  uint32_t lastSeq;
+  TEST_ASSERT_TRUE(outbox.peek(event, lastSeq));
+  TEST_ASSERT_TRUE(outbox.ack(lastSeq, true));
+  TEST_ASSERT_EQUAL(0, outbox.pendingCount());
+  TEST_ASSERT_GREATER_THAN(0, logBytes());
+  TEST_ASSERT_LESS_OR_EQUAL(16, logBytes());
+
+  WebhookOutbox rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_TRUE(rebooted.append(makeEvent(WebhookAction::Start, 0)));
+  uint32_t nextSeq;
+  TEST_ASSERT_TRUE(rebooted.peek(event, nextSeq));
+  TEST_ASSERT_EQUAL(lastSeq + 1, nextSeq);
+  TEST_ASSERT_TRUE(rebooted.isFromThisBoot(nextSeq));
+}
+
+// A power cut mid-append leaves a torn record; the events before it survive
+void test_torn_tail_keeps_earlier_events()
+{
+  WebhookOutbox outbox;
+  TEST_ASSERT_TRUE(outbox.begin());
+  TEST_ASSERT_TRUE(outbox.append(makeEvent(WebhookAction::Start, 0)));
+  File log = DataFS.open(WEBHOOK_OUTBOX_PATH, "a");
+  log.write((const uint8_t *)"\xFD\x01\x40", 3);
+  log.close();
+
+  WebhookOutbox torn;
+  TEST_ASSERT_TRUE(torn.begin());
+  TEST_ASSERT_EQUAL(1, torn.pendingCount());
+}
+
+// Days offline: the oldest events go, and the log is compacted as it grows
+void test_offline_backlog_stays_bounded()
+{
+  WebhookOutbox outbox;
+  TEST_ASSERT_TRUE(outbox.begin());
+  const int backlog = 4 * WEBHOOK_OUTBOX_COMPACT_BYTES / sizeof(WebhookEvent);
+  for (int i = 0; i < backlog; i++)
+    TEST_ASSERT_TRUE(outbox.append(makeEvent(i % 2 ? WebhookAction::Stop : WebhookAction::Start, 60)));
+  TEST_ASSERT_EQUAL(WEBHOOK_OUTBOX_MAX_PENDING, outbox.pendingCount());
+  TEST_ASSERT_EQUAL(backlog - WEBHOOK_OUTBOX_MAX_PENDING, outbox.getStats().dropped);
+  TEST_ASSERT_LESS_OR_EQUAL(WEBHOOK_OUTBOX_COMPACT_BYTES + sizeof(WebhookEvent) + 64, logBytes());
+}
+
+void test_retry_delay_backs_off_with_jitter()
+{
+  uint32_t cap = WEBHOOK_RETRY_BASE_MS;
+  for (uint8_t attempt = 0; attempt < 10; attempt++)
+  {
+    uint32_t delay = WebhookOutbox::retryDelay(attempt);
+    TEST_ASSERT_GREATER_OR_EQUAL(cap / 2, delay);
+    TEST_ASSERT_LESS_THAN(cap, delay);
+    cap = min(cap * 2, (uint32_t)WEBHOOK_RETRY_MAX_MS);
+  }
+}
+
+// A batch-aware endpoint: one result per array item, failing the last one
+// with a 503 as if its write had timed out
+static uint32_t agedBodies = 0;
+
+static int batchResponder(const sim::HttpExchange &request, String &responseBody)
+{
+  agedBodies += request.body.indexOf("\"age_seconds\":") >= 0 ? 1 : 0;
+  if (!request.body.startsWith("["))
+    return sim::acceptWebhook(request, responseBody);
+
+  JsonDocument events;
+  deserializeJson(events, request.body);
+  size_t count = events.as<JsonArray>().size();
+  responseBody = "{\"success\":false,\"results\":[";
+  for (size_t i = 0; i < count; i++)
+  {
+    responseBody += i > 0 ? "," : "";
+    responseBody += String("{\"index\":") + String((int)i) + ",\"status\":" + (i + 1 < count ? "200}" : "503}");
+  }
+  responseBody += "]}";
+  return 200;
+}
+
+// Four events through the webhook task's rounds: the first POST learns that
+// the endpoint takes batches and the other three go out together. Only the
+// item the server failed is left. Boots the whole device, so it runs last.
+void test_batch_is_settled_per_item()
+{
+  TEST_ASSERT_TRUE(sim::bootDevice(25));
+  // Real timestamps once WiFi is up; until then events are dated by their age
+  TEST_ASSERT_NOT_NULL(sim::sntpServer());
+
+  networkController.sendWebhookAction(WebhookAction::Start, 25, 0);
+  networkController.sendWebhookAction(WebhookAction::Stop, 25, 60);
+  networkController.sendWebhookAction(WebhookAction::Start, 25, 0);
+  networkController.sendWebhookAction(WebhookAction::Stop, 25, 90);
+
+  sim::httpRequest(HTTP_POST, "/api/webhook", "{\"url\":\"https://tracker.example/api/webhook\"}");
+  sim::setHttpResponseHeader(WEBHOOK_BATCH_HEADER, "1");
+  sim::setHttpResponder(batchResponder);
+  sim::resetHttpStats();
+
+  TEST_ASSERT_TRUE(networkController.deliverWebhooks());  // One event, learns the header
+  TEST_ASSERT_FALSE(networkController.deliverWebhooks()); // A batch of three, the last one failed
+  TEST_ASSERT_EQUAL(2, sim::httpStats().requests);
+  TEST_ASSERT_EQUAL(2, agedBodies); // Every event is from this boot
+
+  WebhookOutbox rebooted;
+  TEST_ASSERT_TRUE(rebooted.begin());
+  TEST_ASSERT_EQUAL(1, rebooted.pendingCount());
+  WebhookEvent event;
+  uint32_t seq;
+  TEST_ASSERT_TRUE(rebooted.peek(event, seq));
+  TEST_ASSERT_TRUE(event.action == WebhookAction::Stop);
+  TEST_ASSERT_EQUAL(90, event.durationActualSeconds);
+
+  // Capturing an event and building a POST body should not touch the heap
+  JsonDocument metrics;
+  TEST_ASSERT_FALSE(deserializeJson(metrics, sim::httpRequest(HTTP_GET, "/api/metrics").body));
+  TEST_ASSERT_EQUAL(0, metrics["webhooks"]["capture_allocs"] | 1);
+  TEST_ASSERT_EQUAL(0, metrics["webhooks"]["serialize_allocs"] | 1);
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  sim::setSerialEcho(false);
+  UNITY_BEGIN();
+  RUN_TEST(test_pending_events_replay_after_reboot);
+  RUN_TEST(test_serialized_event_carries_id_age_and_durations);
+  RUN_TEST(test_seq_is_not_reused_once_the_log_empties);
+  RUN_TEST(test_torn_tail_keeps_earlier_events);
+  RUN_TEST(test_offline_backlog_stays_bounded);
+  RUN_TEST(test_retry_delay_backs_off_with_jitter);
+  RUN_TEST(test_batch_is_settled_per_item);
+  return UNITY_END();
+}
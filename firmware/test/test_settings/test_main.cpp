@@ -0,0 +1,111 @@
+// Settings write-behind, on a booted device: every way settings change,
+// grouped into idle periods (from one entry into Idle to the next, or into
+// Sleep). However many values change in a period, NVS is written at most
+// once, and only by the settings store. The tests run in order on the same
+// device. Runs on the native env:
+//   pio test -e native -f test_settings
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <unity.h>
+#include "Config.h"
+#include "Controllers.h"
+#include "SimDevice.h"
+#include "StateMachine.h"
+#include "managers/SettingsStore.h"
+
+void setUp() {}
+
+void tearDown() {}
+
+// Runs one period, which must end in `end`, and checks what it wrote
+static void expectOneCommit(State *end, void (*period)())
+{
+  SettingsStats before = settings.getStats();
+  sim::resetNvsStats();
+  period();
+  TEST_ASSERT_TRUE(sim::runUntil(end, 60 * 1000));
+  sim::runForMs(100);
+
+  SettingsStats after = settings.getStats();
+  TEST_ASSERT_LESS_OR_EQUAL(1, after.commits - before.commits);
+  TEST_ASSERT_EQUAL(after.keysWritten - before.keysWritten, sim::nvsStats().writes);
+  TEST_ASSERT_FALSE(settings.isDirty());
+}
+
+void test_dial_adjust_commits_once()
+{
+  expectOneCommit(&StateMachine::idleState, []()
+                  {
+                    sim::runForMs(sim::queueEncoderTrace(-4, 20, 0) / 1000 + 500); // Into Adjust, then up 15 min
+                    sim::runForMs(sim::queueEncoderTrace(1, 20, 0) / 1000 + 500);  // Back down 5
+                    sim::click(); // Save and back to Idle
+                  });
+}
+
+void test_web_edits_commit_once()
+{
+  expectOneCommit(&StateMachine::idleState, []()
+                  {
+                    for (int i = 0; i < 6; i++)
+                    {
+                      settings.setWebhookUrl(String("http://hooks.example.com/") + String(i));
+                      settings.setApiKey(String("key-") + String(i));
+                      sim::runForMs(500);
+                    }
+                    sim::runForMs(3 * SETTINGS_COMMIT_DELAY_MS);
+                    sim::click();       // Leave Idle for project select...
+                    sim::doubleClick(); // ...and come straight back
+                  });
+}
+
+void test_focus_session_commits_once()
+{
+  expectOneCommit(&StateMachine::idleState, []()
+                  {
+                    sim::click(); // Project select
+                    sim::runForMs(sim::queueEncoderTrace(1, 20, 0) / 1000 + 500);
+                    sim::click(); // Start the timer with the picked project
+                    sim::runForMs(60 * 1000);
+                    sim::doubleClick(); // Cancel, back to Idle
+                  });
+}
+
+// A change just before sleep is written on the way in, before its debounce
+void test_change_before_sleep_commits_once()
+{
+  expectOneCommit(&StateMachine::sleepState, []()
+                  {
+                    sim::runForMs(SLEEP_TIMOUT * 60 * 1000 - 2000);
+                    settings.setApiKey("key-before-sleep");
+                  });
+  sim::click(); // Wake up
+}
+
+void test_every_setting_reaches_flash()
+{
+  SettingsStore reloaded;
+  TEST_ASSERT_TRUE(reloaded.begin());
+  TEST_ASSERT_EQUAL(settings.getTimer(), reloaded.getTimer());
+  TEST_ASSERT_EQUAL_STRING("http://hooks.example.com/5", reloaded.getWebhookUrl().c_str());
+  TEST_ASSERT_EQUAL_STRING("key-before-sleep", reloaded.getApiKey().c_str());
+  TEST_ASSERT_EQUAL(settings.getLastProjectIndex(), reloaded.getLastProjectIndex());
+}
+
+int main(int argc, char **argv)
+{
+  (void)argc;
+  (void)argv;
+  sim::setSerialEcho(false);
+  if (!sim::bootDevice(25))
+    return 1;
+  settings.commit(); // Start from a clean store
+
+  UNITY_BEGIN();
+  RUN_TEST(test_dial_adjust_commits_once);
+  RUN_TEST(test_web_edits_commit_once);
+  RUN_TEST(test_focus_session_commits_once);
+  RUN_TEST(test_change_before_sleep_commits_once);
+  RUN_TEST(test_every_setting_reaches_flash);
+  return UNITY_END();
+}
@@ -0,0 +1,249 @@
+#!/usr/bin/env python3
+"""Builds the web UI's LittleFS image contents from firmware/web.
+
+Each asset is minified and gzipped, and app.js and style.css are renamed
+after a hash of their contents, so the device can serve them with a
+year-long immutable Cache-Control: a changed file is a new URL. Only
+index.html, which names the current hashes, keeps its name and is
+revalidated on every load.
+
+    firmware/web/app.js     -> firmware/data/assets/app.<hash>.js.gz
+    firmware/web/style.css  -> firmware/data/assets/style.<hash>.css.gz
+    firmware/web/index.html -> firmware/data/index.html.gz
+
+firmware/data is generated and wiped on every run. PlatformIO runs this
+before `pio run -t buildfs` / `-t uploadfs` (extra_scripts in
+platformio.ini); it can also be run by hand, which prints the bytes a
+browser downloads before and after and a page-load time modeled from them:
+
+    python3 firmware/tools/build_web.py [--throughput-kib 64] [--rtt-ms 20]
+
+The throughput default is roughly what AsyncWebServer manages reading
+LittleFS on the ESP32 over WiFi; measure yours and pass it in.
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import shutil
+
+HASHED = ["app.js", "style.css"]  # Referenced by name from index.html
+INDEX = "index.html"
+
+
+def minify_js(source):
+    """Drops comments, indentation and blank lines.
+
+    Conservative on purpose: newlines stay (no semicolon insertion to get
+    wrong) and nothing inside strings, template literals or regex literals
+    is touched. Gzip takes most of what a real minifier would.
+    """
+    out = []
+    i = 0
+    n = len(source)
+    templates = []  # Brace depth of each ${ } we are inside
+    last = ""  # Last significant character emitted, to tell a regex from a division
+    line_start = True
+
+    def emit(text):
+        nonlocal last, line_start
+        out.append(text)
+        stripped = text.strip()
+        if stripped:
+            last = stripped[-1]
+        line_start = False
+
+    while i < n:
+        c = source[i]
+        if c == "\n":
+            while out and out[-1] in (" ", "\t"):
+                out.pop()
+            if out and out[-1] != "\n":
+                out.append("\n")
+            line_start = True
+            i += 1
+            continue
+        if c in " \t\r" and line_start:
+            i += 1
+            continue
+        if source.startswith("//", i):
+            while i < n and source[i] != "\n":
+                i += 1
+            continue
+        if source.startswith("/*", i):
+            end = source.find("*/", i + 2)
+            i = n if end < 0 else end + 2
+            continue
+        if c in "'\"":
+            j = i + 1
+            while j < n and source[j] != c:
+                j += 2 if source[j] == "\\" else 1
+            emit(source[i:j + 1])
+            i = j + 1
+            continue
+        if c == "`" or (c == "}" and templates and templates[-1] == 0):
+            # Template text up to the closing backtick or the next ${
+            if c == "}":
+                templates.pop()
+            j = i + 1
+            while j < n and source[j] != "`" and not source.startswith("${", j):
+                j += 2 if source[j] == "\\" else 1
+            if source.startswith("${", j):
+                templates.append(0)
+                j += 1
+            emit(source[i:j + 1])
+            i = j + 1
+            continue
+        if c == "/" and (last == "" or last in "(,=:[!&|?{};+-*%<>~^" or _ends_with_keyword(out)):
+            j = i + 1
+            in_class = False
+            while j < n and (in_class or source[j] != "/"):
+                if source[j] == "\\":
+                    j += 1
+                elif source[j] == "[":
+                    in_class = True
+                elif source[j] == "]":
+                    in_class = False
+                j += 1
+            j += 1
+            while j < n and source[j].isalpha():
+                j += 1
+            emit(source[i:j])
+            i = j
+            continue
+        if templates:
+            if c == "{":
+                templates[-1] += 1
+            elif c == "}":
+                templates[-1] -= 1
+        emit(c)
+        i += 1
+    return "".join(out).strip() + "\n"
+
+
+def _ends_with_keyword(out):
+    tail = "".join(out[-8:]).rstrip()
+    return re.search(r"(^|[^\w$])(return|typeof|case|do|else|in|of)$", tail) is not None
+
+
+def minify_css(source):
+    source = re.sub(r"/\*.*?\*/", "", source, flags=re.S)
+    source = re.sub(r"\s+", " ", source)
+    source = re.sub(r"\s*([{};,>])\s*", r"\1", source)
+    source = source.replace(";}", "}")
+    return source.strip() + "\n"
+
+
+def minify_html(source):
+    source = re.sub(r"<!--.*?-->", "", source, flags=re.S)
+
+    def script(match):
+        body = match.group(2)
+        return match.group(1) + (minify_js(body).strip() if body.strip() else "") + match.group(3)
+
+    source = re.sub(r"(<script[^>]*>)(.*?)(</script>)", script, source, flags=re.S)
+    lines = (line.strip() for line in source.splitlines())
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def compress(data):
+    # mtime=0 keeps the output, and so the hashes, reproducible
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def build(web_dir, data_dir, quiet=False):
+    """Writes data_dir; returns {name: (raw, minified, gzipped)} byte counts."""
+    if os.path.isdir(data_dir):
+        shutil.rmtree(data_dir)
+    os.makedirs(os.path.join(data_dir, "assets"))
+
+    sizes = {}
+    names = {}
+    for name in HASHED:
+        with open(os.path.join(web_dir, name), encoding="utf-8") as f:
+            raw = f.read()
+        minified = (minify_js if name.endswith(".js") else minify_css)(raw).encode("utf-8")
+        packed = compress(minified)
+        stem, ext = os.path.splitext(name)
+        hashed = "assets/%s.%s%s" % (stem, hashlib.sha256(minified).hexdigest()[:8], ext)
+        with open(os.path.join(data_dir, hashed + ".gz"), "wb") as f:
+            f.write(packed)
+        names[name] = hashed
+        sizes[name] = (len(raw.encode("utf-8")), len(minified), len(packed))
+
+    with open(os.path.join(web_dir, INDEX), encoding="utf-8") as f:
+        raw = f.read()
+    index = raw
+    for name, hashed in names.items():
+        pattern = r'((?:src|href)=")/?%s(")' % re.escape(name)
+        index, count = re.subn(pattern, r"\g<1>/%s\g<2>" % hashed, index)
+        if count != 1:
+            raise SystemExit("build_web: expected one reference to %s in %s, found %d" % (name, INDEX, count))
+    minified = minify_html(index).encode("utf-8")
+    packed = compress(minified)
+    with open(os.path.join(data_dir, INDEX + ".gz"), "wb") as f:
+        f.write(packed)
+    sizes[INDEX] = (len(raw.encode("utf-8")), len(minified), len(packed))
+
+    if not quiet:
+        for name, (raw_size, min_size, gz_size) in sizes.items():
+            target = names.get(name, INDEX) + ".gz"
+            print("build_web: %-10s %6d B raw, %6d B minified, %6d B gzipped -> %s" % (name, raw_size, min_size, gz_size, target))
+    return sizes
+
+
+def load_time_ms(requests, throughput_kib, rtt_ms):
+    """One round trip per request plus its bytes at the given throughput.
+
+    requests is a list of stages; the requests within a stage go out in
+    parallel (the browser fetches CSS and JS together once it has the HTML)
+    but share the link.
+    """
+    total = 0.0
+    for stage in requests:
+        total += rtt_ms + sum(stage) * 1000.0 / (throughput_kib * 1024)
+    return total
+
+
+def report(sizes, throughput_kib, rtt_ms):
+    raw = [sizes[name][0] for name in HASHED]
+    packed = [sizes[name][2] for name in HASHED]
+    # Before: plain files with no validators, so every load fetches all three
+    before = [[sizes[INDEX][0]], raw]
+    # After, first visit: gzipped; repeat visit: a 304 for the HTML and the
+    # assets straight from the browser cache
+    first = [[sizes[INDEX][2]], packed]
+    repeat = [[0]]
+
+    def line(label, stages):
+        print("  %-22s %6d B, %6.0f ms" % (label, sum(sum(s) for s in stages), load_time_ms(stages, throughput_kib, rtt_ms)))
+
+    print("Transferred per page load (modeled at %g KiB/s, %g ms RTT):" % (throughput_kib, rtt_ms))
+    line("before, every load", before)
+    line("after, first visit", first)
+    line("after, repeat visit", repeat)
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--web", default=os.path.join(root, "web"), help="source directory")
+    parser.add_argument("--data", default=os.path.join(root, "data"), help="output directory (wiped)")
+    parser.add_argument("--throughput-kib", type=float, default=64, help="device to browser throughput for the model")
+    parser.add_argument("--rtt-ms", type=float, default=20, help="round trip time for the model")
+    args = parser.parse_args()
+    report(build(args.web, args.data), args.throughput_kib, args.rtt_ms)
+
+
+try:
+    Import("env")  # noqa: F821 -- defined when PlatformIO runs this as an extra script
+except NameError:
+    env = None
+
+if env is not None:
+    if {"buildfs", "uploadfs", "uploadfsota"} & set(COMMAND_LINE_TARGETS):  # noqa: F821
+        build(os.path.join(env.subst("$PROJECT_DIR"), "firmware", "web"), env.subst("$PROJECT_DATA_DIR"))
+elif __name__ == "__main__":
+    main()
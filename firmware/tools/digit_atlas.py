@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Prerenders Org_01's digits at the display's text size for DisplayController.
+
+The big timer digits are Org_01 at setTextSize(5): every set bit of a 5x5
+glyph becomes a 5x5 fillRect, redone on every frame. This renders the ten
+digits once, exactly as Adafruit GFX would, and lays them out the way the
+SSD1306 framebuffer is: one byte per column per 8-row page, LSB on top. A
+glyph is then DIGIT_ATLAS_PAGES memcpy()s of its width into the buffer.
+
+The framebuffer is byte-aligned only on page boundaries, so each vertical
+alignment the firmware draws at (first glyph row mod 8) gets its own copy;
+the screens put the baseline at y=36 and y=40, which is shifts 0 and 4.
+
+    firmware/include/fonts/Org_01.h -> firmware/include/fonts/Org_01_digits.h
+
+PlatformIO runs this before every build (extra_scripts in platformio.ini)
+and it only rewrites the header when the output changes; it can also be
+run by hand:
+
+    python3 firmware/tools/digit_atlas.py [--shifts 0,4]
+"""
+
+import argparse
+import os
+import re
+
+SCALE = 5
+DIGITS = "0123456789"
+FIRST_CHAR = 0x20  # Org_01Glyphs starts at ' '
+
+
+def parse_font(path):
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+    bitmaps = re.search(r"Org_01Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", source, re.S).group(1)
+    glyphs = re.search(r"Org_01Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", source, re.S).group(1)
+    data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmaps)]
+    table = [tuple(int(v) for v in entry.split(","))
+             for entry in re.findall(r"\{\s*(-?\d+\s*,\s*-?\d+\s*,\s*-?\d+\s*,\s*-?\d+\s*,\s*-?\d+\s*,\s*-?\d+)\s*\}", glyphs)]
+    return data, table
+
+
+def render(data, glyph):
+    """Set pixels of a glyph at SCALE as (column, row) relative to the cursor, like GFX drawChar."""
+    offset, width, height, advance, x_offset, y_offset = glyph
+    pixels = set()
+    bit = 0
+    for yy in range(height):
+        for xx in range(width):
+            if data[offset + bit // 8] & (0x80 >> (bit % 8)):
+                for dx in range(SCALE):
+                    for dy in range(SCALE):
+                        pixels.add(((x_offset + xx) * SCALE + dx, (y_offset + yy) * SCALE + dy))
+            bit += 1
+    return pixels, width * SCALE, advance * SCALE
+
+
+def build(font_path, shifts):
+    data, table = parse_font(font_path)
+    rendered = [render(data, table[ord(d) - FIRST_CHAR]) for d in DIGITS]
+    for d, (pixels, _, _) in zip(DIGITS, rendered):
+        if min(x for x, _ in pixels) < 0:
+            raise SystemExit("digit_atlas: '%s' starts left of the cursor" % d)
+    top = min(y for pixels, _, _ in rendered for _, y in pixels)
+    bottom = max(y for pixels, _, _ in rendered for _, y in pixels)
+    pages = max((shift + bottom - top) // 8 + 1 for shift in shifts)
+
+    glyphs = []
+    offset = 0
+    for pixels, width, advance in rendered:
+        glyphs.append((offset, width, advance))
+        offset += pages * width
+    atlases = []
+    for shift in shifts:
+        atlas = []
+        for pixels, width, _ in rendered:
+            for page in range(pages):
+                for x in range(width):
+                    byte = 0
+                    for bit in range(8):
+                        if (x, top - shift + page * 8 + bit) in pixels:
+                            byte |= 1 << bit
+                    atlas.append(byte)
+        atlases.append(atlas)
+    return top, pages, glyphs, atlases
+
+
+def header(top, pages, shifts, glyphs, atlases):
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by firmware/tools/digit_atlas.py from Org_01.h; don't edit.")
+    out.append("//")
+    out.append("// Org_01's digits at text size %d in SSD1306 page order: per glyph," % SCALE)
+    out.append("// DIGIT_ATLAS_PAGES runs of width bytes, one byte per column, LSB the")
+    out.append("// top row. The first page starts digitAtlasShifts[i] rows above the glyph.")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("#define DIGIT_ATLAS_TOP %d // First glyph row, relative to the baseline" % top)
+    out.append("#define DIGIT_ATLAS_PAGES %d" % pages)
+    out.append("#define DIGIT_ATLAS_SHIFTS %d" % len(shifts))
+    out.append("#define DIGIT_ATLAS_BYTES %d // Per shift" % len(atlases[0]))
+    out.append("")
+    out.append("struct DigitAtlasGlyph")
+    out.append("{")
+    out.append("  uint16_t offset; // Into each shift's bitmap")
+    out.append("  uint8_t width;   // Columns")
+    out.append("  uint8_t advance; // To the next glyph's cursor")
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t digitAtlasShifts[DIGIT_ATLAS_SHIFTS] = {%s};" % ", ".join(str(s) for s in shifts))
+    out.append("")
+    out.append("const DigitAtlasGlyph digitAtlasGlyphs[10] = {")
+    for digit, (offset, width, advance) in zip(DIGITS, glyphs):
+        out.append("    {%d, %d, %d}, // '%s'" % (offset, width, advance, digit))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t digitAtlasBitmaps[DIGIT_ATLAS_SHIFTS][DIGIT_ATLAS_BYTES] PROGMEM = {")
+    for shift, atlas in zip(shifts, atlases):
+        out.append("    { // Shift %d" % shift)
+        for i in range(0, len(atlas), 12):
+            out.append("        " + ", ".join("0x%02X" % b for b in atlas[i:i + 12]) + ",")
+        out.append("    },")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def generate(font_path, output_path, shifts, quiet=False):
+    top, pages, glyphs, atlases = build(font_path, shifts)
+    text = header(top, pages, shifts, glyphs, atlases)
+    try:
+        with open(output_path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    except FileNotFoundError:
+        pass
+    with open(output_path, "w", encoding="utf-8") as f:
+        f.write(text)
+    if not quiet:
+        print("digit_atlas: %d digits, %d pages, shifts %s, %d bytes -> %s" % (
+            len(glyphs), pages, ",".join(str(s) for s in shifts), sum(len(a) for a in atlases), output_path))
+
+
+def main():
+    fonts = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "include", "fonts")
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--font", default=os.path.join(fonts, "Org_01.h"))
+    parser.add_argument("--output", default=os.path.join(fonts, "Org_01_digits.h"))
+    parser.add_argument("--shifts", default="0,4", help="first glyph row mod 8 for each alignment to prerender")
+    args = parser.parse_args()
+    generate(args.font, args.output, [int(s) for s in args.shifts.split(",")])
+
+
+try:
+    Import("env")  # noqa: F821 -- defined when PlatformIO runs this as an extra script
+except NameError:
+    env = None
+
+if env is not None:
+    fonts = os.path.join(env.subst("$PROJECT_DIR"), "firmware", "include", "fonts")
+    generate(os.path.join(fonts, "Org_01.h"), os.path.join(fonts, "Org_01_digits.h"), [0, 4])
+elif __name__ == "__main__":
+    main()
@@ -0,0 +1,396 @@
+#!/usr/bin/env python3
+"""Packs OLED animations from PNG/BMP frame sequences for AnimationDecoder.
+
+Each animation is a directory of same-sized frames, played in file name
+order (00.png, 01.png, ...). A pixel is lit when it is bright (luminance of
+128 or more) and, if the image has alpha, opaque. Widths must be a multiple
+of 8 and at most ANIMATION_MAX_WIDTH x ANIMATION_MAX_HEIGHT.
+
+    python3 firmware/tools/pack_animation.py pack [DIR ...] [-o firmware/include/animations.h]
+
+With no DIRs, every subdirectory of firmware/animations is packed, named
+after the directory. The output is checked by decoding it forward and in
+reverse (both wrapping) and comparing every frame with its source.
+
+The format, as AnimationDecoder.h documents it: delta 0 is frame 0, delta
+i (1..N-1) is frame i-1 XOR frame i, and delta N is frame N-1 XOR frame 0.
+XOR runs both ways, so the same deltas play forward, in reverse and around
+the loop, and the last frame is delta 0 XOR delta N. Each delta is a mask
+of the rows it changes (bit y%8 of byte y/8) followed by the XOR bytes of
+just those rows, PackBits-coded: a control byte c < 0x80 is followed by
+c+1 literal bytes, c >= 0x80 by one byte repeated c-0x80+2 times.
+
+The animations in bitmaps.h were raw 48x48 arrays; `export` writes such
+arrays out as frame directories once, to be edited and repacked:
+
+    python3 firmware/tools/pack_animation.py export HEADER OUTDIR [--size 48x48]
+
+Standard library only.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+HEADER_MAX_WIDTH = 64  # ANIMATION_MAX_WIDTH in AnimationDecoder.h
+HEADER_MAX_HEIGHT = 64  # ANIMATION_MAX_HEIGHT
+
+
+# --- Image reading ---
+
+def read_png(path):
+    """(width, height, rows of booleans) from a non-interlaced PNG."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+    pos = 8
+    idat = b""
+    palette = None
+    transparency = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [chunk[i:i + 3] for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            transparency = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+    if interlace:
+        raise ValueError("%s: interlaced PNGs are not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    if depth == 16:
+        raise ValueError("%s: 16-bit PNGs are not supported" % path)
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    step = max(bits_per_pixel // 8, 1)
+    raw = zlib.decompress(idat)
+
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            a = line[i - step] if i >= step else 0
+            b = previous[i]
+            c = previous[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        previous = line
+
+        row = []
+        for x in range(width):
+            if depth < 8:
+                bit = x * depth
+                sample = (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+                samples = [sample]
+            else:
+                samples = list(line[x * channels:(x + 1) * channels])
+            if color == 3:
+                index = samples[0]
+                rgb = palette[index]
+                alpha = transparency[index] if transparency and index < len(transparency) else 255
+                row.append(lit(rgb[0], rgb[1], rgb[2], alpha))
+            else:
+                if depth < 8:
+                    samples = [samples[0] * 255 // ((1 << depth) - 1)]
+                if color in (0, 4):
+                    row.append(lit(samples[0], samples[0], samples[0], samples[1] if color == 4 else 255))
+                else:
+                    row.append(lit(samples[0], samples[1], samples[2], samples[3] if color == 6 else 255))
+        rows.append(row)
+    return width, height, rows
+
+
+def read_bmp(path):
+    """(width, height, rows of booleans) from an uncompressed 1/8/24/32-bit BMP."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] != b"BM":
+        raise ValueError("%s: not a BMP" % path)
+    offset = struct.unpack("<I", data[10:14])[0]
+    header_size, width, height, _, depth, compression = struct.unpack("<IiiHHI", data[14:34])
+    if compression not in (0, 3) or depth not in (1, 8, 24, 32):
+        raise ValueError("%s: only uncompressed 1, 8, 24 and 32-bit BMPs are supported" % path)
+    palette = []
+    if depth <= 8:
+        start = 14 + header_size
+        palette = [data[start + i * 4:start + i * 4 + 3] for i in range(1 << depth)]  # BGR
+    top_down = height < 0
+    height = abs(height)
+    stride = ((width * depth + 31) // 32) * 4
+    rows = []
+    for y in range(height):
+        line = data[offset + (y if top_down else height - 1 - y) * stride:][:stride]
+        row = []
+        for x in range(width):
+            if depth == 1:
+                bgr = palette[(line[x // 8] >> (7 - x % 8)) & 1]
+            elif depth == 8:
+                bgr = palette[line[x]]
+            else:
+                bgr = line[x * depth // 8:x * depth // 8 + 3]
+            row.append(lit(bgr[2], bgr[1], bgr[0], 255))
+        rows.append(row)
+    return width, height, rows
+
+
+def lit(r, g, b, alpha):
+    return alpha >= 128 and (r * 299 + g * 587 + b * 114) // 1000 >= 128
+
+
+def read_frame(path):
+    reader = read_png if path.lower().endswith(".png") else read_bmp
+    width, height, rows = reader(path)
+    if width % 8:
+        raise SystemExit("pack_animation: %s is %d wide; frames must be a multiple of 8" % (path, width))
+    frame = bytearray()
+    for row in rows:
+        for x in range(0, width, 8):
+            frame.append(sum(0x80 >> i for i in range(8) if row[x + i]))
+    return width, height, bytes(frame)
+
+
+def write_png(path, width, height, frame):
+    """1-bit grayscale, which is the raw frame's own row layout."""
+    stride = width // 8
+    raw = b"".join(b"\x00" + frame[y * stride:(y + 1) * stride] for y in range(height))
+
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 1, 0, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+# --- Format ---
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        run = 1
+        while i + run < n and data[i + run] == data[i] and run < 129:
+            run += 1
+        if run >= 2:
+            out += bytes([0x80 + run - 2, data[i]])
+            i += run
+            continue
+        # Literals up to the next run worth breaking for
+        j = i + 1
+        while j < n and j - i < 128 and not (j + 2 < n and data[j] == data[j + 1] == data[j + 2]):
+            j += 1
+        out.append(j - i - 1)
+        out += data[i:j]
+        i = j
+    return bytes(out)
+
+
+def unpackbits(data, pos, count):
+    out = bytearray()
+    while len(out) < count:
+        control = data[pos]
+        if control < 0x80:
+            out += data[pos + 1:pos + 2 + control]
+            pos += 2 + control
+        else:
+            out += bytes([data[pos + 1]]) * (control - 0x80 + 2)
+            pos += 2
+    if len(out) != count:
+        raise AssertionError("run crosses a delta boundary")
+    return bytes(out), pos
+
+
+def encode_delta(before, after, width, height):
+    stride = width // 8
+    mask = bytearray((height + 7) // 8)
+    changed = bytearray()
+    for y in range(height):
+        xor = bytes(a ^ b for a, b in zip(before[y * stride:(y + 1) * stride], after[y * stride:(y + 1) * stride]))
+        if any(xor):
+            mask[y // 8] |= 1 << (y % 8)
+            changed += xor
+    return bytes(mask) + packbits(bytes(changed)), bin(int.from_bytes(mask, "little")).count("1")
+
+
+def encode(frames, width, height):
+    """(data, offsets, rows changed per step) for a list of raw frames."""
+    blank = bytes(len(frames[0]))
+    pairs = [(blank, frames[0])] + list(zip(frames, frames[1:])) + [(frames[-1], frames[0])]
+    data = bytearray()
+    offsets = []
+    rows = []
+    for before, after in pairs:
+        offsets.append(len(data))
+        delta, changed = encode_delta(before, after, width, height)
+        data += delta
+        rows.append(changed)
+    offsets.append(len(data))
+    if len(data) > 0xFFFF:
+        raise SystemExit("pack_animation: %d bytes packed; offsets are 16-bit" % len(data))
+    return bytes(data), offsets, rows
+
+
+def apply_delta(frame, data, offsets, index, width, height):
+    stride = width // 8
+    mask_bytes = (height + 7) // 8
+    pos = offsets[index]
+    mask = data[pos:pos + mask_bytes]
+    changed = [y for y in range(height) if mask[y // 8] & (1 << (y % 8))]
+    xor, end = unpackbits(data, pos + mask_bytes, len(changed) * stride)
+    if end != offsets[index + 1]:
+        raise AssertionError("delta %d decodes to the wrong length" % index)
+    frame = bytearray(frame)
+    for i, y in enumerate(changed):
+        for x in range(stride):
+            frame[y * stride + x] ^= xor[i * stride + x]
+    return bytes(frame)
+
+
+def verify(frames, data, offsets, width, height):
+    count = len(frames)
+    frame = apply_delta(bytes(len(frames[0])), data, offsets, 0, width, height)
+    # Forward twice around the loop
+    for step in range(2 * count):
+        if frame != frames[step % count]:
+            return False
+        frame = apply_delta(frame, data, offsets, count if step % count == count - 1 else step % count + 1, width, height)
+    # From the last frame (delta 0 XOR delta N), in reverse twice around
+    frame = apply_delta(apply_delta(bytes(len(frames[0])), data, offsets, 0, width, height), data, offsets, count, width, height)
+    current = count - 1
+    for _ in range(2 * count):
+        if frame != frames[current]:
+            return False
+        frame = apply_delta(frame, data, offsets, count if current == 0 else current, width, height)
+        current = count - 1 if current == 0 else current - 1
+    return True
+
+
+# --- Commands ---
+
+def c_bytes(values, indent="    ", per_line=16, fmt="0x%02X"):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def pack(directories, output):
+    out = ["#pragma once", "",
+           "// Generated by firmware/tools/pack_animation.py from firmware/animations; don't edit.",
+           "// Delta + PackBits frames, as AnimationDecoder.h describes.", "",
+           "#include \"AnimationDecoder.h\"", ""]
+    total_raw = 0
+    total_packed = 0
+    for directory in directories:
+        name = os.path.basename(os.path.normpath(directory))
+        paths = sorted(os.path.join(directory, f) for f in os.listdir(directory) if f.lower().endswith((".png", ".bmp")))
+        if not paths:
+            raise SystemExit("pack_animation: no PNG or BMP frames in %s" % directory)
+        if len(paths) > 255:
+            raise SystemExit("pack_animation: %s has %d frames; at most 255" % (directory, len(paths)))
+        frames = []
+        for path in paths:
+            width, height, frame = read_frame(path)
+            if frames and (width, height) != size:
+                raise SystemExit("pack_animation: %s is %dx%d, the rest are %dx%d" % (path, width, height, size[0], size[1]))
+            size = (width, height)
+            frames.append(frame)
+        width, height = size
+        if width > HEADER_MAX_WIDTH or height > HEADER_MAX_HEIGHT:
+            raise SystemExit("pack_animation: %s is %dx%d, over %dx%d" % (directory, width, height, HEADER_MAX_WIDTH, HEADER_MAX_HEIGHT))
+
+        data, offsets, rows = encode(frames, width, height)
+        if not verify(frames, data, offsets, width, height):
+            raise SystemExit("pack_animation: %s did not round-trip" % directory)
+        raw = len(frames) * len(frames[0])
+        packed = len(data) + 2 * len(offsets)
+        total_raw += raw
+        total_packed += packed
+        steps = rows[1:]  # Frame to frame, including the wrap
+        print("pack_animation: %-22s %dx%d, %3d frames, %5d B raw -> %5d B packed, %4.1f of %d rows change per frame" % (
+            name, width, height, len(frames), raw, packed, sum(steps) / len(steps), height))
+
+        out.append("// %dx%d, %d frames: %d bytes raw, %d packed" % (width, height, len(frames), raw, packed))
+        out.append("static const uint8_t PROGMEM %s_data[] = {" % name)
+        out.append(c_bytes(data))
+        out.append("};")
+        out.append("static const uint16_t PROGMEM %s_deltas[] = {" % name)
+        out.append(c_bytes(offsets, per_line=12, fmt="%d"))
+        out.append("};")
+        out.append("static const PackedAnimation %s = {%d, %d, %d, %s_deltas, %s_data};" % (
+            name, width, height, len(frames), name, name))
+        out.append("")
+
+    with open(output, "w", encoding="utf-8") as f:
+        f.write("\n".join(out))
+    print("pack_animation: %d B raw -> %d B packed (%.0f%%) -> %s" % (total_raw, total_packed, 100.0 * total_packed / total_raw, output))
+
+
+def export(header, outdir, width, height):
+    with open(header, encoding="utf-8") as f:
+        source = f.read()
+    size = width // 8 * height
+    pattern = r"(\w+)\s*\[\]\s*\[%d\]\s*=\s*\{(.*?)\}\s*;" % size
+    for name, body in re.findall(r"PROGMEM\s+" + pattern, source, re.S):
+        values = [int(v, 0) for v in re.findall(r"0x[0-9A-Fa-f]+|\d+", body)]
+        if len(values) % size:
+            raise SystemExit("pack_animation: %s is not whole %d-byte frames" % (name, size))
+        directory = os.path.join(outdir, name)
+        os.makedirs(directory, exist_ok=True)
+        count = len(values) // size
+        for i in range(count):
+            write_png(os.path.join(directory, "%02d.png" % i), width, height, bytes(values[i * size:(i + 1) * size]))
+        print("pack_animation: %s, %d frames -> %s" % (name, count, directory))
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    commands = parser.add_subparsers(dest="command", required=True)
+    pack_parser = commands.add_parser("pack", help="frame directories to a header")
+    pack_parser.add_argument("directories", nargs="*")
+    pack_parser.add_argument("-o", "--output", default=os.path.join(root, "include", "animations.h"))
+    export_parser = commands.add_parser("export", help="raw frame arrays in a C header to frame directories")
+    export_parser.add_argument("header")
+    export_parser.add_argument("outdir")
+    export_parser.add_argument("--size", default="48x48")
+    args = parser.parse_args()
+
+    if args.command == "pack":
+        directories = args.directories
+        if not directories:
+            animations = os.path.join(root, "animations")
+            directories = sorted(os.path.join(animations, d) for d in os.listdir(animations)
+                                 if os.path.isdir(os.path.join(animations, d)))
+        pack(directories, args.output)
+    else:
+        width, height = (int(v) for v in args.size.split("x"))
+        export(args.header, args.outdir, width, height)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+"""Local HTTPS stand-in for the time tracker's webhook endpoint.
+
+Point the Focus Dial's webhook URL at https://<this-host>:8443/api/webhook
+and watch how the device's requests arrive: every POST is logged with the
+connection it came on, so keep-alive reuse and TLS session resumption are
+visible per request, and a running summary shows handshakes and reuse ratio.
+
+    python3 firmware/tools/webhook_standin.py [--port 8443] [--status 200]
+        [--close-after N] [--idle-timeout S] [--batch]
+
+With --batch it answers like the time tracker's route: it advertises
+X-Webhook-Batch: 1 and replies to a JSON array with one result per event.
+
+A self-signed certificate is generated in the temp directory on first run
+(needs the openssl CLI). The device skips certificate checks (setInsecure).
+"""
+
+import argparse
+import http.server
+import json
+import os
+import ssl
+import subprocess
+import tempfile
+import threading
+import time
+
+CERT_DIR = os.path.join(tempfile.gettempdir(), "focus-dial-standin")
+CERT = os.path.join(CERT_DIR, "cert.pem")
+KEY = os.path.join(CERT_DIR, "key.pem")
+
+lock = threading.Lock()
+totals = {"connections": 0, "resumed": 0, "requests": 0, "reused": 0}
+
+
+def ensure_certificate():
+    if os.path.exists(CERT) and os.path.exists(KEY):
+        return
+    os.makedirs(CERT_DIR, exist_ok=True)
+    subprocess.run(
+        ["openssl", "req", "-x509", "-newkey", "ec", "-pkeyopt", "ec_paramgen_curve:prime256v1",
+         "-nodes", "-days", "365", "-subj", "/CN=focus-dial-standin", "-keyout", KEY, "-out", CERT],
+        check=True, capture_output=True)
+
+
+class WebhookHandler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"  # Keep-alive unless the client asks to close
+    status = 200
+    close_after = 0
+    batch = False
+
+    def setup(self):
+        super().setup()
+        self.requests_on_connection = 0
+        resumed = getattr(self.connection, "session_reused", False)
+        with lock:
+            totals["connections"] += 1
+            totals["resumed"] += 1 if resumed else 0
+        print(f"[{self.client_address[0]}:{self.client_address[1]}] new connection, "
+              f"{getattr(self.connection, 'version', lambda: 'plain')()}, TLS session {'resumed' if resumed else 'full handshake'}")
+
+    def do_POST(self):
+        started = time.monotonic()
+        length = int(self.headers.get("Content-Length", 0))
+        body = self.rfile.read(length)
+        self.requests_on_connection += 1
+
+        with lock:
+            totals["requests"] += 1
+            totals["reused"] += 1 if self.requests_on_connection > 1 else 0
+            summary = dict(totals)
+
+        try:
+            event = json.loads(body)
+        except ValueError:
+            event = body.decode(errors="replace")
+
+        ok = 200 <= self.status < 300
+        if self.batch and isinstance(event, list):
+            results = [{"index": i, "status": self.status} for i in range(len(event))]
+            reply = json.dumps({"success": ok, "results": results}).encode()
+        else:
+            reply = json.dumps({"ok": ok}).encode()
+        self.send_response(self.status)
+        self.send_header("Content-Type", "application/json")
+        if self.batch:
+            self.send_header("X-Webhook-Batch", "1")
+        self.send_header("Content-Length", str(len(reply)))
+        closing = self.close_after and self.requests_on_connection >= self.close_after
+        if closing:
+            self.send_header("Connection", "close")
+            self.close_connection = True
+        self.end_headers()
+        self.wfile.write(reply)
+
+        print(f"  #{self.requests_on_connection} on this connection "
+              f"({'reused' if self.requests_on_connection > 1 else 'first'}), "
+              f"Connection: {self.headers.get('Connection', '-')}, "
+              f"answered {self.status} in {(time.monotonic() - started) * 1000:.1f} ms: {event}")
+        print(f"  totals: {summary['requests']} requests, {summary['connections']} connections "
+              f"({summary['resumed']} resumed), reuse ratio {summary['reused'] / summary['requests']:.0%}")
+
+    def log_message(self, format, *args):
+        pass  # do_POST prints its own line
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8443)
+    parser.add_argument("--status", type=int, default=200, help="HTTP status to answer (e.g. 503 to exercise retries)")
+    parser.add_argument("--close-after", type=int, default=0, help="Close each connection after N requests")
+    parser.add_argument("--idle-timeout", type=float, default=30, help="Seconds before an idle keep-alive connection is closed")
+    parser.add_argument("--batch", action="store_true", help="Accept JSON arrays of events, like the time tracker")
+    parser.add_argument("--plain", action="store_true", help="Serve plain HTTP instead of HTTPS")
+    args = parser.parse_args()
+
+    WebhookHandler.status = args.status
+    WebhookHandler.close_after = args.close_after
+    WebhookHandler.batch = args.batch
+    WebhookHandler.timeout = args.idle_timeout
+
+    server = http.server.ThreadingHTTPServer(("0.0.0.0", args.port), WebhookHandler)
+    if not args.plain:
+        ensure_certificate()
+        context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+        context.load_cert_chain(CERT, KEY)
+        server.socket = context.wrap_socket(server.socket, server_side=True)
+
+    scheme = "http" if args.plain else "https"
+    print(f"Webhook stand-in on {scheme}://0.0.0.0:{args.port}/api/webhook, answering {args.status}")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+"""Load client for the Focus Dial's WebSocket timer frames.
+
+Opens several WebSocket connections to the device's /ws: some read every
+frame as it arrives and time them, some connect and then never read, the
+way a browser tab that went to the background or a phone that dropped off
+WiFi would. Start a timer on the dial while it runs. At the end it prints,
+per reading client, the frames received, their rate and spacing, and
+whether each elapsed second arrived exactly once; for each stalled client
+whether the device closed it; and the device's own counters from
+/api/metrics (frames sent, clients dropped, deepest send queue).
+
+    python3 firmware/tools/ws_load.py [--host focus-dial.local] [--clients 3] [--stalled 1] [--seconds 60]
+
+A stalled client only backs up on the device once its TCP receive window is
+full, so its receive buffer is shrunk to make that happen within a few
+frames rather than a few hundred. Standard library only.
+"""
+
+import argparse
+import base64
+import json
+import os
+import socket
+import struct
+import threading
+import time
+import urllib.request
+
+PATH = "/ws"
+
+
+def handshake(host, port, rcvbuf=None):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    if rcvbuf:
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, rcvbuf)
+    sock.settimeout(10)
+    sock.connect((host, port))
+    key = base64.b64encode(os.urandom(16)).decode()
+    sock.sendall(("GET %s HTTP/1.1\r\nHost: %s\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                  "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (PATH, host, key)).encode())
+    response = b""
+    while b"\r\n\r\n" not in response:
+        chunk = sock.recv(1)
+        if not chunk:
+            raise ConnectionError("connection closed during handshake")
+        response += chunk
+    if b" 101 " not in response.split(b"\r\n", 1)[0]:
+        raise ConnectionError("handshake refused: %s" % response.split(b"\r\n", 1)[0].decode(errors="replace"))
+    return sock
+
+
+def recv_exact(sock, count):
+    data = b""
+    while len(data) < count:
+        chunk = sock.recv(count - len(data))
+        if not chunk:
+            raise ConnectionError("closed")
+        data += chunk
+    return data
+
+
+def read_frame(sock):
+    """(opcode, payload) of the next frame from the server (never masked)."""
+    first, second = recv_exact(sock, 2)
+    length = second & 0x7F
+    if length == 126:
+        length = struct.unpack(">H", recv_exact(sock, 2))[0]
+    elif length == 127:
+        length = struct.unpack(">Q", recv_exact(sock, 8))[0]
+    return first & 0x0F, recv_exact(sock, length)
+
+
+def send_frame(sock, opcode, payload=b""):
+    # Client frames must be masked
+    mask = os.urandom(4)
+    masked = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+    sock.sendall(bytes([0x80 | opcode, 0x80 | len(payload)]) + mask + masked)
+
+
+class Reader(threading.Thread):
+    def __init__(self, host, port, deadline):
+        super().__init__(daemon=True)
+        self.host, self.port, self.deadline = host, port, deadline
+        self.frames = []  # (arrival time, bytes, decoded frame)
+        self.error = None
+
+    def run(self):
+        try:
+            sock = handshake(self.host, self.port)
+            while time.monotonic() < self.deadline:
+                sock.settimeout(max(self.deadline - time.monotonic(), 0.01))
+                try:
+                    opcode, payload = read_frame(sock)
+                except socket.timeout:
+                    break
+                if opcode == 0x1:
+                    self.frames.append((time.monotonic(), len(payload), json.loads(payload)))
+                elif opcode == 0x9:
+                    send_frame(sock, 0xA, payload)
+                elif opcode == 0x8:
+                    self.error = "closed by the device"
+                    break
+            sock.close()
+        except (OSError, ConnectionError, ValueError) as error:
+            self.error = str(error)
+
+    def report(self, label):
+        frames = self.frames
+        if self.error:
+            print("  %s: %s" % (label, self.error))
+        if not frames:
+            print("  %s: no frames" % label)
+            return
+        span = frames[-1][0] - frames[0][0]
+        rate = (len(frames) - 1) / span if span > 0 else 0.0
+        # Spacing and seconds between consecutive frames of a running timer
+        gaps = []
+        every_second = True
+        ticks = 0
+        for previous, current in zip(frames, frames[1:]):
+            if previous[2].get("state") == "Timer" and current[2].get("state") == "Timer":
+                ticks += 1
+                gaps.append((current[0] - previous[0]) * 1000)
+                every_second = every_second and current[2]["elapsed"] == previous[2]["elapsed"] + 1
+        states = []
+        for _, _, frame in frames:
+            if not states or states[-1] != frame.get("state"):
+                states.append(frame.get("state"))
+        print("  %s: %d frames in %.1f s (%.2f/s), %d B avg; states %s" % (
+            label, len(frames), span, rate, sum(f[1] for f in frames) // len(frames), " > ".join(states)))
+        if gaps:
+            print("  %s: %d timer ticks, %.0f/%.0f/%.0f ms apart (min/avg/max), one per elapsed second: %s" % (
+                label, ticks, min(gaps), sum(gaps) / len(gaps), max(gaps), "yes" if every_second else "NO"))
+
+
+def stalled_client(host, port):
+    # 1 KiB is about as small as the kernel allows; it fills in a dozen frames
+    return handshake(host, port, rcvbuf=1024)
+
+
+def was_closed(sock):
+    """Reads what piled up for a couple of seconds; True if the device closed the connection."""
+    deadline = time.monotonic() + 2
+    try:
+        while time.monotonic() < deadline:
+            sock.settimeout(max(deadline - time.monotonic(), 0.01))
+            opcode, _ = read_frame(sock)
+            if opcode == 0x8:
+                return True
+        return False
+    except socket.timeout:
+        return False
+    except (OSError, ConnectionError):
+        return True
+
+
+def device_metrics(host, port):
+    try:
+        with urllib.request.urlopen("http://%s:%d/api/metrics" % (host, port), timeout=10) as response:
+            return json.load(response).get("websocket")
+    except (OSError, ValueError) as error:
+        return {"error": str(error)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="focus-dial.local")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=3, help="clients that read every frame")
+    parser.add_argument("--stalled", type=int, default=1, help="clients that never read")
+    parser.add_argument("--seconds", type=float, default=60)
+    args = parser.parse_args()
+
+    host = socket.gethostbyname(args.host)
+    deadline = time.monotonic() + args.seconds
+    readers = [Reader(host, args.port, deadline) for _ in range(args.clients)]
+    for reader in readers:
+        reader.start()
+    stalled = [stalled_client(host, args.port) for _ in range(args.stalled)]
+    print("%d reading and %d stalled clients on ws://%s%s for %g s; start a timer on the dial" % (
+        args.clients, args.stalled, args.host, PATH, args.seconds))
+    for reader in readers:
+        reader.join()
+
+    print("Reading clients:")
+    for i, reader in enumerate(readers):
+        reader.report("#%d" % (i + 1))
+    print("Stalled clients:")
+    for i, sock in enumerate(stalled):
+        print("  #%d: %s" % (i + 1, "closed by the device" if was_closed(sock) else "STILL OPEN"))
+        sock.close()
+    print("Device (/api/metrics websocket):")
+    print("  %s" % json.dumps(device_metrics(host, args.port)))
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,7 @@
 let ws = null;
 let isWsConnected = false;
 let colorPreviewTimeout = null;
+let projectNames = new Map(); // device_project_id -> name, for the timer status
 
 document.addEventListener('DOMContentLoaded', () => {
   console.log('DOM fully loaded');
@@ -85,12 +86,53 @@ function setupWebSocket() {
     // Don't close here, the onclose handler will be called
   };
 
+  // The device pushes its timer state on every change and once a second
+  // while a timer runs: {"state":"Timer","project":"<id>","duration":1500,"elapsed":42}
   ws.onmessage = (event) => {
-    console.log('WebSocket message received:', event.data);
-    // Handle any messages from the server if needed
+    let frame;
+    try {
+      frame = JSON.parse(event.data);
+    } catch (error) {
+      console.error('Unreadable WebSocket message:', event.data);
+      return;
+    }
+    if (typeof frame.state === 'string') {
+      renderTimerState(frame);
+    }
   };
 }
 
+function formatSeconds(seconds) {
+  const minutes = Math.floor(seconds / 60);
+  const rest = String(seconds % 60).padStart(2, '0');
+  return `${minutes}:${rest}`;
+}
+
+function renderTimerState(frame) {
+  const status = document.getElementById('timer-status');
+  if (!status) return;
+
+  const timed = frame.state === 'Timer' || frame.state === 'Paused' || frame.state === 'Done';
+  if (!timed) {
+    status.hidden = true;
+    return;
+  }
+
+  let time;
+  if (frame.duration === 0) {
+    time = `${formatSeconds(frame.elapsed)} elapsed`;
+  } else if (frame.state === 'Done') {
+    time = `${formatSeconds(frame.duration)} done`;
+  } else {
+    time = `${formatSeconds(Math.max(frame.duration - frame.elapsed, 0))} left`;
+  }
+  const project = projectNames.get(frame.project);
+  const label = frame.state === 'Timer' ? 'Running' : frame.state;
+  status.textContent = project ? `${label} · ${project} · ${time}` : `${label} · ${time}`;
+  status.className = `timer-status timer-status-${frame.state.toLowerCase()}`;
+  status.hidden = false;
+}
+
 // Function to send color update via WebSocket, with debounce
 function sendColorUpdate(colorHex) {
   if (!isWsConnected) {
@@ -290,6 +332,7 @@ async function fetchAndRenderProjects() {
 }
 
 function renderProjectList(projects) {
+  projectNames = new Map(projects.map((project) => [project.device_project_id, project.name]));
   if (!projectListDiv) return;
 
   if (projects.length === 0) {
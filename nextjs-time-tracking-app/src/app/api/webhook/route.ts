@@ -1,17 +1,63 @@
 import { NextRequest, NextResponse } from 'next/server';
 import { createClient } from '@supabase/supabase-js'; // Import standard client
-import type { Database } from '@/types/supabase';
+import type { Database, Json } from '@/types/supabase';
 import crypto from 'crypto'; // Import crypto for hashing
 
 // Remove old db imports
 // import { ... } from '@/lib/db';
 
 interface WebhookPayload {
+  event_id?: string;         // "<chip id>-<outbox seq>"; the same on every delivery of an event
   action: 'start_timer' | 'stop_timer';
   device_project_id: string; // Unique ID from the device
   project_name: string;      // Project name from the device
   project_color: string;     // Project color from the device
   description?: string;      // Optional description
+  timestamp?: number;        // Unix time of the event (seconds since boot until the device's SNTP syncs)
+  age_seconds?: number;      // How long ago the event happened; absent for one left over from before a reboot
+  duration_set_minutes?: number;
+  duration_actual_seconds?: number; // stop_timer: how long the timer ran on the device
+}
+
+// One entry per event in a batch, in request order
+interface WebhookItemResult {
+  index: number;
+  status: number;     // 200 applied, 400 invalid, 404 no active timer, 500 error
+  message?: string;
+  error?: string;
+  entry_id?: number;
+  duration?: number;
+  duplicate?: boolean; // Applied by an earlier delivery; this is its result
+}
+
+// Devices send a JSON array of events when several are pending (after an outage,
+// or a quick pause/resume). Every response carries this header so a device knows
+// the endpoint accepts batches before it sends one.
+const BATCH_HEADER = 'X-Webhook-Batch';
+const WEBHOOK_BATCH_MAX = 50;
+
+// Until its SNTP syncs a device stamps seconds since boot; only trust real Unix
+// times (2020 on), the same check apply_webhook_batch makes
+const UNIX_TIME_MIN = 1577836800;
+
+function wholeSeconds(value: unknown): number | null {
+  const seconds = typeof value === 'string' && /^[0-9]+$/.test(value) ? Number(value) : value;
+  return typeof seconds === 'number' && Number.isInteger(seconds) && seconds >= 0 ? seconds : null;
+}
+
+// When the event happened: its timestamp if that's a real Unix time, else now
+// less its age. `known` is false when neither is there (an event from before a
+// reboot, delivered before the clock synced), and the time is only the arrival.
+function eventTime(timestamp: unknown, ageSeconds: unknown): { at: Date; known: boolean } {
+  const seconds = wholeSeconds(timestamp);
+  if (seconds !== null && seconds >= UNIX_TIME_MIN) {
+    return { at: new Date(seconds * 1000), known: true };
+  }
+  const age = wholeSeconds(ageSeconds);
+  if (age !== null) {
+    return { at: new Date(Date.now() - age * 1000), known: true };
+  }
+  return { at: new Date(), known: false };
 }
 
 // Initialize Supabase client for server-side operations (e.g., webhook)
@@ -70,8 +116,76 @@ async function getUserIdFromApiKey(apiKey: string): Promise<string | null> {
 }
 // --- End Helper Function ---
 
+// --- Event Deduplication ---
+// Delivery is at least once: a device that lost the response to a POST sends
+// the event again. Applied events are recorded by event_id in webhook_events
+// (which apply_webhook_batch shares), and a repeat gets the first result back.
+type AppliedEventResult = { status: number } & { [key: string]: Json | undefined };
+
+async function findAppliedEvent(userId: string, eventId: string): Promise<AppliedEventResult | null> {
+  const { data, error } = await supabase
+    .from('webhook_events')
+    .select('result')
+    .eq('user_id', userId)
+    .eq('event_id', eventId)
+    .maybeSingle();
+  if (error) {
+    console.error('[Webhook] Error looking up event:', error);
+    return null; // Apply it; a lookup failure must not lose the event
+  }
+  return data ? (data.result as AppliedEventResult) : null;
+}
+
+async function recordAppliedEvent(userId: string, eventId: string | undefined, result: AppliedEventResult) {
+  if (!eventId) return;
+  const { error } = await supabase
+    .from('webhook_events')
+    .insert({ user_id: userId, event_id: eventId, result: result as Json });
+  if (error) {
+    console.error(`[Webhook] Error recording event ${eventId}:`, error);
+  }
+}
+// --- End Event Deduplication ---
+
+// --- Batch Handling ---
+// The whole batch is applied by one database call (apply_webhook_batch), i.e. in
+// one transaction; each event gets its own result so the device can retry only
+// the ones that failed.
+async function applyWebhookBatch(userId: string, events: WebhookPayload[]): Promise<NextResponse> {
+  if (events.length === 0) {
+    return NextResponse.json({ error: 'Empty batch' }, { status: 400 });
+  }
+  if (events.length > WEBHOOK_BATCH_MAX) {
+    return NextResponse.json({ error: `Batch too large (max ${WEBHOOK_BATCH_MAX} events)` }, { status: 413 });
+  }
+
+  const { data, error } = await supabase.rpc('apply_webhook_batch', {
+    p_user_id: userId,
+    p_events: events as unknown as Json,
+  });
+
+  if (error || !Array.isArray(data)) {
+    console.error('[Webhook] Error applying batch:', error);
+    return NextResponse.json({ error: 'Failed to apply batch' }, { status: 500 });
+  }
+
+  const results = data as unknown as WebhookItemResult[];
+  const failed = results.filter((result) => result.status >= 300).length;
+  console.log(`[Webhook] Applied batch of ${results.length} for user ${userId}: ${results.length - failed} ok, ${failed} failed`);
+
+  // 200 even with failed items: the per-item statuses say what to retry
+  return NextResponse.json({ success: failed === 0, results });
+}
+// --- End Batch Handling ---
+
 
 export async function POST(req: NextRequest) {
+  const response = await handleWebhook(req);
+  response.headers.set(BATCH_HEADER, '1');
+  return response;
+}
+
+async function handleWebhook(req: NextRequest): Promise<NextResponse> {
   // 1. Authenticate using API Key
   const authHeader = req.headers.get('Authorization');
   const apiKey = authHeader?.startsWith('Bearer ') ? authHeader.substring(7) : null;
@@ -92,8 +206,20 @@ export async function POST(req: NextRequest) {
     const body = await req.json();
     console.log('[Webhook] Received payload:', body);
 
+    if (Array.isArray(body)) {
+      return await applyWebhookBatch(userId, body as WebhookPayload[]);
+    }
+
     // Extract data based on the new WebhookPayload interface
-    const { action, device_project_id, project_name, project_color, description } = body as WebhookPayload;
+    const { event_id, action, device_project_id, project_name, project_color, description, timestamp, age_seconds, duration_actual_seconds } = body as WebhookPayload;
+
+    // A repeat of an event that was already applied
+    const applied = event_id ? await findAppliedEvent(userId, event_id) : null;
+    if (applied) {
+      console.log(`[Webhook] Event ${event_id} already applied, returning its result`);
+      const { status, ...result } = applied;
+      return NextResponse.json({ ...result, duplicate: true }, { status });
+    }
 
     // Validate required fields from the device
     if (!action || !device_project_id || !project_name || !project_color) {
@@ -151,8 +277,10 @@ export async function POST(req: NextRequest) {
     }
     // --- End Find or Create Project Logic ---
 
-    // Use server's current time
-    const now = new Date();
+    // When the event happened on the device, as for batches: a replayed
+    // event can arrive minutes or hours late
+    const eventAt = eventTime(timestamp, age_seconds);
+    const now = eventAt.at;
     const nowISO = now.toISOString();
 
     // 4. Perform Action (Start/Stop Timer) using the dbProjectId
@@ -175,11 +303,13 @@ export async function POST(req: NextRequest) {
       }
 
       console.log(`[Webhook] Timer started for user ${userId}, DB project ${dbProjectId}, entry ${newEntry.id}`);
-      return NextResponse.json({
+      const result = {
         success: true,
         message: 'Timer started',
         entry_id: newEntry.id
-      });
+      };
+      await recordAppliedEvent(userId, event_id, { status: 200, ...result });
+      return NextResponse.json(result);
 
     } else if (action === 'stop_timer') {
       // Find the most recent active entry for this user/project (using dbProjectId)
@@ -204,16 +334,22 @@ export async function POST(req: NextRequest) {
         return NextResponse.json({ error: 'No active timer found for this project' }, { status: 404 });
       }
 
-      // Calculate duration
+      // Calculate duration. With no time for the stop, the device's own count
+      // is better than the arrival time, which could be hours late.
       const startTime = new Date(activeEntry.start_time); // start_time should not be null here
-      const durationMs = now.getTime() - startTime.getTime();
-      const durationSec = Math.floor(durationMs / 1000);
+      const actualSec = wholeSeconds(duration_actual_seconds);
+      const durationSec = !eventAt.known && actualSec !== null
+        ? actualSec
+        : Math.floor((now.getTime() - startTime.getTime()) / 1000);
+      const endISO = eventAt.known || actualSec === null
+        ? nowISO
+        : new Date(startTime.getTime() + actualSec * 1000).toISOString();
 
       // Update the entry with end time and duration
       const { error: updateError } = await supabase
         .from('time_entries')
         .update({
-          end_time: nowISO,
+          end_time: endISO,
           duration: durationSec,
           // Optionally update description if provided in stop payload?
           description: description || activeEntry.description // Keep existing if not provided
@@ -227,12 +363,14 @@ export async function POST(req: NextRequest) {
       }
 
       console.log(`[Webhook] Timer stopped for user ${userId}, DB project ${dbProjectId}, entry ${activeEntry.id}`);
-      return NextResponse.json({
+      const result = {
         success: true,
         message: 'Timer stopped',
         entry_id: activeEntry.id,
         duration: durationSec
-      });
+      };
+      await recordAppliedEvent(userId, event_id, { status: 200, ...result });
+      return NextResponse.json(result);
     }
 
     // Should not be reached if action is validated earlier, but keep as fallback
@@ -129,12 +129,39 @@ export type Database = {
           },
         ]
       }
+      webhook_events: {
+        Row: {
+          created_at: string
+          event_id: string
+          result: Json
+          user_id: string
+        }
+        Insert: {
+          created_at?: string
+          event_id: string
+          result: Json
+          user_id: string
+        }
+        Update: {
+          created_at?: string
+          event_id?: string
+          result?: Json
+          user_id?: string
+        }
+        Relationships: []
+      }
     }
     Views: {
       [_ in never]: never
     }
     Functions: {
-      [_ in never]: never
+      apply_webhook_batch: {
+        Args: {
+          p_user_id: string
+          p_events: Json
+        }
+        Returns: Json
+      }
     }
     Enums: {
       [_ in never]: never
@@ -8,6 +8,8 @@ NC='\033[0m' # No Color
 
 # Define the API URL - use localhost for testing
 API_URL="http://localhost:3000/api/webhook"
+# Device API key from the app's settings page: API_KEY=... ./test-device-payload.sh
+API_KEY="${API_KEY:-}"
 
 echo -e "\n${YELLOW}Testing Focus Dial Device Webhook Payload Issue${NC}\n"
 
@@ -41,4 +43,18 @@ curl -s -X POST \
   "$API_URL?debug=true" | jq
 echo
 
+# A batch, as the device sends when several events are pending. The stop for
+# an unknown project should come back as a 404 item while the others apply.
+echo -e "${YELLOW}Test 4: Sending a batch of events (per-item results)${NC}"
+curl -s -i -X POST \
+  -H "Content-Type: application/json" \
+  -H "Authorization: Bearer ${API_KEY}" \
+  -d '[
+    {"action": "start_timer", "device_project_id": "E86BEA3003D4-5", "project_name": "Deal Probe", "project_color": "#4900f5", "timestamp": '$(($(date +%s) - 60))'},
+    {"action": "stop_timer", "device_project_id": "E86BEA3003D4-5", "project_name": "Deal Probe", "project_color": "#4900f5", "timestamp": '$(date +%s)'},
+    {"action": "stop_timer", "device_project_id": "E86BEA3003D4-404", "project_name": "Nothing Running", "project_color": "#000000", "timestamp": '$(date +%s)'}
+  ]' \
+  $API_URL
+echo
+
 echo -e "\n${GREEN}Testing completed. Check the responses to understand the issue.${NC}\n" 
\ No newline at end of file
@@ -0,0 +1,157 @@
+-- Events a device has had settled, by the event_id it sends ("<chip id>-<outbox
+-- seq>"). Delivery is at least once, so an event whose response was lost comes
+-- again; it is answered with the stored result instead of being applied twice.
+create table if not exists public.webhook_events (
+  user_id uuid references auth.users(id) on delete cascade not null,
+  event_id text not null,
+  result jsonb not null, -- { status, message | error, entry_id?, duration? }
+  created_at timestamptz default timezone('utc'::text, now()) not null,
+  primary key (user_id, event_id)
+);
+
+-- No policies: only the webhook route (service role) reads and writes it
+alter table public.webhook_events enable row level security;
+
+-- Applies a batch of device webhook events for one user in a single transaction.
+-- Events run in array order, each in its own subtransaction (BEGIN ... EXCEPTION),
+-- so a failing item is reported in its result without undoing the others and the
+-- device can retry just that item. Returns one result per event:
+--   { index, status, message | error, entry_id?, duration?, duplicate? }
+-- with HTTP-style statuses (200 applied, 400 invalid, 404 no active timer, 500 error).
+-- An event with an event_id seen before gets its first result again, marked
+-- duplicate; a valid one applied now (200, or 404 for a stop) is recorded with
+-- its changes.
+create or replace function public.apply_webhook_batch(p_user_id uuid, p_events jsonb)
+returns jsonb
+language plpgsql
+security definer
+set search_path = public
+as $$
+declare
+  v_event jsonb;
+  v_index integer := 0;
+  v_results jsonb := '[]'::jsonb;
+  v_result jsonb;
+  v_event_id text;
+  v_action text;
+  v_device_project_id text;
+  v_project_name text;
+  v_project_color text;
+  v_description text;
+  v_timestamp text;
+  v_age text;
+  v_actual text;
+  v_at timestamptz;
+  v_at_known boolean;
+  v_project_id bigint;
+  v_entry_id bigint;
+  v_entry_start timestamptz;
+  v_entry_description text;
+  v_duration integer;
+begin
+  if jsonb_typeof(p_events) is distinct from 'array' then
+    raise exception 'p_events must be a JSON array';
+  end if;
+
+  for v_event in select value from jsonb_array_elements(p_events)
+  loop
+    begin
+      v_event_id := v_event->>'event_id';
+      v_action := v_event->>'action';
+      v_device_project_id := v_event->>'device_project_id';
+      v_project_name := v_event->>'project_name';
+      v_project_color := v_event->>'project_color';
+      v_description := v_event->>'description';
+      v_timestamp := v_event->>'timestamp';
+      v_age := v_event->>'age_seconds';
+      v_actual := v_event->>'duration_actual_seconds';
+
+      select result into v_result
+      from webhook_events
+      where user_id = p_user_id and event_id = v_event_id;
+
+      if found then
+        v_result := v_result || jsonb_build_object('duplicate', true);
+      elsif v_action is null or v_device_project_id is null or v_project_name is null or v_project_color is null then
+        v_result := jsonb_build_object('status', 400,
+          'error', 'Missing required fields: action, device_project_id, project_name, project_color');
+      elsif v_action not in ('start_timer', 'stop_timer') then
+        v_result := jsonb_build_object('status', 400, 'error', 'Invalid action specified');
+      else
+        -- Until its SNTP syncs a device stamps seconds since boot; only trust
+        -- real Unix times, else date the event by its age. With neither (left
+        -- from before a reboot) the arrival time is all there is.
+        v_at_known := true;
+        if v_timestamp ~ '^[0-9]+$' and v_timestamp::bigint >= 1577836800 then
+          v_at := to_timestamp(v_timestamp::bigint);
+        elsif v_age ~ '^[0-9]+$' then
+          v_at := now() - make_interval(secs => v_age::bigint);
+        else
+          v_at := now();
+          v_at_known := false;
+        end if;
+
+        -- Find or create the project
+        insert into projects (user_id, device_project_id, name, color)
+        values (p_user_id, v_device_project_id, v_project_name, v_project_color)
+        on conflict (user_id, device_project_id) do nothing;
+
+        select id into v_project_id
+        from projects
+        where user_id = p_user_id and device_project_id = v_device_project_id;
+
+        if v_action = 'start_timer' then
+          insert into time_entries (project_id, user_id, start_time, description)
+          values (v_project_id, p_user_id, v_at, v_description)
+          returning id into v_entry_id;
+
+          v_result := jsonb_build_object('status', 200, 'message', 'Timer started', 'entry_id', v_entry_id);
+        else
+          select id, start_time, description into v_entry_id, v_entry_start, v_entry_description
+          from time_entries
+          where user_id = p_user_id and project_id = v_project_id and end_time is null
+          order by start_time desc
+          limit 1
+          for update;
+
+          if not found then
+            v_result := jsonb_build_object('status', 404, 'error', 'No active timer found for this project');
+          else
+            -- A stop with no time of its own (e.g. in one batch with its start)
+            -- ends by the device's count rather than on arrival
+            if not v_at_known and v_actual ~ '^[0-9]+$' then
+              v_at := v_entry_start + make_interval(secs => v_actual::bigint);
+            end if;
+            v_duration := greatest(0, floor(extract(epoch from (v_at - v_entry_start))))::integer;
+            update time_entries
+            set end_time = v_at,
+                duration = v_duration,
+                description = coalesce(v_description, v_entry_description)
+            where id = v_entry_id;
+
+            v_result := jsonb_build_object('status', 200,
+              'message', 'Timer stopped', 'entry_id', v_entry_id, 'duration', v_duration);
+          end if;
+        end if;
+
+        -- In the same subtransaction as the changes: a concurrent delivery of
+        -- the same event fails here, is rolled back and retried as a duplicate
+        if v_event_id is not null then
+          insert into webhook_events (user_id, event_id, result)
+          values (p_user_id, v_event_id, v_result);
+        end if;
+      end if;
+    exception when others then
+      v_result := jsonb_build_object('status', 500, 'error', sqlerrm);
+    end;
+    v_results := v_results || (jsonb_build_object('index', v_index) || v_result);
+    v_index := v_index + 1;
+  end loop;
+
+  return v_results;
+end;
+$$;
+
+-- Only the webhook route (service role) may apply events on a user's behalf
+revoke execute on function public.apply_webhook_batch(uuid, jsonb) from public, anon, authenticated;
+grant execute on function public.apply_webhook_batch(uuid, jsonb) to service_role;